@@ -1,6 +1,7 @@
 #include "ActionComponent.h"
 #include "../components/NavComponent.h"
 #include "../components/TraitsComponent.h"
+#include "../core/FrameArena.h"
 #include "../core/GameEngine.h"
 #include "../game/Animal.h"
 #include "../game/BuildingInstance.h"
@@ -194,6 +195,10 @@ void ActionComponent::UpdateIdleDecision(
   if (!m_owner)
     return;
 
+  // Bez przydziału AIScheduler decyzja czeka na kolejny tick
+  if (!m_owner->m_aiSchedule.granted)
+    return;
+
   // Delegation to Settler's existing decision logic for now, but with component
   // context In future phases, this logic will be fully decomposed into
   // 'ActionEvaluators'
@@ -240,7 +245,7 @@ void ActionComponent::EvaluateAndChooseAction(
   if (!m_owner)
     return;
 
-  std::vector<ScoredAction> options;
+  FrameVector<ScoredAction> options;
 
   // 1. IDLE (Base Score)
   options.push_back({SettlerState::IDLE, 10.0f, "Base Loop"});
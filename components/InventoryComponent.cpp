@@ -1,6 +1,6 @@
 
 #include "InventoryComponent.h"
-#include "../core/EventSystem.h"
+#include "../core/EventBus.h"
 #include <algorithm>
 #include "../events/InteractionEvents.h"        // InventoryChangedEvent
 #include <iostream>               // std::cout, std::endl
@@ -89,8 +89,8 @@ bool InventoryComponent::addItem(std::unique_ptr<Item> item, int quantity) {
     if (!item || quantity <= 0) {
         return false;
     }
-    // Sprawdź czy ekwipunek nie jest pełny (wagowo)
-    if (isFull()) {
+    // Sprawdź czy ekwipunek przyjmie przedmiot (waga, slot albo stack)
+    if (!canAdd(*item, quantity)) {
         std::cout << "[Inventory] AddItem Failed: Full capacity/weight." << std::endl;
         onCapacityExceeded(getCurrentWeight(), m_capacity);
         return false;
@@ -163,6 +163,8 @@ totalQuantity += item->quantity;
 return totalQuantity >= quantity;
 }
 int InventoryComponent::getResourceAmount(const std::string& resourceType) const {
+// Hash liczony raz - w pętli porównujemy tylko symbole
+const StringId resourceSid = StringId::of(resourceType);
 int total = 0;
 for (const auto& item : m_items) {
 if (item && item->item) {
@@ -170,7 +172,7 @@ if (item && item->item) {
 if (item->item->getItemType() == ItemType::RESOURCE) {
 // Rzutowanie na ResourceItem* - potrzebujemy dostępu do getResourceType()
 ResourceItem* resItem = dynamic_cast<ResourceItem*>(item->item.get());
-                if (resItem && resItem->getResourceType() == resourceType) {
+                if (resItem && resItem->getResourceSid() == resourceSid) {
                     total += item->quantity;
                 }
             }
@@ -180,6 +182,7 @@ ResourceItem* resItem = dynamic_cast<ResourceItem*>(item->item.get());
 }
 bool InventoryComponent::removeResource(const std::string& resourceType, int amount) {
 if (amount <= 0) return false;
+const StringId resourceSid = StringId::of(resourceType);
 int remaining = amount;
 // Iterujemy po wszystkich slotach
 for (size_t i = 0; i < m_items.size(); ++i) {
@@ -187,7 +190,7 @@ if (!m_items[i] || !m_items[i]->item) continue;
 // Sprawdź czy to ResourceItem i czy pasuje typ
 if (m_items[i]->item->getItemType() == ItemType::RESOURCE) {
 ResourceItem* resItem = dynamic_cast<ResourceItem*>(m_items[i]->item.get());
-if (resItem && resItem->getResourceType() == resourceType) {
+if (resItem && resItem->getResourceSid() == resourceSid) {
 if (m_items[i]->quantity <= remaining) {
 remaining -= m_items[i]->quantity;
 onItemRemoved(m_items[i].get());
@@ -353,6 +356,20 @@ bool InventoryComponent::isFull() const {
 if (getCurrentWeight() >= m_capacity) return true;
 return findFreeSlot() == -1;
 }
+bool InventoryComponent::canAdd(const Item& item, int quantity) const {
+if (quantity <= 0) return false;
+if (getCurrentWeight() >= m_capacity) return false;
+if (findFreeSlot() != -1) return true;
+if (!item.isStackable()) return false;
+// Brak wolnego slotu - zmieści się tylko w istniejących stackach
+int room = 0;
+for (const auto& invItem : m_items) {
+    if (!invItem || !invItem->item) continue;
+    if (invItem->item->hasSameDefinition(item))
+        room += invItem->item->getMaxStackSize() - invItem->quantity;
+}
+return room >= quantity;
+}
 bool InventoryComponent::isEmpty() const {
 for(const auto& item : m_items) {
 if(item) return false;
@@ -368,14 +385,14 @@ void InventoryComponent::onItemAdded(InventoryItem* item) {
 // TODO: Wyślij event o dodaniu przedmiotu
 if (m_owner) {
 InventoryChangedEvent event(m_owner);
-EVENT_BUS.send(event);
+EventBus::send(event);
 }
 }
 void InventoryComponent::onItemRemoved(InventoryItem* item) {
 // TODO: Wyślij event o usunięciu przedmiotu
 if (m_owner) {
 InventoryChangedEvent event(m_owner);
-EVENT_BUS.send(event);
+EventBus::send(event);
 }
 }
 void InventoryComponent::onCapacityExceeded(float used, float max) {
@@ -397,9 +414,8 @@ return quantity;
 int remaining = quantity;
 for (auto& invItem : m_items) {
     if (!invItem || !invItem->item) continue;
-    // Sprawdź czy można stackować (ta sama nazwa i typ)
-    if (invItem->item->getDisplayName() == item->getDisplayName() &&
-        invItem->item->getItemType() == item->getItemType()) {
+    // Sprawdź czy można stackować (ta sama definicja przedmiotu)
+    if (invItem->item->hasSameDefinition(*item)) {
         int maxStack = invItem->item->getMaxStackSize();
         int canAdd = maxStack - invItem->quantity;
         int toAdd = std::min(canAdd, remaining);
@@ -26,11 +26,11 @@ float getTotalWeight() const {
 float getTotalVolume() const {
     return item ? item->getVolume() * quantity : 0.0f;
 }
+// Ta sama definicja (flyweight) = ten sam typ i nazwa - porównanie wskaźników zamiast stringów
 bool canStackWith(const InventoryItem& other) const {
     if (!item || !other.item) return false;
-    if (!item->isStackable() || !other.item->isStackable()) return false;
-    return item->getItemType() == other.item->getItemType() &&
-           item->getDisplayName() == other.item->getDisplayName();
+    if (!item->isStackable()) return false;
+    return item->hasSameDefinition(*other.item);
 }
 };
 class InventoryComponent : public IComponent {
@@ -70,6 +70,8 @@ void dropItem(int slotIndex, int quantity = 1);
 std::unique_ptr<InventoryItem> extractItem(int slotIndex, int quantity = -1);
 size_t getItemCount() const;
 bool isFull() const;
+// Czy addItem przyjmie całość (wolny slot albo miejsce w istniejących stackach)
+bool canAdd(const Item& item, int quantity = 1) const;
 bool isEmpty() const;
 void clear();
 private:
@@ -102,7 +102,7 @@ BuildingInstance* NeedComponent::findNearestSocialSpot(const std::vector<Buildin
     Vector3 myPos = m_owner->getPosition();
 
     for (auto* b : buildings) {
-        if ((b->getBlueprintId() == "campfire" || b->getBlueprintId() == "taverna") && b->isBuilt()) {
+        if ((b->getBlueprintSid() == Ids::Campfire || b->getBlueprintSid() == Ids::Taverna) && b->isBuilt()) {
             float d = Vector3Distance(myPos, b->getPosition());
             if (d < minDist) {
                 minDist = d;
@@ -5,6 +5,7 @@
 #include <string>
 #include <typeindex>
 #include <utility> // For std::move
+#include "SystemAccess.h"
 
 // Basic Entity class with component management
 class Entity {
@@ -19,6 +20,7 @@ public:
 
     template<typename T>
     T* getComponent() {
+        SystemAccess::check<T>(SystemAccess::Mode::Read);
         auto it = m_components.find(std::type_index(typeid(T)));
         if (it != m_components.end()) {
             try {
@@ -33,6 +35,7 @@ public:
 
     template<typename T>
     const T* getComponent() const {
+        SystemAccess::check<T>(SystemAccess::Mode::Read);
         auto it = m_components.find(std::type_index(typeid(T)));
         if (it != m_components.end()) {
             try {
@@ -1,5 +1,181 @@
 #include "EventBus.h"
+#include <algorithm>
+#include <iostream>
 
-// Currently all logic is template-based in the header.
-// This file reserves space for non-template definitions if needed in the
-// future.
+std::atomic<uint64_t> EventBus::s_sequence{0};
+std::atomic<EventBus::HandlerId> EventBus::s_nextHandlerId{1};
+std::atomic<size_t> EventBus::s_maxEventsPerFrame{4096};
+
+namespace {
+// Stała tablica kanałów: odczyt bez blokady, zapis pod mutexem
+struct ChannelTable {
+  std::mutex writeMutex;
+  std::atomic<size_t> count{0};
+  void *slots[EventBus::MAX_EVENT_TYPES] = {};
+};
+
+ChannelTable &table() {
+  static ChannelTable instance;
+  return instance;
+}
+} // namespace
+
+void EventBus::registerChannel(IChannel *channel) {
+  ChannelTable &t = table();
+  std::lock_guard<std::mutex> lock(t.writeMutex);
+  size_t count = t.count.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < count; ++i) {
+    if (static_cast<IChannel *>(t.slots[i])->typeId == channel->typeId) {
+      std::cerr << "[EventBus] Event type id collision: "
+                << channel->typeId.value << std::endl;
+    }
+  }
+  if (count >= MAX_EVENT_TYPES) {
+    std::cerr << "[EventBus] Too many event types, queued events of type "
+              << channel->typeId.value << " will not be processed"
+              << std::endl;
+    return;
+  }
+  t.slots[count] = channel;
+  t.count.store(count + 1, std::memory_order_release);
+}
+
+size_t EventBus::channelCount() {
+  return table().count.load(std::memory_order_acquire);
+}
+
+EventBus::IChannel *EventBus::channelAt(size_t index) {
+  return static_cast<IChannel *>(table().slots[index]);
+}
+
+bool EventBus::unregisterHandler(HandlerId id) {
+  if (id == 0)
+    return false;
+  for (size_t i = 0, n = channelCount(); i < n; ++i) {
+    if (channelAt(i)->remove(id))
+      return true;
+  }
+  return false;
+}
+
+size_t EventBus::processEvents(size_t maxEvents) {
+  const size_t channels = channelCount();
+  for (size_t i = 0; i < channels; ++i)
+    channelAt(i)->beginDrain();
+
+  // Scalanie kolejek wszystkich typów: pasmo priorytetu malejąco, potem FIFO.
+  // Zdarzenia dodane w trakcie obsługi czekają do następnego wywołania.
+  size_t processed = 0;
+  while (maxEvents == 0 || processed < maxEvents) {
+    IChannel *best = nullptr;
+    int bestPriority = 0;
+    uint64_t bestSequence = 0;
+    for (size_t i = 0; i < channels; ++i) {
+      int priority;
+      uint64_t sequence;
+      IChannel *channel = channelAt(i);
+      if (!channel->head(priority, sequence))
+        continue;
+      if (!best || priority > bestPriority ||
+          (priority == bestPriority && sequence < bestSequence)) {
+        best = channel;
+        bestPriority = priority;
+        bestSequence = sequence;
+      }
+    }
+    if (!best)
+      return processed;
+    best->dispatchNext();
+    ++processed;
+  }
+
+  // Limit wyczerpany - reszta czeka na następną klatkę
+  for (size_t i = 0; i < channels; ++i)
+    channelAt(i)->noteCarriedOver();
+  return processed;
+}
+
+void EventBus::clearEventQueue() {
+  for (size_t i = 0, n = channelCount(); i < n; ++i)
+    channelAt(i)->clearQueue();
+}
+
+void EventBus::clearAllHandlers() {
+  for (size_t i = 0, n = channelCount(); i < n; ++i)
+    channelAt(i)->clearHandlers();
+}
+
+size_t EventBus::getQueueSize() {
+  size_t total = 0;
+  for (size_t i = 0, n = channelCount(); i < n; ++i)
+    total += channelAt(i)->queuedCount();
+  return total;
+}
+
+size_t EventBus::getTotalHandlersCount() {
+  size_t total = 0;
+  for (size_t i = 0, n = channelCount(); i < n; ++i)
+    total += channelAt(i)->handlerCount();
+  return total;
+}
+
+EventBus::QueueStats EventBus::getQueueStats() {
+  QueueStats total;
+  for (size_t i = 0, n = channelCount(); i < n; ++i) {
+    QueueStats stats = channelAt(i)->queueStats();
+    total.enqueued += stats.enqueued;
+    total.overflowed += stats.overflowed;
+    total.dispatched += stats.dispatched;
+    total.carriedOver += stats.carriedOver;
+    total.peakDepth = std::max(total.peakDepth, stats.peakDepth);
+    total.pending += stats.pending;
+  }
+  return total;
+}
+
+void EventBus::resetQueueStats() {
+  for (size_t i = 0, n = channelCount(); i < n; ++i)
+    channelAt(i)->resetQueueStats();
+}
+
+namespace {
+// "... [with E = ItemAddedToStorageEvent; ...]" / "signature<struct X>(void)"
+std::string typeNameFromSignature(std::string_view signature) {
+  size_t begin = signature.find("E = ");
+  if (begin != std::string_view::npos) {
+    begin += 4;
+    size_t end = signature.find_first_of(";]", begin);
+    return std::string(signature.substr(begin, end - begin));
+  }
+  begin = signature.find("signature<");
+  if (begin != std::string_view::npos) {
+    begin += 10;
+    size_t end = signature.rfind(">(");
+    std::string_view name = signature.substr(begin, end - begin);
+    for (std::string_view prefix : {"struct ", "class "}) {
+      if (name.substr(0, prefix.size()) == prefix)
+        name.remove_prefix(prefix.size());
+    }
+    return std::string(name);
+  }
+  return std::string(signature);
+}
+} // namespace
+
+std::vector<std::string> EventBus::describeQueues() {
+  std::vector<std::string> lines;
+  for (size_t i = 0, n = channelCount(); i < n; ++i) {
+    IChannel *channel = channelAt(i);
+    QueueStats stats = channel->queueStats();
+    if (stats.enqueued == 0 && stats.pending == 0)
+      continue;
+    lines.push_back(typeNameFromSignature(channel->signature) + ": " +
+                    std::to_string(stats.enqueued) + " queued, " +
+                    std::to_string(stats.dispatched) + " dispatched, " +
+                    std::to_string(stats.pending) + " pending, peak " +
+                    std::to_string(stats.peakDepth) + ", overflow " +
+                    std::to_string(stats.overflowed) + ", carried " +
+                    std::to_string(stats.carriedOver));
+  }
+  return lines;
+}
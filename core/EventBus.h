@@ -1,107 +1,395 @@
 #pragma once
 
+#include "MpscRing.h"
+#include "StringId.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
-#include <unordered_map>
-#include <typeindex>
-#include <memory>
-#include <algorithm>
-#include <iostream>
 
-// Base Event Interface
-struct IEvent {
-    virtual ~IEvent() = default;
+namespace EventTypes {
+// Sygnatura funkcji zawiera nazwę typu - hash liczony w czasie kompilacji
+template <typename E> constexpr std::string_view signature() {
+#if defined(_MSC_VER)
+  return __FUNCSIG__;
+#else
+  return __PRETTY_FUNCTION__;
+#endif
+}
+} // namespace EventTypes
+
+/**
+ * @brief Pojemność bufora kolejki odroczonej dla typu zdarzenia.
+ * Specjalizacja pozwala powiększyć bufor dla częstych zdarzeń.
+ */
+template <typename E> struct EventQueueTraits {
+  static constexpr size_t capacity = 1024;
 };
 
-// Event Bus System
-// Provides a decoupled way for systems to communicate.
+/**
+ * @brief Identyfikator typu zdarzenia znany w czasie kompilacji (bez RTTI).
+ */
+template <typename E>
+inline constexpr StringId EventTypeId = StringId::of(EventTypes::signature<E>());
+
+/**
+ * @brief Jedna, typowana szyna zdarzeń gry.
+ *
+ * Każdy typ zdarzenia ma własny kanał (Channel<E>) z ciągłą tablicą
+ * handlerów posortowaną po priorytecie i własną kolejką odroczonych
+ * zdarzeń. send() wywołuje handlery bezpośrednio z referencją na
+ * zdarzenie - bez std::any, bez kopiowania i bez blokad.
+ *
+ * queue() można wołać z dowolnego wątku (np. z fazy Think osadników):
+ * zdarzenie trafia do bufora MPSC kanału bez blokad. Gdy bufor jest
+ * pełny, zdarzenie idzie wolną ścieżką pod mutexem i liczy się jako
+ * przepełnienie - nic nie ginie. processEvents() woła wątek główny.
+ *
+ * Rejestracja/wyrejestrowanie handlerów tylko z wątku głównego. Handler
+ * może bezpiecznie (wy)rejestrować handlery w trakcie dispatchu - zmiany
+ * są stosowane po zakończeniu bieżącego send().
+ */
 class EventBus {
 public:
-    using ListenerID = int;
+  using HandlerId = uint32_t;
+  template <typename E> using Handler = std::function<void(const E &)>;
+
+  // Maksymalna liczba typów zdarzeń z kolejką (stała tablica kanałów)
+  static constexpr size_t MAX_EVENT_TYPES = 128;
+
+  /**
+   * @brief Statystyki kolejek odroczonych (suma lub pojedynczy kanał)
+   */
+  struct QueueStats {
+    uint64_t enqueued = 0;    // wszystkie queue()
+    uint64_t overflowed = 0;  // bufor pełny -> wolna ścieżka pod mutexem
+    uint64_t dispatched = 0;  // obsłużone w processEvents()
+    uint64_t carriedOver = 0; // odłożone na kolejną klatkę przez limit
+    size_t peakDepth = 0;     // najwięcej zdarzeń czekających w jednym drenażu
+    size_t pending = 0;       // aktualnie czekające
+  };
+
+  template <typename E>
+  static HandlerId registerHandler(Handler<E> handler,
+                                   const std::string &systemName,
+                                   int priority = 0) {
+    return Channel<E>::instance().add(std::move(handler), systemName, priority);
+  }
+
+  static bool unregisterHandler(HandlerId id);
+
+  // Natychmiastowe wywołanie handlerów
+  template <typename E> static void send(const E &event) {
+    Channel<E>::instance().dispatch(event);
+  }
+
+  // Odroczenie do processEvents() (wyższy priorytet = wcześniej, potem FIFO)
+  template <typename E> static void queue(const E &event, int priority = 0) {
+    Channel<E>::instance().enqueue(event, priority);
+  }
+
+  // Zwraca liczbę obsłużonych zdarzeń; 0 = bez limitu
+  static size_t processEvents(size_t maxEvents = 0);
+  static void clearEventQueue();
+  static void clearAllHandlers();
+  static size_t getQueueSize();
+  static size_t getTotalHandlersCount();
+
+  // Limit zdarzeń obsługiwanych na klatkę w GameEngine::update (0 = brak)
+  static void setMaxEventsPerFrame(size_t maxEvents) {
+    s_maxEventsPerFrame.store(maxEvents, std::memory_order_relaxed);
+  }
+  static size_t getMaxEventsPerFrame() {
+    return s_maxEventsPerFrame.load(std::memory_order_relaxed);
+  }
+
+  static QueueStats getQueueStats();
+  static void resetQueueStats();
+  // Jedna linia na typ zdarzenia, który był kolejkowany (konsola/headless)
+  static std::vector<std::string> describeQueues();
 
-    static EventBus& GetInstance() {
-        static EventBus instance;
-        return instance;
+private:
+  struct IChannel {
+    IChannel(StringId type, std::string_view signature)
+        : typeId(type), signature(signature) {}
+    virtual ~IChannel() = default;
+    virtual bool remove(HandlerId id) = 0;
+    virtual void clearHandlers() = 0;
+    virtual size_t handlerCount() const = 0;
+
+    // Kolejka odroczona: beginDrain przenosi nowe zdarzenia do bufora
+    // roboczego, head/dispatchNext zdejmują je w kolejności
+    virtual void beginDrain() = 0;
+    virtual bool head(int &priority, uint64_t &sequence) const = 0;
+    virtual void dispatchNext() = 0;
+    virtual void clearQueue() = 0;
+    virtual size_t queuedCount() const = 0;
+    virtual QueueStats queueStats() const = 0;
+    virtual void resetQueueStats() = 0;
+    // Wołane przez processEvents po wyczerpaniu limitu klatki
+    virtual void noteCarriedOver() = 0;
+
+    const StringId typeId;
+    const std::string_view signature; // do wyciągnięcia nazwy typu w logach
+  };
+
+  static void registerChannel(IChannel *channel);
+  static size_t channelCount();
+  static IChannel *channelAt(size_t index);
+  static uint64_t nextSequence() {
+    return s_sequence.fetch_add(1, std::memory_order_relaxed);
+  }
+  static HandlerId nextHandlerId() {
+    return s_nextHandlerId.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  template <typename E> class Channel final : public IChannel {
+  public:
+    static Channel &instance() {
+      static Channel channel;
+      return channel;
     }
 
-    // Subscribe to a specific event type T
-    template<typename T>
-    ListenerID Subscribe(std::function<void(const T&)> callback) {
-        std::type_index typeIdx = std::type_index(typeid(T));
-        
-        // Ensure vector exists
-        if (listeners.find(typeIdx) == listeners.end()) {
-            listeners[typeIdx] = std::make_unique<HandlerList>();
-        }
+    HandlerId add(Handler<E> handler, const std::string &systemName,
+                  int priority) {
+      Entry entry{nextHandlerId(), priority, std::move(handler), systemName};
+      HandlerId id = entry.id;
+      if (m_dispatchDepth.load(std::memory_order_relaxed) > 0) {
+        m_pendingAdd.push_back(std::move(entry));
+      } else {
+        insertSorted(std::move(entry));
+      }
+      return id;
+    }
 
-        auto* handlers = static_cast<TypedHandlerList<T>*>(listeners[typeIdx].get());
-        if (!handlers) {
-            // Should not happen if logic is correct, but for safety re-create
-            listeners[typeIdx] = std::make_unique<TypedHandlerList<T>>();
-            handlers = static_cast<TypedHandlerList<T>*>(listeners[typeIdx].get());
+    void dispatch(const E &event) {
+      m_dispatchDepth.fetch_add(1, std::memory_order_relaxed);
+      // Rozmiar ustalony przed pętlą - rejestracje w trakcie idą do pending
+      const size_t count = m_handlers.size();
+      for (size_t i = 0; i < count; ++i) {
+        const Entry &entry = m_handlers[i];
+        if (entry.id == 0)
+          continue; // wyrejestrowany w trakcie dispatchu
+        try {
+          entry.handler(event);
+        } catch (...) {
+          // Wyjątek w handlerze nie przerywa pozostałych
         }
+      }
+      if (m_dispatchDepth.fetch_sub(1, std::memory_order_relaxed) == 1)
+        applyPending();
+    }
 
-        int id = nextListenerId++;
-        handlers->callbacks.push_back({id, callback});
-        return id;
-    }
-
-    // Publish an event of type T to all subscribers
-    template<typename T>
-    void Publish(const T& event) {
-        std::type_index typeIdx = std::type_index(typeid(T));
-        
-        if (listeners.find(typeIdx) != listeners.end()) {
-            auto* handlers = static_cast<TypedHandlerList<T>*>(listeners[typeIdx].get());
-            if (handlers) {
-                for (const auto& entry : handlers->callbacks) {
-                    entry.callback(event);
-                }
-            }
-        }
+    void enqueue(const E &event, int priority) {
+      m_enqueued.fetch_add(1, std::memory_order_relaxed);
+      Queued queued{event, priority, nextSequence()};
+      if (m_ring.tryPush(std::move(queued)))
+        return;
+      // Backpressure: konsument nie nadąża - zdarzenie czeka w overflow
+      m_overflowed.fetch_add(1, std::memory_order_relaxed);
+      std::lock_guard<std::mutex> lock(m_overflowMutex);
+      m_overflow.push_back(std::move(queued));
+      m_hasOverflow.store(true, std::memory_order_release);
     }
 
-    // Unsubscribe (Optional, simpler implementation for now just ignores ID or we can add it later)
-    // For Phase 2 prototype, we might skip full unsubscribe logic to keep it simple, 
-    // but a proper system needs it. Let's add partial support.
-    template<typename T>
-    void Unsubscribe(ListenerID id) {
-        std::type_index typeIdx = std::type_index(typeid(T));
-        if (listeners.find(typeIdx) != listeners.end()) {
-            auto* handlers = static_cast<TypedHandlerList<T>*>(listeners[typeIdx].get());
-            if (handlers) {
-                auto& vec = handlers->callbacks;
-                vec.erase(std::remove_if(vec.begin(), vec.end(), 
-                    [id](const auto& entry){ return entry.id == id; }), vec.end());
-            }
+    bool remove(HandlerId id) override {
+      for (auto &entry : m_handlers) {
+        if (entry.id != id)
+          continue;
+        if (m_dispatchDepth.load(std::memory_order_relaxed) > 0) {
+          entry.id = 0;
+          m_hasDead = true;
+        } else {
+          m_handlers.erase(
+              m_handlers.begin() + (&entry - m_handlers.data()));
         }
+        return true;
+      }
+      auto pending = std::find_if(m_pendingAdd.begin(), m_pendingAdd.end(),
+                                  [id](const Entry &e) { return e.id == id; });
+      if (pending != m_pendingAdd.end()) {
+        m_pendingAdd.erase(pending);
+        return true;
+      }
+      return false;
     }
 
-    // Clear all listeners (e.g. on shutdown)
-    void Reset() {
-        listeners.clear();
-        nextListenerId = 0;
+    void clearHandlers() override {
+      m_pendingAdd.clear();
+      if (m_dispatchDepth.load(std::memory_order_relaxed) > 0) {
+        for (auto &entry : m_handlers)
+          entry.id = 0;
+        m_hasDead = true;
+      } else {
+        m_handlers.clear();
+      }
     }
 
-private:
-    EventBus() = default;
-    ~EventBus() = default;
-    EventBus(const EventBus&) = delete;
-    EventBus& operator=(const EventBus&) = delete;
+    size_t handlerCount() const override {
+      size_t count = m_pendingAdd.size();
+      for (const auto &entry : m_handlers)
+        count += entry.id != 0 ? 1 : 0;
+      return count;
+    }
+
+    void beginDrain() override {
+      if (m_drainPos > 0) {
+        // Resztki po limicie z poprzedniej klatki przesuwamy na początek
+        m_draining.erase(m_draining.begin(), m_draining.begin() + m_drainPos);
+        m_drainPos = 0;
+      }
+      const size_t leftover = m_draining.size();
+      m_ring.drain([this](Queued &&queued) {
+        m_draining.push_back(std::move(queued));
+      });
+      if (m_hasOverflow.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(m_overflowMutex);
+        m_draining.insert(m_draining.end(),
+                          std::make_move_iterator(m_overflow.begin()),
+                          std::make_move_iterator(m_overflow.end()));
+        m_overflow.clear();
+        m_hasOverflow.store(false, std::memory_order_relaxed);
+      }
+      if (m_draining.size() == leftover)
+        return;
+      m_peakDepth = std::max(m_peakDepth, m_draining.size());
+      // Producenci wpisują się równolegle, więc kolejność w buforze nie
+      // musi być FIFO - porządkuje ją globalny numer sekwencji
+      std::sort(m_draining.begin(), m_draining.end(),
+                [](const Queued &a, const Queued &b) {
+                  if (a.priority != b.priority)
+                    return a.priority > b.priority;
+                  return a.sequence < b.sequence;
+                });
+    }
+
+    bool head(int &priority, uint64_t &sequence) const override {
+      if (m_drainPos >= m_draining.size())
+        return false;
+      priority = m_draining[m_drainPos].priority;
+      sequence = m_draining[m_drainPos].sequence;
+      return true;
+    }
+
+    void dispatchNext() override {
+      // Indeks przesuwamy przed wywołaniem - handler może kolejkować dalej
+      const size_t index = m_drainPos++;
+      ++m_dispatched;
+      dispatch(m_draining[index].event);
+      if (m_drainPos >= m_draining.size()) {
+        m_draining.clear();
+        m_drainPos = 0;
+      }
+    }
+
+    void clearQueue() override {
+      m_ring.drain([](Queued &&) {});
+      std::lock_guard<std::mutex> lock(m_overflowMutex);
+      m_overflow.clear();
+      m_hasOverflow.store(false, std::memory_order_relaxed);
+      m_draining.clear();
+      m_drainPos = 0;
+    }
+
+    size_t queuedCount() const override {
+      std::lock_guard<std::mutex> lock(m_overflowMutex);
+      return m_ring.size() + m_overflow.size() +
+             (m_draining.size() - m_drainPos);
+    }
+
+    QueueStats queueStats() const override {
+      QueueStats stats;
+      stats.enqueued = m_enqueued.load(std::memory_order_relaxed);
+      stats.overflowed = m_overflowed.load(std::memory_order_relaxed);
+      stats.dispatched = m_dispatched;
+      stats.carriedOver = m_carriedOver;
+      stats.peakDepth = m_peakDepth;
+      stats.pending = queuedCount();
+      return stats;
+    }
+
+    void resetQueueStats() override {
+      m_enqueued.store(0, std::memory_order_relaxed);
+      m_overflowed.store(0, std::memory_order_relaxed);
+      m_dispatched = 0;
+      m_carriedOver = 0;
+      m_peakDepth = 0;
+    }
 
-    struct IHandlerList {
-        virtual ~IHandlerList() = default;
+    void noteCarriedOver() override {
+      m_carriedOver += m_draining.size() - m_drainPos;
+    }
+
+  private:
+    struct Entry {
+      HandlerId id; // 0 = wyrejestrowany, czeka na kompaktowanie
+      int priority;
+      Handler<E> handler;
+      std::string systemName;
     };
 
-    template<typename T>
-    struct TypedHandlerList : IHandlerList {
-        struct Entry {
-            ListenerID id;
-            std::function<void(const T&)> callback;
-        };
-        std::vector<Entry> callbacks;
+    struct Queued {
+      E event;
+      int priority;
+      uint64_t sequence;
     };
 
-    std::unordered_map<std::type_index, std::unique_ptr<IHandlerList>> listeners;
-    ListenerID nextListenerId = 0;
+    Channel()
+        : IChannel(EventTypeId<E>, EventTypes::signature<E>()),
+          m_ring(EventQueueTraits<E>::capacity) {
+      registerChannel(this);
+    }
+
+    // Wstawienie za ostatni handler o tym samym priorytecie (stabilnie)
+    void insertSorted(Entry entry) {
+      auto pos = std::upper_bound(
+          m_handlers.begin(), m_handlers.end(), entry.priority,
+          [](int priority, const Entry &e) { return priority > e.priority; });
+      m_handlers.insert(pos, std::move(entry));
+    }
+
+    void applyPending() {
+      if (m_hasDead) {
+        m_handlers.erase(std::remove_if(m_handlers.begin(), m_handlers.end(),
+                                        [](const Entry &e) { return e.id == 0; }),
+                         m_handlers.end());
+        m_hasDead = false;
+      }
+      if (!m_pendingAdd.empty()) {
+        for (auto &entry : m_pendingAdd)
+          insertSorted(std::move(entry));
+        m_pendingAdd.clear();
+      }
+    }
+
+    std::vector<Entry> m_handlers; // posortowane malejąco po priorytecie
+    std::vector<Entry> m_pendingAdd;
+    std::atomic<int> m_dispatchDepth{0};
+    bool m_hasDead = false;
+
+    MpscRing<Queued> m_ring;
+    mutable std::mutex m_overflowMutex;
+    std::vector<Queued> m_overflow;
+    std::atomic<bool> m_hasOverflow{false};
+
+    // Bufor roboczy konsumenta (pojemność reużywana między klatkami)
+    std::vector<Queued> m_draining;
+    size_t m_drainPos = 0;
+
+    std::atomic<uint64_t> m_enqueued{0};
+    std::atomic<uint64_t> m_overflowed{0};
+    uint64_t m_dispatched = 0;
+    uint64_t m_carriedOver = 0;
+    size_t m_peakDepth = 0;
+  };
+
+  static std::atomic<uint64_t> s_sequence;
+  static std::atomic<HandlerId> s_nextHandlerId;
+  static std::atomic<size_t> s_maxEventsPerFrame;
 };
@@ -1,6 +1,5 @@
 #pragma once
-#include "EventSystem.h" // Use existing EventSystem
-#include <any>
+#include "EventBus.h"
 #include <iostream>
 #include <string>
 
@@ -17,15 +16,9 @@ public:
   void Initialize() {
     // Subscribe to TestEvent
     EventBus::registerHandler<TestEvent>(
-        [](const std::any &e) {
-          try {
-            const auto &ev = std::any_cast<const TestEvent &>(e);
-            std::cout << "[EventBusValidator] RECEIVED: " << ev.message
-                      << std::endl;
-          } catch (const std::bad_any_cast &err) {
-            std::cerr << "[EventBusValidator] ERROR: Bad cast: " << err.what()
-                      << std::endl;
-          }
+        [](const TestEvent &ev) {
+          std::cout << "[EventBusValidator] RECEIVED: " << ev.message
+                    << std::endl;
         },
         "EventBusValidator");
   }
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <algorithm>
+
+/**
+ * @brief Akumulator stałego kroku symulacji.
+ *
+ * Czas klatki (przemnożony przez skalę czasu gry) trafia do akumulatora,
+ * a symulacja wykonuje tyle ticków o stałym kroku, ile się w nim mieści.
+ * Przyspieszenie x10 oznacza więc 10x więcej ticków, a nie 10x dłuższy krok.
+ *
+ * Reszta akumulatora (alpha = reszta / krok) służy do interpolacji pozycji
+ * przy renderowaniu między poprzednim a bieżącym stanem symulacji.
+ *
+ * Użycie:
+ *   int ticks = timestep.advance(GetFrameTime(), timeScale);
+ *   for (int i = 0; i < ticks; ++i) simulate(timestep.getStep());
+ */
+class FixedTimestep {
+public:
+  static constexpr float DEFAULT_STEP = 1.0f / 60.0f;
+  static constexpr int DEFAULT_MAX_TICKS = 40; // 10x przy 15 FPS
+
+  explicit FixedTimestep(float step = DEFAULT_STEP,
+                         int maxTicksPerFrame = DEFAULT_MAX_TICKS)
+      : m_step(step), m_maxTicks(std::max(maxTicksPerFrame, 1)) {}
+
+  /**
+   * @brief Dodaje czas klatki i zwraca liczbę ticków do wykonania.
+   *
+   * Jeśli symulacja nie nadąża (więcej niż maxTicksPerFrame ticków),
+   * nadmiar czasu jest odrzucany zamiast narastać w kolejnych klatkach.
+   */
+  int advance(float frameTime, float timeScale) {
+    // Długie przerwy (breakpoint, przeciąganie okna) nie powinny nadrabiać
+    frameTime = std::min(frameTime, MAX_FRAME_TIME);
+    m_accumulator += frameTime * std::max(timeScale, 0.0f);
+
+    int ticks = static_cast<int>(m_accumulator / m_step);
+    if (ticks > m_maxTicks) {
+      m_droppedTime += (ticks - m_maxTicks) * m_step;
+      ticks = m_maxTicks;
+      m_accumulator -= ticks * m_step;
+      // Zostaw najwyżej jeden krok, żeby alpha pozostała w [0, 1)
+      m_accumulator = std::min(m_accumulator, m_step * 0.999f);
+    } else {
+      m_accumulator -= ticks * m_step;
+    }
+
+    m_lastTicks = ticks;
+    s_renderAlpha = getAlpha();
+    return ticks;
+  }
+
+  float getStep() const { return m_step; }
+  int getMaxTicksPerFrame() const { return m_maxTicks; }
+  void setMaxTicksPerFrame(int ticks) { m_maxTicks = std::max(ticks, 1); }
+
+  /** Ułamek kroku pozostały w akumulatorze, [0, 1) */
+  float getAlpha() const { return m_accumulator / m_step; }
+  int getLastTicks() const { return m_lastTicks; }
+  /** Łączny czas gry odrzucony przez limit nadrabiania */
+  float getDroppedTime() const { return m_droppedTime; }
+
+  /**
+   * @brief Alpha interpolacji z ostatniej klatki - dla kodu renderującego,
+   * który nie ma dostępu do pętli głównej (Settler, Animal, Projectile).
+   */
+  static float getRenderAlpha() { return s_renderAlpha; }
+
+private:
+  static constexpr float MAX_FRAME_TIME = 0.25f;
+
+  float m_step;
+  int m_maxTicks;
+  float m_accumulator = 0.0f;
+  float m_droppedTime = 0.0f;
+  int m_lastTicks = 0;
+
+  inline static float s_renderAlpha = 1.0f;
+};
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+/**
+ * @brief Liniowy alokator (bump allocator) dla danych żyjących jedną klatkę.
+ *
+ * Tymczasowe kontenery tworzone w pętli gry (wyniki zapytań o budynki,
+ * listy sąsiadów A*, opcje decyzji AI) nie trafiają do globalnego heapu,
+ * tylko do areny, którą resetujemy raz na tick w main.cpp.
+ *
+ * Każdy wątek ma własną arenę (FrameArena::forThread()), więc alokacja
+ * nie wymaga synchronizacji. Dane z areny NIE mogą przeżyć klatki.
+ */
+class FrameArena {
+public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 256 * 1024;
+
+    explicit FrameArena(size_t blockSize = DEFAULT_BLOCK_SIZE)
+        : m_blockSize(blockSize) {
+        registerArena(this);
+    }
+
+    ~FrameArena() { unregisterArena(this); }
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    // Arena bieżącego wątku (tworzona leniwie)
+    static FrameArena& forThread() {
+        thread_local FrameArena arena;
+        return arena;
+    }
+
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+        if (size == 0) size = 1;
+
+        if (!m_blocks.empty()) {
+            Block& block = m_blocks[m_currentBlock];
+            size_t offset = alignUp(block.used, alignment);
+            if (offset + size <= block.size) {
+                block.used = offset + size;
+                m_bytesUsed += size;
+                return block.data.get() + offset;
+            }
+            // Spróbuj kolejnego, wcześniej zaalokowanego bloku
+            while (m_currentBlock + 1 < m_blocks.size()) {
+                Block& next = m_blocks[++m_currentBlock];
+                next.used = 0;
+                if (size + alignment <= next.size) {
+                    return allocate(size, alignment);
+                }
+            }
+        }
+
+        // Brak miejsca - nowy blok (duże alokacje dostają własny blok)
+        size_t newSize = std::max(m_blockSize, size + alignment);
+        m_blocks.push_back(Block{std::unique_ptr<uint8_t[]>(new uint8_t[newSize]), newSize, 0});
+        m_currentBlock = m_blocks.size() - 1;
+        m_overflowThisFrame = m_blocks.size() > 1;
+        return allocate(size, alignment);
+    }
+
+    // Dealokacja pojedynczych obiektów jest no-op - pamięć wraca przy reset()
+    void deallocate(void*, size_t) {}
+
+    /**
+     * @brief Zwalnia wszystko na raz. Wołane raz na tick.
+     *
+     * Jeśli w tej klatce zabrakło jednego bloku, bloki są scalane w jeden
+     * większy, żeby w kolejnych klatkach arena nie fragmentowała się.
+     */
+    void reset() {
+        m_lastFrameBytes = m_bytesUsed;
+        m_peakBytes = std::max(m_peakBytes, m_bytesUsed);
+
+        if (m_overflowThisFrame) {
+            size_t total = 0;
+            for (const auto& b : m_blocks) total += b.size;
+            m_blocks.clear();
+            m_blocks.push_back(Block{std::unique_ptr<uint8_t[]>(new uint8_t[total]), total, 0});
+            m_overflowThisFrame = false;
+        }
+        for (auto& b : m_blocks) b.used = 0;
+        m_currentBlock = 0;
+        m_bytesUsed = 0;
+    }
+
+    size_t getBytesUsed() const { return m_bytesUsed; }
+    size_t getLastFrameBytes() const { return m_lastFrameBytes; }
+    size_t getPeakBytes() const { return m_peakBytes; }
+    size_t getCapacity() const {
+        size_t total = 0;
+        for (const auto& b : m_blocks) total += b.size;
+        return total;
+    }
+
+    struct Stats {
+        size_t arenaCount = 0;
+        size_t lastFrameBytes = 0;
+        size_t peakBytes = 0;
+        size_t capacity = 0;
+    };
+
+    // Reset wszystkich aren (koniec ticka, wątki robocze muszą być bezczynne)
+    static void resetAll() {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        for (FrameArena* arena : registry()) arena->reset();
+    }
+
+    static Stats getStats() {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        Stats stats;
+        for (const FrameArena* arena : registry()) {
+            stats.arenaCount++;
+            stats.lastFrameBytes += arena->m_lastFrameBytes;
+            stats.peakBytes += arena->m_peakBytes;
+            stats.capacity += arena->getCapacity();
+        }
+        return stats;
+    }
+
+private:
+    struct Block {
+        std::unique_ptr<uint8_t[]> data;
+        size_t size;
+        size_t used;
+    };
+
+    static size_t alignUp(size_t value, size_t alignment) {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    static std::vector<FrameArena*>& registry() {
+        static std::vector<FrameArena*> arenas;
+        return arenas;
+    }
+
+    static std::mutex& registryMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static void registerArena(FrameArena* arena) {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        registry().push_back(arena);
+    }
+
+    static void unregisterArena(FrameArena* arena) {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        auto& arenas = registry();
+        arenas.erase(std::remove(arenas.begin(), arenas.end(), arena), arenas.end());
+    }
+
+    std::vector<Block> m_blocks;
+    size_t m_currentBlock = 0;
+    size_t m_blockSize;
+    size_t m_bytesUsed = 0;
+    size_t m_lastFrameBytes = 0;
+    size_t m_peakBytes = 0;
+    bool m_overflowThisFrame = false;
+};
+
+/**
+ * @brief Adapter STL nad FrameArena bieżącego wątku.
+ *
+ * Użycie: FrameVector<BuildingInstance*> out; - kontener alokuje z areny,
+ * a jego destruktor niczego nie zwalnia.
+ */
+template <typename T>
+class FrameAllocator {
+public:
+    using value_type = T;
+
+    FrameAllocator() noexcept : m_arena(&FrameArena::forThread()) {}
+    explicit FrameAllocator(FrameArena& arena) noexcept : m_arena(&arena) {}
+
+    template <typename U>
+    FrameAllocator(const FrameAllocator<U>& other) noexcept : m_arena(other.arena()) {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept { m_arena->deallocate(p, n * sizeof(T)); }
+
+    FrameArena* arena() const noexcept { return m_arena; }
+
+    template <typename U>
+    bool operator==(const FrameAllocator<U>& other) const noexcept { return m_arena == other.arena(); }
+    template <typename U>
+    bool operator!=(const FrameAllocator<U>& other) const noexcept { return m_arena != other.arena(); }
+
+private:
+    FrameArena* m_arena;
+};
+
+template <typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <raylib.h>
+#include <raymath.h>
+
+/**
+ * @brief Bryła widzenia kamery jako 6 płaszczyzn (normalne do środka).
+ *
+ * Liczona z samej macierzy widok*rzut - bez kontekstu GPU, więc działa
+ * też w trybie headless. Parametry rzutu są takie jak w BeginMode3D.
+ */
+struct Frustum {
+  enum class Result { Outside, Intersects, Inside };
+
+  struct Plane {
+    Vector3 normal;
+    float distance;
+
+    float signedDistance(Vector3 point) const {
+      return Vector3DotProduct(normal, point) + distance;
+    }
+  };
+
+  Plane planes[6]; // left, right, bottom, top, near, far
+
+  static Frustum FromMatrix(const Matrix &viewProjection) {
+    // Gribb-Hartmann: wiersze macierzy przekształcenia punktu do clip space
+    const Matrix &m = viewProjection;
+    const float rows[4][4] = {{m.m0, m.m4, m.m8, m.m12},
+                              {m.m1, m.m5, m.m9, m.m13},
+                              {m.m2, m.m6, m.m10, m.m14},
+                              {m.m3, m.m7, m.m11, m.m15}};
+    Frustum frustum;
+    for (int i = 0; i < 6; ++i) {
+      const float *axis = rows[i / 2];
+      float sign = (i % 2 == 0) ? 1.0f : -1.0f;
+      Vector3 normal = {rows[3][0] + sign * axis[0],
+                        rows[3][1] + sign * axis[1],
+                        rows[3][2] + sign * axis[2]};
+      float distance = rows[3][3] + sign * axis[3];
+      float length = Vector3Length(normal);
+      if (length > 0.0f) {
+        normal = Vector3Scale(normal, 1.0f / length);
+        distance /= length;
+      }
+      frustum.planes[i] = Plane{normal, distance};
+    }
+    return frustum;
+  }
+
+  static Frustum FromCamera(const Camera3D &camera, float aspect,
+                            float nearPlane, float farPlane) {
+    Matrix view = MatrixLookAt(camera.position, camera.target, camera.up);
+    Matrix projection;
+    if (camera.projection == CAMERA_ORTHOGRAPHIC) {
+      double top = camera.fovy / 2.0;
+      double right = top * aspect;
+      projection = MatrixOrtho(-right, right, -top, top, nearPlane, farPlane);
+    } else {
+      float fovy = camera.fovy > 0.0f ? camera.fovy : 45.0f;
+      projection =
+          MatrixPerspective(fovy * DEG2RAD, aspect, nearPlane, farPlane);
+    }
+    return FromMatrix(MatrixMultiply(view, projection));
+  }
+
+  Result classify(const BoundingBox &box) const {
+    Result result = Result::Inside;
+    for (const Plane &plane : planes) {
+      // Wierzchołek najdalej wzdłuż normalnej (p) i najbliżej (n)
+      Vector3 positive = {plane.normal.x >= 0.0f ? box.max.x : box.min.x,
+                          plane.normal.y >= 0.0f ? box.max.y : box.min.y,
+                          plane.normal.z >= 0.0f ? box.max.z : box.min.z};
+      if (plane.signedDistance(positive) < 0.0f)
+        return Result::Outside;
+      Vector3 negative = {plane.normal.x >= 0.0f ? box.min.x : box.max.x,
+                          plane.normal.y >= 0.0f ? box.min.y : box.max.y,
+                          plane.normal.z >= 0.0f ? box.min.z : box.max.z};
+      if (plane.signedDistance(negative) < 0.0f)
+        result = Result::Intersects;
+    }
+    return result;
+  }
+
+  bool intersects(const BoundingBox &box) const {
+    return classify(box) != Result::Outside;
+  }
+};
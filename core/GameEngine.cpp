@@ -1,7 +1,13 @@
 #include "GameEngine.h"
 #include "IGameSystem.h"
-#include "EventSystem.h"
+#include "EventBus.h"
+#include "JobSystem.h"
+#include "Profiler.h"
 #include <algorithm>
+#include <chrono>
+#include <exception>
+#include <mutex>
+#include <thread>
 
 // Define the static callback
 GameEngine::DropItemCallback GameEngine::dropItemCallback = nullptr;
@@ -18,16 +24,205 @@ void GameEngine::initialize() {
 }
 
 void GameEngine::update(float deltaTime) {
-    eventSystem->processEvents();
+    PROFILE_ZONE("GameEngine::update");
+    {
+        PROFILE_ZONE("EventBus::processEvents");
+        EventBus::processEvents(EventBus::getMaxEventsPerFrame());
+    }
 
-    for (auto& system : systems) {
-        system->update(deltaTime);
+    if (m_systemTimingEnabled && m_systemTimings.size() != systems.size()) {
+        resetSystemTimings();
+    }
+    if (m_scheduleDirty) {
+        buildSchedule();
+    }
+
+    // Bez wątków roboczych graf nic nie daje - kolejność priorytetów
+    if (!m_parallelSystems || JobSystem::getInstance().getWorkerCount() == 0) {
+        for (size_t i = 0; i < systems.size(); ++i) {
+            runSystem(i, deltaTime);
+        }
+        return;
+    }
+    runSchedule(deltaTime);
+}
+
+void GameEngine::buildSchedule() {
+    m_schedule.clear();
+    m_schedule.resize(systems.size());
+    for (size_t i = 0; i < systems.size(); ++i) {
+        ScheduleNode& node = m_schedule[i];
+        IGameSystem& system = *systems[i];
+        node.name = system.getName();
+        node.updateZone = Profiler::intern(node.name + "::update");
+        node.renderZone = Profiler::intern(node.name + "::render");
+        system.declareAccess(node.access);
+        if (node.access.isDeclared()) {
+            node.access.setOwner(typeid(system));
+        }
+    }
+
+    // Konflikt -> system o niższym priorytecie czeka, jak przy wykonaniu
+    // szeregowym, więc wynik nie zależy od liczby wątków
+    for (size_t j = 0; j < m_schedule.size(); ++j) {
+        for (size_t i = 0; i < j; ++i) {
+            if (m_schedule[i].access.conflictsWith(m_schedule[j].access)) {
+                m_schedule[i].successors.push_back(j);
+                m_schedule[j].dependencyCount++;
+            }
+        }
+    }
+
+    m_pendingDependencies = std::make_unique<std::atomic<int>[]>(m_schedule.size());
+    m_scheduleDirty = false;
+}
+
+void GameEngine::runSchedule(float deltaTime) {
+    JobSystem& jobs = JobSystem::getInstance();
+    for (size_t i = 0; i < m_schedule.size(); ++i) {
+        m_pendingDependencies[i].store(m_schedule[i].dependencyCount);
+    }
+
+    std::atomic<int> remaining{static_cast<int>(m_schedule.size())};
+    std::atomic<int> jobCounter{0};
+    std::mutex mainMutex;
+    std::vector<size_t> mainReady; // gotowe systemy z wymogiem wątku głównego
+
+    std::function<void(size_t)> launch;
+    auto finish = [&](size_t index) {
+        for (size_t next : m_schedule[index].successors) {
+            if (m_pendingDependencies[next].fetch_sub(1) == 1) {
+                launch(next);
+            }
+        }
+        remaining.fetch_sub(1);
+    };
+    launch = [&](size_t index) {
+        const SystemAccess& access = m_schedule[index].access;
+        // Niezadeklarowane mogą wołać raylib - zostają na wątku głównym
+        if (access.needsMainThread() || !access.isDeclared()) {
+            std::lock_guard<std::mutex> lock(mainMutex);
+            mainReady.push_back(index);
+            return;
+        }
+        jobs.submit([&, index]() {
+            // Następniki i licznik "remaining" muszą ruszyć także po wyjątku,
+            // inaczej pętla poniżej nie wyjdzie; wyjątek rzuci wait()
+            try {
+                runSystem(index, deltaTime);
+            } catch (...) {
+                finish(index);
+                throw;
+            }
+            finish(index);
+        }, &jobCounter);
+    };
+
+    for (size_t i = 0; i < m_schedule.size(); ++i) {
+        if (m_schedule[i].dependencyCount == 0) {
+            launch(i);
+        }
+    }
+
+    // Wątek główny wykonuje swoje systemy, a w przerwach pomaga puli.
+    // Wyjątek systemu głównego czeka do końca klatki - zadania trzymają
+    // referencje do zmiennych lokalnych
+    std::exception_ptr mainError;
+    while (remaining.load() > 0) {
+        size_t index = 0;
+        bool haveMain = false;
+        {
+            std::lock_guard<std::mutex> lock(mainMutex);
+            if (!mainReady.empty()) {
+                index = mainReady.back();
+                mainReady.pop_back();
+                haveMain = true;
+            }
+        }
+        if (haveMain) {
+            try {
+                runSystem(index, deltaTime);
+            } catch (...) {
+                if (!mainError)
+                    mainError = std::current_exception();
+            }
+            finish(index);
+        } else if (!jobs.runPendingJob()) {
+            std::this_thread::yield();
+        }
+    }
+    // Ostatnie zadanie mogło jeszcze nie wyjść z lambdy (zmienne lokalne)
+    jobs.wait(jobCounter);
+    if (mainError)
+        std::rethrow_exception(mainError);
+}
+
+void GameEngine::runSystem(size_t index, float deltaTime) {
+    const ScheduleNode& node = m_schedule[index];
+    PROFILE_ZONE(node.updateZone);
+    bool checkAccess = SystemAccess::isCheckEnabled() && node.access.isDeclared();
+    if (checkAccess) {
+        SystemAccess::setCurrent(&node.access, &node.name);
+    }
+
+    if (!m_systemTimingEnabled) {
+        systems[index]->update(deltaTime);
+    } else {
+        auto start = std::chrono::steady_clock::now();
+        systems[index]->update(deltaTime);
+        double ms = std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - start).count();
+
+        // Każdy system ma własny wpis - bez wyścigu między wątkami
+        SystemTiming& timing = m_systemTimings[index];
+        timing.totalMs += ms;
+        timing.maxMs = std::max(timing.maxMs, ms);
+        timing.calls++;
+    }
+
+    if (checkAccess) {
+        SystemAccess::setCurrent(nullptr, nullptr);
+    }
+}
+
+std::vector<std::string> GameEngine::describeSchedule() {
+    if (m_scheduleDirty) {
+        buildSchedule();
+    }
+    std::vector<std::string> lines;
+    for (size_t j = 0; j < m_schedule.size(); ++j) {
+        const ScheduleNode& node = m_schedule[j];
+        std::string line = node.name;
+        if (node.access.needsMainThread() || !node.access.isDeclared()) {
+            line += node.access.isDeclared() ? " [main]" : " [exclusive]";
+        }
+        std::string deps;
+        for (size_t i = 0; i < j; ++i) {
+            const auto& succ = m_schedule[i].successors;
+            if (std::find(succ.begin(), succ.end(), j) != succ.end()) {
+                deps += (deps.empty() ? "" : ", ") + m_schedule[i].name;
+            }
+        }
+        lines.push_back(line + " <- " + (deps.empty() ? "-" : deps));
+    }
+    return lines;
+}
+
+void GameEngine::resetSystemTimings() {
+    m_systemTimings.assign(systems.size(), SystemTiming{});
+    for (size_t i = 0; i < systems.size(); ++i) {
+        m_systemTimings[i].name = systems[i]->getName();
     }
 }
 
 void GameEngine::render() {
-    for (auto& system : systems) {
-        system->render();
+    PROFILE_ZONE("GameEngine::render");
+    if (m_scheduleDirty) {
+        buildSchedule();
+    }
+    for (size_t i = 0; i < systems.size(); ++i) {
+        PROFILE_ZONE(m_schedule[i].renderZone);
+        systems[i]->render();
     }
 }
 
@@ -36,6 +231,8 @@ void GameEngine::shutdown() {
         system->shutdown();
     }
     systems.clear();
+    m_schedule.clear();
+    m_scheduleDirty = true;
 }
 
 void GameEngine::addSystem(std::unique_ptr<IGameSystem> system) {
@@ -45,6 +242,7 @@ void GameEngine::addSystem(std::unique_ptr<IGameSystem> system) {
             return a->getPriority() > b->getPriority();
         });
     systems.insert(it, std::move(system));
+    m_scheduleDirty = true;
 }
 
 void GameEngine::registerSystem(std::unique_ptr<IGameSystem> system) {
@@ -52,7 +250,3 @@ void GameEngine::registerSystem(std::unique_ptr<IGameSystem> system) {
 }
 
 // void GameEngine::registerSystem(IGameSystem* system) deleted
-
-EventSystem* GameEngine::getEventSystem() const {
-    return eventSystem.get();
-}
\ No newline at end of file
@@ -1,25 +1,64 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <vector>
 #include <algorithm>
 #include <functional>
+#include <string>
 #include "IGameSystem.h" // Include full definition for dynamic_cast
-#include "EventSystem.h"
+#include "EventBus.h"
+#include "SystemAccess.h"
 #include "../game/Item.h" // Include for Item definitions
 
 class IGameSystem;
-class EventSystem;
 class Terrain; // Forward declaration for Terrain
 
 class GameEngine {
 private:
     std::vector<std::unique_ptr<IGameSystem>> systems;
-    std::unique_ptr<EventSystem> eventSystem;
     Terrain* m_terrain = nullptr; // Wskaźnik na globalny obiekt terenu
+    bool m_headless = false;
+
+public:
+    /**
+     * @brief Skumulowany czas update() jednego systemu
+     */
+    struct SystemTiming {
+        std::string name;
+        double totalMs = 0.0;
+        double maxMs = 0.0;
+        size_t calls = 0;
+    };
+
+private:
+    bool m_systemTimingEnabled = false;
+    std::vector<SystemTiming> m_systemTimings; // indeks jak w systems
+
+    /**
+     * @brief Węzeł grafu zależności systemów (indeks jak w systems).
+     * Krawędź i -> j (i < j) istnieje, gdy deklaracje SystemAccess są w
+     * konflikcie - wtedy j czeka na i, jak w kolejności priorytetów.
+     */
+    struct ScheduleNode {
+        std::string name;
+        const char* updateZone = nullptr; // nazwy stref profilera
+        const char* renderZone = nullptr;
+        SystemAccess access;
+        std::vector<size_t> successors;
+        int dependencyCount = 0;
+    };
+    std::vector<ScheduleNode> m_schedule;
+    std::unique_ptr<std::atomic<int>[]> m_pendingDependencies;
+    bool m_scheduleDirty = true;
+    bool m_parallelSystems = true;
+
+    void buildSchedule();
+    void runSchedule(float deltaTime);
+    void runSystem(size_t index, float deltaTime);
 
     // Private constructor for Singleton
-    GameEngine() : eventSystem(std::make_unique<EventSystem>()) {}
+    GameEngine() = default;
 
 public:
     static GameEngine& getInstance();
@@ -49,6 +88,7 @@ public:
     // Pobierz system z silnika gry
     template<typename T>
     T* getSystem() const {
+        SystemAccess::check<T>(SystemAccess::Mode::Read);
         for (const auto& system : systems) {
             if (T* t = dynamic_cast<T*>(system.get())) {
                 return t;
@@ -57,8 +97,22 @@ public:
         return nullptr;
     }
 
-    // Metoda do pobierania systemu zdarzeń
-    EventSystem* getEventSystem() const;
+    // Tryb bez okna (benchmark / serwer) - systemy nie tworzą zasobów GPU
+    void setHeadless(bool headless) { m_headless = headless; }
+    bool isHeadless() const { return m_headless; }
+
+    // Pomiar czasu update() każdego systemu (domyślnie wyłączony)
+    void setSystemTimingEnabled(bool enabled) { m_systemTimingEnabled = enabled; }
+    const std::vector<SystemTiming>& getSystemTimings() const { return m_systemTimings; }
+    void resetSystemTimings();
+
+    // Równoległe update() systemów bez konfliktów (JobSystem)
+    void setParallelSystemsEnabled(bool enabled) { m_parallelSystems = enabled; }
+    bool isParallelSystemsEnabled() const { return m_parallelSystems; }
+    // Tryb debug: zgłasza dostęp niezadeklarowany w declareAccess()
+    void setAccessCheckEnabled(bool enabled) { SystemAccess::setCheckEnabled(enabled); }
+    // Opis grafu: "System <- zależności" dla każdego systemu (konsola)
+    std::vector<std::string> describeSchedule();
 
     // Zarządzanie terenem
     void registerTerrain(Terrain* terrain) { m_terrain = terrain; }
@@ -1,8 +1,25 @@
 #include "GameSystem.h"
 #include "../game/NavigationGrid.h" // Include full definition
 #include "../game/Terrain.h" // Include full definition
+#include "../game/Colony.h"
+#include "SystemAccess.h"
 
 // Initialize static members
 NavigationGrid* GameSystem::s_navigationGrid = nullptr;
 Colony* GameSystem::s_colony = nullptr;
-Terrain* GameSystem::s_terrain = nullptr;
\ No newline at end of file
+Terrain* GameSystem::s_terrain = nullptr;
+
+NavigationGrid* GameSystem::getNavigationGrid() {
+    SystemAccess::check<NavigationGrid>(SystemAccess::Mode::Read);
+    return s_navigationGrid;
+}
+
+Colony* GameSystem::getColony() {
+    SystemAccess::check<Colony>(SystemAccess::Mode::Read);
+    return s_colony;
+}
+
+Terrain* GameSystem::getTerrain() {
+    SystemAccess::check<Terrain>(SystemAccess::Mode::Read);
+    return s_terrain;
+}
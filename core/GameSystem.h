@@ -33,15 +33,16 @@ public:
     virtual void render() override = 0;
 
     // Static Accessor for Navigation Grid
-    static NavigationGrid* getNavigationGrid() { return s_navigationGrid; }
+    // (gettery w .cpp - tryb debug SystemAccess sprawdza deklaracje)
+    static NavigationGrid* getNavigationGrid();
     static void setNavigationGrid(NavigationGrid* grid) { s_navigationGrid = grid; }
 
     // Static Accessor for Colony
-    static Colony* getColony() { return s_colony; }
+    static Colony* getColony();
     static void setColony(Colony* colony) { s_colony = colony; }
 
     // Static Accessor for Terrain
-    static Terrain* getTerrain() { return s_terrain; }
+    static Terrain* getTerrain();
     static void setTerrain(Terrain* terrain) { s_terrain = terrain; }
 
 protected:
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include "SystemAccess.h"
 
 class IGameSystem {
 public:
@@ -23,4 +24,8 @@ public:
 
     // Pobierz priorytet systemu
     virtual int getPriority() const = 0;
+
+    // Deklaracja danych czytanych/zapisywanych w update() - bez niej system
+    // działa wyłącznie (sam), patrz SystemAccess
+    virtual void declareAccess(SystemAccess& access) const { (void)access; }
 };
\ No newline at end of file
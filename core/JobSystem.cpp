@@ -0,0 +1,198 @@
+#include "JobSystem.h"
+#include "Profiler.h"
+#include <iostream>
+#include <string>
+
+namespace {
+// Indeks kolejki bieżącego wątku (-1 = wątek spoza puli, np. główny)
+thread_local int t_workerIndex = -1;
+} // namespace
+
+JobSystem& JobSystem::getInstance() {
+    static JobSystem instance;
+    return instance;
+}
+
+JobSystem::~JobSystem() {
+    shutdown();
+}
+
+void JobSystem::initialize(unsigned workerCount) {
+    if (m_running)
+        return;
+
+    if (workerCount == 0) {
+        unsigned hw = std::thread::hardware_concurrency();
+        workerCount = hw > 1 ? hw - 1 : 0;
+    }
+
+    // Kolejki robocze + jedna dla zadań zlecanych spoza puli
+    m_queues.clear();
+    for (unsigned i = 0; i <= workerCount; ++i) {
+        m_queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    m_running = true;
+    for (unsigned i = 0; i < workerCount; ++i) {
+        m_threads.emplace_back(&JobSystem::workerLoop, this, i);
+    }
+
+    std::cout << "[JobSystem] Started " << workerCount << " worker threads" << std::endl;
+}
+
+void JobSystem::shutdown() {
+    if (!m_running)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_running = false;
+    }
+    m_wake.notify_all();
+
+    for (auto& thread : m_threads) {
+        if (thread.joinable())
+            thread.join();
+    }
+    m_threads.clear();
+    m_queues.clear();
+}
+
+void JobSystem::submit(Job job, std::atomic<int>* counter) {
+    if (counter)
+        counter->fetch_add(1);
+
+    // Bez puli - wykonaj synchronicznie
+    if (!m_running || m_threads.empty()) {
+        Task task{std::move(job), counter};
+        run(task);
+        return;
+    }
+
+    // Wątek roboczy wrzuca do swojej kolejki, pozostałe rozkładają round-robin
+    size_t index = t_workerIndex >= 0
+                       ? static_cast<size_t>(t_workerIndex)
+                       : m_nextQueue.fetch_add(1) % m_threads.size();
+    {
+        std::lock_guard<std::mutex> lock(m_queues[index]->mutex);
+        m_queues[index]->tasks.push_back(Task{std::move(job), counter});
+    }
+    {
+        // Pod muteksem, żeby wątek między sprawdzeniem predykatu a uśpieniem nie zgubił pobudki
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_queued.fetch_add(1);
+    }
+    m_wake.notify_one();
+}
+
+void JobSystem::wait(const std::atomic<int>& counter) {
+    size_t self = t_workerIndex >= 0 ? static_cast<size_t>(t_workerIndex)
+                                     : m_threads.size();
+    while (counter.load() > 0) {
+        if (!tryRunOne(self)) {
+            std::this_thread::yield();
+        }
+    }
+
+    if (std::exception_ptr error = takeFailure(counter))
+        std::rethrow_exception(error);
+}
+
+std::exception_ptr JobSystem::takeFailure(const std::atomic<int>& counter) {
+    std::lock_guard<std::mutex> lock(m_failureMutex);
+    auto it = m_failures.find(&counter);
+    if (it == m_failures.end())
+        return nullptr;
+    std::exception_ptr error = it->second;
+    m_failures.erase(it);
+    return error;
+}
+
+bool JobSystem::runPendingJob() {
+    if (m_threads.empty())
+        return false;
+    size_t self = t_workerIndex >= 0 ? static_cast<size_t>(t_workerIndex)
+                                     : m_threads.size();
+    return tryRunOne(self);
+}
+
+void JobSystem::workerLoop(size_t index) {
+    t_workerIndex = static_cast<int>(index);
+    Profiler::setThreadName("Worker " + std::to_string(index));
+
+    while (true) {
+        if (tryRunOne(index))
+            continue;
+
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        m_wake.wait(lock, [this]() { return !m_running || m_queued.load() > 0; });
+        if (!m_running && m_queued.load() == 0)
+            break;
+    }
+
+    t_workerIndex = -1;
+}
+
+bool JobSystem::popLocal(size_t index, Task& out) {
+    if (index >= m_queues.size())
+        return false;
+    WorkerQueue& queue = *m_queues[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty())
+        return false;
+    out = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool JobSystem::steal(size_t thief, Task& out) {
+    size_t count = m_queues.size();
+    for (size_t offset = 1; offset < count; ++offset) {
+        WorkerQueue& victim = *m_queues[(thief + offset) % count];
+        std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+        if (!lock.owns_lock() || victim.tasks.empty())
+            continue;
+        out = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        m_stolen.fetch_add(1);
+        return true;
+    }
+    return false;
+}
+
+bool JobSystem::tryRunOne(size_t index) {
+    Task task;
+    if (!popLocal(index, task) && !steal(index, task))
+        return false;
+    m_queued.fetch_sub(1);
+    run(task);
+    return true;
+}
+
+void JobSystem::run(Task& task) {
+    try {
+        task.job();
+    } catch (...) {
+        // Licznik musi zmaleć mimo wyjątku, inaczej wait() wisi
+        recordFailure(task.counter, std::current_exception());
+    }
+    m_executed.fetch_add(1);
+    if (task.counter)
+        task.counter->fetch_sub(1);
+}
+
+void JobSystem::recordFailure(const std::atomic<int>* counter, std::exception_ptr error) {
+    if (!counter) {
+        // Nikt nie czeka na to zadanie - zostaje tylko log
+        try {
+            std::rethrow_exception(error);
+        } catch (const std::exception& e) {
+            std::cerr << "[JobSystem] Unhandled exception in job: " << e.what() << std::endl;
+        } catch (...) {
+            std::cerr << "[JobSystem] Unhandled non-standard exception in job" << std::endl;
+        }
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_failureMutex);
+    m_failures.try_emplace(counter, error); // pierwszy wygrywa
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Pula wątków z kradzieżą zadań (work stealing).
+ *
+ * Każdy wątek roboczy ma własną kolejkę: właściciel zdejmuje zadania z
+ * końca (LIFO, ciepły cache), a bezczynne wątki kradną z początku cudzych
+ * kolejek. Wątek, który czeka na wynik (np. główny w parallelFor), sam
+ * wykonuje zadania zamiast spać.
+ *
+ * Użycie w pętli gry:
+ *   JobSystem::getInstance().parallelFor(n, 16, [&](size_t b, size_t e) {...});
+ */
+class JobSystem {
+public:
+    using Job = std::function<void()>;
+
+    static JobSystem& getInstance();
+
+    /**
+     * @brief Uruchamia wątki robocze (0 = liczba rdzeni - 1)
+     */
+    void initialize(unsigned workerCount = 0);
+
+    /**
+     * @brief Zatrzymuje i dołącza wątki robocze
+     */
+    void shutdown();
+
+    size_t getWorkerCount() const { return m_threads.size(); }
+
+    /**
+     * @brief Dodaje zadanie. Licznik jest inkrementowany teraz i
+     * dekrementowany po wykonaniu - wait(counter) czeka na zero.
+     * Wyjątek z zadania nie zatrzymuje licznika: pierwszy jest
+     * zapamiętywany dla licznika i rzucany ponownie w wait().
+     */
+    void submit(Job job, std::atomic<int>* counter = nullptr);
+
+    /**
+     * @brief Czeka na wyzerowanie licznika, pomagając w wykonywaniu zadań.
+     * Rzuca ponownie pierwszy wyjątek zadań tego licznika.
+     */
+    void wait(const std::atomic<int>& counter);
+
+    /**
+     * @brief Odbiera wyjątek zapamiętany dla licznika (nullptr = brak).
+     * Dla kodu, który sprawdza licznik sam zamiast wołać wait() - inaczej
+     * wyjątek zostałby w mapie do ponownego użycia adresu licznika.
+     */
+    std::exception_ptr takeFailure(const std::atomic<int>& counter);
+
+    /**
+     * @brief Wykonuje jedno oczekujące zadanie na bieżącym wątku.
+     * Dla pętli, które czekają na coś innego niż licznik (np. harmonogram
+     * systemów w GameEngine). Zwraca false, gdy kolejki są puste.
+     */
+    bool runPendingJob();
+
+    /**
+     * @brief Dzieli [0, count) na paczki po `grain` elementów i wykonuje
+     * fn(begin, end) równolegle. Blokuje do zakończenia wszystkich paczek.
+     */
+    template <typename Fn>
+    void parallelFor(size_t count, size_t grain, Fn&& fn) {
+        if (count == 0)
+            return;
+        grain = std::max<size_t>(grain, 1);
+
+        // Bez wątków roboczych albo za mało pracy - wykonaj od razu
+        if (m_threads.empty() || count <= grain) {
+            fn(size_t(0), count);
+            return;
+        }
+
+        std::atomic<int> counter{0};
+        for (size_t begin = 0; begin < count; begin += grain) {
+            size_t end = std::min(begin + grain, count);
+            submit([&fn, begin, end]() { fn(begin, end); }, &counter);
+        }
+        wait(counter);
+    }
+
+    struct Stats {
+        size_t executed = 0;
+        size_t stolen = 0;
+    };
+    Stats getStats() const { return {m_executed.load(), m_stolen.load()}; }
+
+private:
+    JobSystem() = default;
+    ~JobSystem();
+
+    struct Task {
+        Job job;
+        std::atomic<int>* counter;
+    };
+
+    struct WorkerQueue {
+        std::deque<Task> tasks;
+        std::mutex mutex;
+    };
+
+    void workerLoop(size_t index);
+    bool popLocal(size_t index, Task& out);
+    bool steal(size_t thief, Task& out);
+    bool tryRunOne(size_t index);
+    void run(Task& task);
+    void recordFailure(const std::atomic<int>* counter, std::exception_ptr error);
+
+    std::vector<std::unique_ptr<WorkerQueue>> m_queues; // [0..N) robocze, [N] zewnętrzna
+    std::vector<std::thread> m_threads;
+    std::atomic<bool> m_running{false};
+    std::atomic<int> m_queued{0};
+    std::atomic<size_t> m_nextQueue{0};
+    std::atomic<size_t> m_executed{0};
+    std::atomic<size_t> m_stolen{0};
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake;
+    // Pierwszy wyjątek na licznik - do ponownego rzucenia w wait()
+    std::mutex m_failureMutex;
+    std::unordered_map<const std::atomic<int>*, std::exception_ptr> m_failures;
+};
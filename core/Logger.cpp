@@ -0,0 +1,159 @@
+#include "Logger.h"
+#include <iostream>
+
+bool LogSite::admit(uint32_t& suppressedBefore) {
+    if (perSecond == 0)
+        return true;
+
+    int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      std::chrono::steady_clock::now().time_since_epoch())
+                      .count();
+    int64_t windowStart = windowStartMs.load(std::memory_order_relaxed);
+    if (now - windowStart >= 1000 &&
+        windowStartMs.compare_exchange_strong(windowStart, now, std::memory_order_relaxed)) {
+        // Nowe okno - pierwsza linia niesie licznik pominiętych
+        count.store(0, std::memory_order_relaxed);
+        suppressedBefore = suppressed.exchange(0, std::memory_order_relaxed);
+    }
+    if (count.fetch_add(1, std::memory_order_relaxed) >= perSecond) {
+        suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+Logger::Logger() {
+    m_running.store(true, std::memory_order_release);
+    m_thread = std::thread([this]() { run(); });
+}
+
+Logger::~Logger() {
+    stop();
+}
+
+void Logger::shutdown() {
+    instance().stop();
+}
+
+void Logger::stop() {
+    if (m_running.exchange(false, std::memory_order_acq_rel)) {
+        m_wake.notify_all();
+        if (m_thread.joinable())
+            m_thread.join();
+    }
+    std::lock_guard<std::mutex> lock(m_consumerMutex);
+    drainLocked();
+}
+
+void Logger::flush() {
+    Logger& logger = instance();
+    std::lock_guard<std::mutex> lock(logger.m_consumerMutex);
+    logger.drainLocked();
+}
+
+void Logger::run() {
+    while (m_running.load(std::memory_order_acquire)) {
+        size_t written;
+        {
+            std::lock_guard<std::mutex> lock(m_consumerMutex);
+            written = drainLocked();
+        }
+        if (written == 0) {
+            // Producenci nie budzą wątku (zero blokad po ich stronie) -
+            // krótki sen wystarcza przy partiach wypisywanych naraz
+            std::unique_lock<std::mutex> lock(m_wakeMutex);
+            m_wake.wait_for(lock, std::chrono::milliseconds(2));
+        }
+    }
+}
+
+size_t Logger::drainLocked() {
+    size_t count = m_ring.drain([this](LogRecord&& record) { writeRecord(record); });
+    if (count > 0 && m_consoleOutput.load(std::memory_order_relaxed)) {
+        std::cout.flush();
+        std::cerr.flush();
+    }
+    m_written.fetch_add(count, std::memory_order_relaxed);
+    return count;
+}
+
+void Logger::writeRecord(const LogRecord& record) {
+    bool console = m_consoleOutput.load(std::memory_order_relaxed);
+    bool keep = record.level >= LogLevel::Info; // Mission Log w UI
+    if (!console && !keep)
+        return;
+
+    m_format.str(std::string());
+    m_format.clear();
+    record.format(m_format);
+    if (record.suppressed > 0)
+        m_format << " (+" << record.suppressed << " suppressed)";
+    std::string message = m_format.str();
+
+    if (console) {
+        std::ostream& out = record.level == LogLevel::Info ? std::cout : std::cerr;
+        out << '[' << levelName(record.level) << ']';
+        if (record.category != LogCategory::General)
+            out << '[' << categoryName(record.category) << ']';
+        out << ' ' << message << '\n';
+    }
+
+    if (keep) {
+        std::lock_guard<std::mutex> lock(m_bufferMutex);
+        m_buffer.push_back(LogEntry{record.level, std::move(message), record.time});
+        if (m_buffer.size() > MAX_LOGS)
+            m_buffer.pop_front();
+    }
+}
+
+void Logger::setCategoryEnabled(LogCategory category, bool enabled) {
+    uint32_t bit = 1u << static_cast<unsigned>(category);
+    if (enabled)
+        instance().m_categoryMask.fetch_or(bit, std::memory_order_relaxed);
+    else
+        instance().m_categoryMask.fetch_and(~bit, std::memory_order_relaxed);
+}
+
+Logger::Stats Logger::getStats() {
+    Logger& logger = instance();
+    Stats stats;
+    stats.queued = logger.m_queued.load(std::memory_order_relaxed);
+    stats.written = logger.m_written.load(std::memory_order_relaxed);
+    stats.dropped = logger.m_dropped.load(std::memory_order_relaxed);
+    stats.suppressed = logger.m_suppressed.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void Logger::resetStats() {
+    Logger& logger = instance();
+    logger.m_queued.store(0, std::memory_order_relaxed);
+    logger.m_written.store(0, std::memory_order_relaxed);
+    logger.m_dropped.store(0, std::memory_order_relaxed);
+    logger.m_suppressed.store(0, std::memory_order_relaxed);
+}
+
+const char* Logger::levelName(LogLevel level) {
+    switch (level) {
+        case LogLevel::Debug: return "DEBUG";
+        case LogLevel::Info: return "INFO";
+        case LogLevel::Warning: return "WARNING";
+        case LogLevel::Error: return "ERROR";
+    }
+    return "?";
+}
+
+const char* Logger::categoryName(LogCategory category) {
+    switch (category) {
+        case LogCategory::General: return "General";
+        case LogCategory::Colony: return "Colony";
+        case LogCategory::Settler: return "Settler";
+        case LogCategory::Storage: return "Storage";
+        case LogCategory::Crafting: return "Crafting";
+        case LogCategory::AI: return "AI";
+        case LogCategory::World: return "World";
+        case LogCategory::Events: return "Events";
+        case LogCategory::UI: return "UI";
+        case LogCategory::Count: break;
+    }
+    return "?";
+}
@@ -1,61 +1,322 @@
 #pragma once
 
-#include <string>
-#include <iostream>
-#include <vector>
+#include "MpscRing.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <mutex>
+#include <new>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 // Simple enum for log levels
-enum class LogLevel {
+enum class LogLevel : uint8_t {
     Debug,
     Info,
     Warning,
     Error
 };
 
+// Kategorie logów - filtrowane osobno (w czasie kompilacji i w locie)
+enum class LogCategory : uint8_t {
+    General,
+    Colony,
+    Settler,
+    Storage,
+    Crafting,
+    AI,
+    World,
+    Events,
+    UI,
+    Count
+};
+
+// Poziom poniżej którego logi są wycinane przy kompilacji (0 = Debug ... 3 = Error).
+// Release (NDEBUG) domyślnie wycina Debug - wywołanie nie zostawia żadnego kodu.
+#ifndef LOG_COMPILE_LEVEL
+#ifdef NDEBUG
+#define LOG_COMPILE_LEVEL 1
+#else
+#define LOG_COMPILE_LEVEL 0
+#endif
+#endif
+
+// Maska kategorii kompilowanych (bit = LogCategory)
+#ifndef LOG_COMPILE_CATEGORIES
+#define LOG_COMPILE_CATEGORIES 0xFFFFFFFFu
+#endif
+
 struct LogEntry {
     LogLevel level;
     std::string message;
     float time; // Real time of the log
 };
 
-// Basic Logger class
-class Logger {
+/**
+ * @brief Miejsce wywołania logu (static w makrze) z limitem linii na sekundę.
+ * Nadmiarowe linie są liczone i doklejane do pierwszej linii nowego okna.
+ */
+struct LogSite {
+    const char* file;
+    int line;
+    uint32_t perSecond; // 0 = bez limitu
+
+    std::atomic<int64_t> windowStartMs{0};
+    std::atomic<uint32_t> count{0};
+    std::atomic<uint32_t> suppressed{0};
+
+    LogSite(const char* siteFile, int siteLine, uint32_t limit)
+        : file(siteFile), line(siteLine), perSecond(limit) {}
+
+    bool admit(uint32_t& suppressedBefore);
+};
+
+namespace LogDetail {
+
+constexpr size_t ARG_BYTES = 96;
+
+// Jak argument jest przechowywany do sformatowania na wątku loggera:
+// wszystko, co może wskazywać na cudzą pamięć (tablice znaków, char*,
+// std::string_view), jest kopiowane do std::string, reszta przez wartość.
+template <typename Plain>
+constexpr bool IsText = (std::is_array_v<Plain> &&
+                         std::is_same_v<std::remove_cv_t<std::remove_extent_t<Plain>>, char>) ||
+                        std::is_same_v<Plain, char*> || std::is_same_v<Plain, const char*> ||
+                        std::is_same_v<Plain, std::string_view>;
+
+template <typename T, typename Plain = std::remove_cv_t<std::remove_reference_t<T>>>
+using Captured = std::conditional_t<IsText<Plain>, std::string, std::decay_t<T>>;
+
+struct ArgsOps {
+    void (*format)(const void* args, std::ostream& out);
+    void (*destroy)(void* args);
+};
+
+template <typename Tuple> struct OpsFor {
+    static void format(const void* args, std::ostream& out) {
+        std::apply([&out](const auto&... values) { (out << ... << values); },
+                   *static_cast<const Tuple*>(args));
+    }
+    static void destroy(void* args) { static_cast<Tuple*>(args)->~Tuple(); }
+    static constexpr ArgsOps ops{&format, &destroy};
+};
+
+} // namespace LogDetail
+
+/**
+ * @brief Rekord w kolejce loggera: argumenty zapisane bez formatowania.
+ * Formatowanie (operator<<) odbywa się na wątku loggera.
+ */
+class LogRecord {
 public:
-    static void log(LogLevel level, const std::string& message) {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        
-        LogEntry entry = { level, message, 0.0f /* Time will be set by UISystem if needed or here */ };
-        m_buffer.push_back(entry);
-        
-        if (m_buffer.size() > MAX_LOGS) {
-            m_buffer.pop_front();
+    template <typename... Args>
+    LogRecord(LogLevel recordLevel, LogCategory recordCategory, uint32_t suppressedBefore,
+              float recordTime, Args&&... args)
+        : level(recordLevel), category(recordCategory), suppressed(suppressedBefore),
+          time(recordTime) {
+        using Tuple = std::tuple<LogDetail::Captured<Args>...>;
+        if constexpr (sizeof(Tuple) <= LogDetail::ARG_BYTES &&
+                      alignof(Tuple) <= alignof(std::max_align_t)) {
+            new (m_args) Tuple(std::forward<Args>(args)...);
+            m_ops = &LogDetail::OpsFor<Tuple>::ops;
+        } else {
+            // Za duże na bufor - formatujemy od razu
+            std::ostringstream out;
+            (out << ... << args);
+            using Text = std::tuple<std::string>;
+            new (m_args) Text(out.str());
+            m_ops = &LogDetail::OpsFor<Text>::ops;
         }
+    }
+
+    ~LogRecord() { m_ops->destroy(m_args); }
+
+    LogRecord(const LogRecord&) = delete;
+    LogRecord& operator=(const LogRecord&) = delete;
+
+    void format(std::ostream& out) const { m_ops->format(m_args, out); }
+
+    LogLevel level;
+    LogCategory category;
+    uint32_t suppressed;
+    float time;
+
+private:
+    const LogDetail::ArgsOps* m_ops;
+    alignas(std::max_align_t) unsigned char m_args[LogDetail::ARG_BYTES];
+};
+
+/**
+ * @brief Asynchroniczny logger.
+ *
+ * Wywołujący tylko zapisuje argumenty do bufora cyklicznego (MpscRing,
+ * bez blokad); wątek loggera formatuje i wypisuje linie partiami, z jednym
+ * flush na partię. Pełny bufor = linia odrzucona (liczona w Stats), gra
+ * nigdy nie czeka na konsolę.
+ *
+ * W gorących ścieżkach używaj makr LOG_DBG/LOG_INF/LOG_WRN/LOG_ERR:
+ * poziomy i kategorie poza LOG_COMPILE_LEVEL/LOG_COMPILE_CATEGORIES znikają
+ * przy kompilacji, a każde miejsce wywołania ma limit linii na sekundę.
+ */
+class Logger {
+public:
+    static constexpr uint32_t DEFAULT_SITE_RATE = 50; // linii/s na miejsce wywołania
+    static constexpr size_t QUEUE_CAPACITY = 4096;
+    static constexpr size_t MAX_LOGS = 100;
+
+    struct Stats {
+        uint64_t queued = 0;
+        uint64_t written = 0;
+        uint64_t dropped = 0;    // pełny bufor
+        uint64_t suppressed = 0; // limit miejsca wywołania
+    };
 
-        switch (level) {
-            case LogLevel::Debug:
-                std::cerr << "[DEBUG] " << message << std::endl;
-                break;
-            case LogLevel::Info:
-                std::cout << "[INFO] " << message << std::endl;
-                break;
-            case LogLevel::Warning:
-                std::cerr << "[WARNING] " << message << std::endl;
-                break;
-            case LogLevel::Error:
-                std::cerr << "[ERROR] " << message << std::endl;
-                break;
+    static constexpr int COMPILE_LEVEL = LOG_COMPILE_LEVEL;
+
+    static constexpr bool compiledIn(LogLevel level, LogCategory category) {
+        return static_cast<int>(level) >= COMPILE_LEVEL &&
+               ((LOG_COMPILE_CATEGORIES >> static_cast<unsigned>(category)) & 1u) != 0;
+    }
+
+    // Filtr w locie - jeden odczyt atomowy
+    static bool enabled(LogLevel level, LogCategory category) {
+        Logger& logger = instance();
+        return static_cast<int>(level) >= logger.m_minLevel.load(std::memory_order_relaxed) &&
+               ((logger.m_categoryMask.load(std::memory_order_relaxed) >>
+                 static_cast<unsigned>(category)) & 1u) != 0;
+    }
+
+    template <typename... Args>
+    static void write(LogLevel level, LogCategory category, LogSite& site, Args&&... args) {
+        uint32_t suppressedBefore = 0;
+        Logger& logger = instance();
+        if (!site.admit(suppressedBefore)) {
+            logger.m_suppressed.fetch_add(1, std::memory_order_relaxed);
+            return;
         }
+        logger.push(level, category, suppressedBefore, std::forward<Args>(args)...);
+    }
+
+    // Dotychczasowe API (komunikaty rozgrywki, Mission Log w UI)
+    static void log(LogLevel level, const std::string& message) {
+        if (!enabled(level, LogCategory::General))
+            return;
+        instance().push(level, LogCategory::General, 0, message);
     }
 
     static std::vector<LogEntry> getRecentLogs() {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        return std::vector<LogEntry>(m_buffer.begin(), m_buffer.end());
+        Logger& logger = instance();
+        std::lock_guard<std::mutex> lock(logger.m_bufferMutex);
+        return std::vector<LogEntry>(logger.m_buffer.begin(), logger.m_buffer.end());
+    }
+
+    static void setLevel(LogLevel level) {
+        instance().m_minLevel.store(static_cast<int>(level), std::memory_order_relaxed);
+    }
+    static LogLevel getLevel() {
+        return static_cast<LogLevel>(instance().m_minLevel.load(std::memory_order_relaxed));
     }
+    static void setCategoryEnabled(LogCategory category, bool enabled);
+    static bool isCategoryEnabled(LogCategory category) {
+        return ((instance().m_categoryMask.load(std::memory_order_relaxed) >>
+                 static_cast<unsigned>(category)) & 1u) != 0;
+    }
+
+    // false = nic nie trafia na stdout/stderr (np. headless bez --verbose)
+    static void setConsoleOutput(bool enabled) {
+        instance().m_consoleOutput.store(enabled, std::memory_order_relaxed);
+    }
+
+    // Wypisuje wszystko z kolejki na wątku wywołującym
+    static void flush();
+    // Zatrzymuje wątek loggera; późniejsze logi są wypisywane synchronicznie
+    static void shutdown();
+
+    static Stats getStats();
+    static void resetStats();
+
+    static const char* levelName(LogLevel level);
+    static const char* categoryName(LogCategory category);
 
 private:
-    static inline std::deque<LogEntry> m_buffer;
-    static inline std::mutex m_mutex;
-    static const size_t MAX_LOGS = 100;
-};
\ No newline at end of file
+    Logger();
+    ~Logger();
+
+    static Logger& instance() {
+        static Logger logger;
+        return logger;
+    }
+
+    template <typename... Args>
+    void push(LogLevel level, LogCategory category, uint32_t suppressedBefore, Args&&... args) {
+        float time = std::chrono::duration<float>(std::chrono::steady_clock::now() - m_start).count();
+        if (!m_ring.tryPush(level, category, suppressedBefore, time, std::forward<Args>(args)...)) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        m_queued.fetch_add(1, std::memory_order_relaxed);
+        if (!m_running.load(std::memory_order_acquire))
+            flush();
+    }
+
+    void run();
+    void stop();
+    size_t drainLocked();
+    void writeRecord(const LogRecord& record);
+
+    MpscRing<LogRecord> m_ring{QUEUE_CAPACITY};
+    std::chrono::steady_clock::time_point m_start = std::chrono::steady_clock::now();
+
+    std::atomic<int> m_minLevel{0};
+    std::atomic<uint32_t> m_categoryMask{0xFFFFFFFFu};
+    std::atomic<bool> m_consoleOutput{true};
+
+    std::atomic<uint64_t> m_queued{0};
+    std::atomic<uint64_t> m_written{0};
+    std::atomic<uint64_t> m_dropped{0};
+    std::atomic<uint64_t> m_suppressed{0};
+
+    // Konsument bufora (wątek loggera albo flush)
+    std::mutex m_consumerMutex;
+    std::ostringstream m_format;
+
+    std::mutex m_bufferMutex;
+    std::deque<LogEntry> m_buffer;
+
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake;
+    std::atomic<bool> m_running{false};
+    std::thread m_thread;
+};
+
+#define LOG_AT(levelValue, categoryValue, perSecond, ...)                                  \
+    do {                                                                                   \
+        if constexpr (Logger::compiledIn(levelValue, categoryValue)) {                     \
+            static LogSite logSite_(__FILE__, __LINE__, (perSecond));                      \
+            if (Logger::enabled(levelValue, categoryValue))                                \
+                Logger::write(levelValue, categoryValue, logSite_, __VA_ARGS__);           \
+        }                                                                                  \
+    } while (0)
+
+// LOG_DBG(Storage, "Added ", amount, " items") - argumenty łączone jak operator<<
+#define LOG_DBG(category, ...) \
+    LOG_AT(LogLevel::Debug, LogCategory::category, Logger::DEFAULT_SITE_RATE, __VA_ARGS__)
+#define LOG_INF(category, ...) \
+    LOG_AT(LogLevel::Info, LogCategory::category, Logger::DEFAULT_SITE_RATE, __VA_ARGS__)
+#define LOG_WRN(category, ...) \
+    LOG_AT(LogLevel::Warning, LogCategory::category, Logger::DEFAULT_SITE_RATE, __VA_ARGS__)
+#define LOG_ERR(category, ...) \
+    LOG_AT(LogLevel::Error, LogCategory::category, Logger::DEFAULT_SITE_RATE, __VA_ARGS__)
+// Własny limit, np. LOG_RATE(Debug, Settler, 1, "Blocked by tree.")
+#define LOG_RATE(level, category, perSecond, ...) \
+    LOG_AT(LogLevel::level, LogCategory::category, perSecond, __VA_ARGS__)
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+/**
+ * @brief Kolejka zadań, które muszą wykonać się na wątku głównym
+ * (wysyłanie siatek/tekstur do GPU po generowaniu na wątkach roboczych).
+ *
+ * push() można wołać z dowolnego wątku. Pętla główna wywołuje process()
+ * raz na klatkę z budżetem czasu - zadania ponad budżet czekają do
+ * następnej klatki, więc seria uploadów nie robi przycięcia.
+ */
+class MainThreadQueue {
+public:
+  using Task = std::function<void()>;
+
+  struct Stats {
+    size_t pending = 0;
+    size_t processed = 0;     // od startu
+    size_t lastFrameTasks = 0;
+    double lastFrameMs = 0.0;
+    double maxFrameMs = 0.0;
+  };
+
+  static MainThreadQueue &getInstance() {
+    static MainThreadQueue instance;
+    return instance;
+  }
+
+  void push(Task task) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tasks.push_back(std::move(task));
+  }
+
+  /**
+   * @brief Wykonuje zadania do wyczerpania budżetu (co najmniej jedno,
+   * żeby kolejka zawsze postępowała). budgetMs <= 0 = wszystkie.
+   */
+  size_t process(double budgetMs) {
+    using Clock = std::chrono::steady_clock;
+    auto start = Clock::now();
+    size_t done = 0;
+    for (;;) {
+      Task task;
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_tasks.empty())
+          break;
+        task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+      }
+      task();
+      ++done;
+      double elapsed =
+          std::chrono::duration<double, std::milli>(Clock::now() - start)
+              .count();
+      if (budgetMs > 0.0 && elapsed >= budgetMs)
+        break;
+    }
+    double elapsed =
+        std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    m_stats.processed += done;
+    m_stats.lastFrameTasks = done;
+    m_stats.lastFrameMs = elapsed;
+    if (elapsed > m_stats.maxFrameMs)
+      m_stats.maxFrameMs = elapsed;
+    return done;
+  }
+
+  // Wszystko naraz (start gry, ekran ładowania)
+  size_t flush() { return process(0.0); }
+
+  Stats getStats() const {
+    Stats stats = m_stats;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    stats.pending = m_tasks.size();
+    return stats;
+  }
+
+private:
+  MainThreadQueue() = default;
+
+  mutable std::mutex m_mutex;
+  std::deque<Task> m_tasks;
+  Stats m_stats;
+};
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+/**
+ * @brief Ograniczony bufor cykliczny: wielu producentów, jeden konsument.
+ *
+ * Producenci (dowolne wątki) rezerwują komórkę przez CAS na ogonie,
+ * konsument (wątek główny) czyta bez CAS. Każda komórka ma własny numer
+ * sekwencji, więc konsument widzi tylko w pełni zapisane elementy.
+ * tryPush() zwraca false, gdy bufor jest pełny - decyzja co dalej należy
+ * do wywołującego. Pojemność zaokrąglana w górę do potęgi dwójki.
+ */
+template <typename T> class MpscRing {
+public:
+  explicit MpscRing(size_t capacity) {
+    size_t size = 2;
+    while (size < capacity)
+      size <<= 1;
+    m_mask = size - 1;
+    m_cells.reset(new Cell[size]);
+    for (size_t i = 0; i < size; ++i)
+      m_cells[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  ~MpscRing() {
+    drain([](T &&) {});
+  }
+
+  MpscRing(const MpscRing &) = delete;
+  MpscRing &operator=(const MpscRing &) = delete;
+
+  // Dowolny wątek
+  template <typename... Args> bool tryPush(Args &&...args) {
+    size_t pos = m_tail.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;) {
+      cell = &m_cells[pos & m_mask];
+      size_t seq = cell->sequence.load(std::memory_order_acquire);
+      intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+      if (diff == 0) {
+        if (m_tail.compare_exchange_weak(pos, pos + 1,
+                                         std::memory_order_relaxed))
+          break;
+      } else if (diff < 0) {
+        return false; // pełny
+      } else {
+        pos = m_tail.load(std::memory_order_relaxed);
+      }
+    }
+    new (cell->storage) T(std::forward<Args>(args)...);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Tylko konsument. Wywołuje fn(T&&) dla każdego dostępnego elementu.
+  template <typename Fn> size_t drain(Fn &&fn) {
+    size_t head = m_head.load(std::memory_order_relaxed);
+    size_t count = 0;
+    for (;;) {
+      Cell &cell = m_cells[head & m_mask];
+      if (cell.sequence.load(std::memory_order_acquire) != head + 1)
+        break;
+      T *value = std::launder(reinterpret_cast<T *>(cell.storage));
+      fn(std::move(*value));
+      value->~T();
+      cell.sequence.store(head + m_mask + 1, std::memory_order_release);
+      ++head;
+      ++count;
+    }
+    m_head.store(head, std::memory_order_relaxed);
+    return count;
+  }
+
+  // Przybliżona liczba elementów (dokładna, gdy producenci stoją)
+  size_t size() const {
+    size_t tail = m_tail.load(std::memory_order_acquire);
+    size_t head = m_head.load(std::memory_order_relaxed);
+    return tail > head ? tail - head : 0;
+  }
+
+  size_t capacity() const { return m_mask + 1; }
+
+private:
+  struct Cell {
+    std::atomic<size_t> sequence{0};
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  std::unique_ptr<Cell[]> m_cells;
+  size_t m_mask = 0;
+  alignas(64) std::atomic<size_t> m_tail{0};
+  alignas(64) std::atomic<size_t> m_head{0}; // zapisuje tylko konsument
+};
@@ -0,0 +1,383 @@
+#include "Profiler.h"
+#include "raylib.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <tuple>
+
+std::atomic<bool> Profiler::s_enabled{false};
+bool Profiler::s_overlayVisible = false;
+
+namespace {
+// Bufor jednego wątku. Mutex jest praktycznie zawsze wolny - endFrame
+// bierze go raz na klatkę, żeby zabrać zdarzenia.
+struct ThreadBuffer {
+    std::mutex mutex;
+    std::vector<ProfileEvent> events;
+    std::string name;
+    uint16_t index = 0;
+    uint16_t depth = 0;
+
+    ThreadBuffer();
+    ~ThreadBuffer();
+};
+
+std::mutex g_registryMutex;
+std::vector<ThreadBuffer*> g_registry;
+std::vector<std::string> g_threadNames; // indeks = ProfileEvent::thread
+std::vector<ProfileEvent> g_orphaned;    // zdarzenia zakończonych wątków
+uint16_t g_nextThread = 0;
+
+std::mutex g_framesMutex;
+std::deque<ProfileFrame> g_frames;
+size_t g_frameCapacity = Profiler::DEFAULT_FRAME_CAPACITY;
+uint64_t g_frameIndex = 0;
+int64_t g_frameStart = 0;
+std::vector<ProfileCounter> g_pendingCounters; // wątek główny
+
+std::mutex g_internMutex;
+std::set<std::string> g_interned;
+
+const auto g_epoch = std::chrono::steady_clock::now();
+
+ThreadBuffer::ThreadBuffer() {
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    index = g_nextThread++;
+    name = "Thread " + std::to_string(index);
+    g_threadNames.push_back(name);
+    g_registry.push_back(this);
+}
+
+ThreadBuffer::~ThreadBuffer() {
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    g_registry.erase(std::remove(g_registry.begin(), g_registry.end(), this), g_registry.end());
+    g_orphaned.insert(g_orphaned.end(), events.begin(), events.end());
+}
+
+ThreadBuffer& forThread() {
+    thread_local ThreadBuffer buffer;
+    return buffer;
+}
+
+void writeJsonString(std::ostream& out, const char* text) {
+    out << '"';
+    for (const char* c = text; *c; ++c) {
+        if (*c == '"' || *c == '\\')
+            out << '\\';
+        out << *c;
+    }
+    out << '"';
+}
+} // namespace
+
+void Profiler::setEnabled(bool enabled) {
+    s_enabled.store(enabled, std::memory_order_relaxed);
+    if (enabled)
+        g_frameStart = nowNs();
+}
+
+int64_t Profiler::nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now() - g_epoch)
+        .count();
+}
+
+uint16_t Profiler::enterZone() {
+    return forThread().depth++;
+}
+
+void Profiler::leaveZone(const char* name, int64_t startNs, uint16_t depth) {
+    int64_t endNs = nowNs();
+    ThreadBuffer& buffer = forThread();
+    buffer.depth = depth;
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    buffer.events.push_back(ProfileEvent{name, startNs, endNs, depth, buffer.index});
+}
+
+void Profiler::beginFrame() {
+    if (!isEnabled())
+        return;
+    g_frameStart = nowNs();
+}
+
+void Profiler::endFrame() {
+    if (!isEnabled())
+        return;
+
+    ProfileFrame frame;
+    frame.index = g_frameIndex++;
+    frame.startNs = g_frameStart;
+    frame.endNs = nowNs();
+    frame.counters.swap(g_pendingCounters);
+    {
+        std::lock_guard<std::mutex> lock(g_registryMutex);
+        frame.events.swap(g_orphaned);
+        for (ThreadBuffer* buffer : g_registry) {
+            std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+            frame.events.insert(frame.events.end(), buffer->events.begin(), buffer->events.end());
+            buffer->events.clear();
+        }
+    }
+    // Kolejność wywołań: wątek, początek, rodzic przed dzieckiem
+    std::sort(frame.events.begin(), frame.events.end(),
+              [](const ProfileEvent& a, const ProfileEvent& b) {
+                  if (a.thread != b.thread)
+                      return a.thread < b.thread;
+                  if (a.startNs != b.startNs)
+                      return a.startNs < b.startNs;
+                  return a.depth < b.depth;
+              });
+
+    std::lock_guard<std::mutex> lock(g_framesMutex);
+    g_frames.push_back(std::move(frame));
+    while (g_frames.size() > g_frameCapacity)
+        g_frames.pop_front();
+    g_frameStart = nowNs();
+}
+
+const char* Profiler::intern(const std::string& name) {
+    std::lock_guard<std::mutex> lock(g_internMutex);
+    return g_interned.insert(name).first->c_str();
+}
+
+void Profiler::recordCounter(const char* track, const char* series, double value) {
+    if (!isEnabled())
+        return;
+    g_pendingCounters.push_back(ProfileCounter{track, series, value});
+}
+
+void Profiler::setThreadName(const std::string& name) {
+    ThreadBuffer& buffer = forThread();
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    buffer.name = name;
+    g_threadNames[buffer.index] = name;
+}
+
+void Profiler::setFrameCapacity(size_t frames) {
+    std::lock_guard<std::mutex> lock(g_framesMutex);
+    g_frameCapacity = std::max<size_t>(frames, 1);
+    while (g_frames.size() > g_frameCapacity)
+        g_frames.pop_front();
+}
+
+size_t Profiler::getFrameCount() {
+    std::lock_guard<std::mutex> lock(g_framesMutex);
+    return g_frames.size();
+}
+
+bool Profiler::getLastFrame(ProfileFrame& out) {
+    std::lock_guard<std::mutex> lock(g_framesMutex);
+    if (g_frames.empty())
+        return false;
+    out = g_frames.back();
+    return true;
+}
+
+std::vector<Profiler::ZoneSummary> Profiler::summarize(size_t frames) {
+    std::vector<ZoneSummary> result;
+    std::map<std::tuple<uint16_t, uint16_t, const char*>, size_t> rows;
+
+    std::lock_guard<std::mutex> lock(g_framesMutex);
+    size_t count = std::min(frames, g_frames.size());
+    if (count == 0)
+        return result;
+    for (size_t f = g_frames.size() - count; f < g_frames.size(); ++f) {
+        for (const ProfileEvent& event : g_frames[f].events) {
+            auto key = std::make_tuple(event.thread, event.depth, event.name);
+            auto it = rows.find(key);
+            if (it == rows.end()) {
+                it = rows.emplace(key, result.size()).first;
+                ZoneSummary summary;
+                summary.name = event.name;
+                summary.depth = event.depth;
+                summary.thread = event.thread;
+                result.push_back(summary);
+            }
+            ZoneSummary& summary = result[it->second];
+            double ms = (event.endNs - event.startNs) / 1e6;
+            summary.totalMs += ms;
+            summary.maxMs = std::max(summary.maxMs, ms);
+            summary.calls += 1.0;
+        }
+    }
+    for (ZoneSummary& summary : result) {
+        summary.totalMs /= static_cast<double>(count);
+        summary.calls /= static_cast<double>(count);
+    }
+    return result;
+}
+
+void Profiler::clear() {
+    std::lock_guard<std::mutex> lock(g_framesMutex);
+    g_frames.clear();
+}
+
+bool Profiler::exportChromeTrace(const std::string& path) {
+    std::ofstream out(path);
+    if (!out.is_open())
+        return false;
+
+    std::vector<std::string> threadNames;
+    {
+        std::lock_guard<std::mutex> lock(g_registryMutex);
+        threadNames = g_threadNames;
+    }
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    auto separator = [&]() {
+        if (!first)
+            out << ",\n";
+        first = false;
+    };
+
+    for (size_t t = 0; t < threadNames.size(); ++t) {
+        separator();
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << t
+            << ",\"args\":{\"name\":";
+        writeJsonString(out, threadNames[t].c_str());
+        out << "}}";
+    }
+
+    char number[64];
+    std::lock_guard<std::mutex> lock(g_framesMutex);
+    for (const ProfileFrame& frame : g_frames) {
+        separator();
+        std::snprintf(number, sizeof(number), "%.3f", frame.startNs / 1000.0);
+        out << "{\"name\":\"Frame " << frame.index << "\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,"
+            << "\"tid\":0,\"ts\":" << number << "}";
+
+        for (const ProfileEvent& event : frame.events) {
+            separator();
+            out << "{\"name\":";
+            writeJsonString(out, event.name);
+            std::snprintf(number, sizeof(number), "%.3f", event.startNs / 1000.0);
+            out << ",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread
+                << ",\"ts\":" << number;
+            std::snprintf(number, sizeof(number), "%.3f", (event.endNs - event.startNs) / 1000.0);
+            out << ",\"dur\":" << number << "}";
+        }
+
+        // Tor licznika = jedno zdarzenie "C" z seriami w args
+        std::snprintf(number, sizeof(number), "%.3f", frame.endNs / 1000.0);
+        std::vector<bool> written(frame.counters.size(), false);
+        for (size_t i = 0; i < frame.counters.size(); ++i) {
+            if (written[i])
+                continue;
+            const char* track = frame.counters[i].track;
+            separator();
+            out << "{\"name\":";
+            writeJsonString(out, track);
+            out << ",\"ph\":\"C\",\"pid\":1,\"tid\":0,\"ts\":" << number << ",\"args\":{";
+            bool firstSeries = true;
+            for (size_t j = i; j < frame.counters.size(); ++j) {
+                if (frame.counters[j].track != track)
+                    continue;
+                written[j] = true;
+                if (!firstSeries)
+                    out << ",";
+                firstSeries = false;
+                writeJsonString(out, frame.counters[j].series);
+                out << ":" << frame.counters[j].value;
+            }
+            out << "}}";
+        }
+    }
+    out << "\n]}\n";
+    return out.good();
+}
+
+void Profiler::renderOverlay(int x, int y) {
+    if (!s_overlayVisible)
+        return;
+
+    const int width = 420;
+    const int graphHeight = 60;
+    const int rowHeight = 14;
+    const size_t maxRows = 18;
+
+    std::vector<double> frameMs;
+    {
+        std::lock_guard<std::mutex> lock(g_framesMutex);
+        for (const ProfileFrame& frame : g_frames)
+            frameMs.push_back(frame.durationMs());
+    }
+    std::vector<ZoneSummary> zones = summarize(30);
+    size_t rows = std::min(zones.size(), maxRows);
+
+    // Liczniki ostatniej klatki: jeden wiersz na tor, niezerowe serie
+    std::vector<std::string> counterRows;
+    {
+        std::lock_guard<std::mutex> lock(g_framesMutex);
+        if (!g_frames.empty()) {
+            const std::vector<ProfileCounter>& counters = g_frames.back().counters;
+            std::vector<bool> written(counters.size(), false);
+            for (size_t i = 0; i < counters.size(); ++i) {
+                if (written[i])
+                    continue;
+                double total = 0.0;
+                std::string series;
+                for (size_t j = i; j < counters.size(); ++j) {
+                    if (counters[j].track != counters[i].track)
+                        continue;
+                    written[j] = true;
+                    total += counters[j].value;
+                    if (counters[j].value != 0.0)
+                        series += std::string(" ") + counters[j].series + " " +
+                                  TextFormat("%.0f", counters[j].value);
+                }
+                counterRows.push_back(std::string(counters[i].track) + ": " +
+                                      TextFormat("%.0f", total) + " |" + series);
+            }
+        }
+    }
+
+    int height = 30 + graphHeight + 10 + static_cast<int>(rows) * rowHeight + 10 +
+                 static_cast<int>(counterRows.size()) * rowHeight;
+    DrawRectangle(x, y, width, height, Fade(BLACK, 0.8f));
+    DrawRectangleLines(x, y, width, height, DARKGRAY);
+
+    if (!isEnabled()) {
+        DrawText("Profiler off (console: profile on)", x + 8, y + 8, 12, LIGHTGRAY);
+        return;
+    }
+
+    double lastMs = frameMs.empty() ? 0.0 : frameMs.back();
+    DrawText(TextFormat("CPU frame %.2f ms (%zu frames)", lastMs, frameMs.size()), x + 8, y + 8,
+             12, RAYWHITE);
+
+    // Czasy klatek - pasek na klatkę, linia 16.6 ms
+    int graphTop = y + 28;
+    const double scaleMs = 33.3;
+    size_t shown = std::min(frameMs.size(), static_cast<size_t>(width - 16));
+    for (size_t i = 0; i < shown; ++i) {
+        double ms = frameMs[frameMs.size() - shown + i];
+        int barHeight = static_cast<int>(std::min(ms / scaleMs, 1.0) * graphHeight);
+        Color color = ms > 16.7 ? (ms > 33.3 ? RED : ORANGE) : LIME;
+        DrawRectangle(x + 8 + static_cast<int>(i), graphTop + graphHeight - barHeight, 1, barHeight,
+                      color);
+    }
+    int budgetY = graphTop + graphHeight - static_cast<int>(16.7 / scaleMs * graphHeight);
+    DrawLine(x + 8, budgetY, x + width - 8, budgetY, Fade(WHITE, 0.4f));
+
+    int rowY = graphTop + graphHeight + 10;
+    for (size_t i = 0; i < rows; ++i) {
+        const ZoneSummary& zone = zones[i];
+        int indent = 8 + zone.depth * 10;
+        DrawText(TextFormat("T%u %s", zone.thread, zone.name), x + indent, rowY, 10,
+                 zone.thread == 0 ? RAYWHITE : SKYBLUE);
+        DrawText(TextFormat("%7.3f ms  x%.1f", zone.totalMs, zone.calls), x + width - 130, rowY, 10,
+                 LIGHTGRAY);
+        rowY += rowHeight;
+    }
+    for (const std::string& row : counterRows) {
+        DrawText(row.c_str(), x + 8, rowY, 10, GOLD);
+        rowY += rowHeight;
+    }
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 0 = makra PROFILE_* nie generują kodu
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+/**
+ * @brief Jedna strefa czasu (zakończona) - wątek, zagnieżdżenie, ns od startu.
+ */
+struct ProfileEvent {
+    const char* name; // literał albo Profiler::intern
+    int64_t startNs;
+    int64_t endNs;
+    uint16_t depth;
+    uint16_t thread;
+};
+
+/**
+ * @brief Wartość licznika w klatce - tor (np. "Draw calls") i seria w nim.
+ */
+struct ProfileCounter {
+    const char* track; // literał albo Profiler::intern
+    const char* series;
+    double value;
+};
+
+struct ProfileFrame {
+    uint64_t index = 0;
+    int64_t startNs = 0;
+    int64_t endNs = 0;
+    std::vector<ProfileEvent> events;
+    std::vector<ProfileCounter> counters;
+
+    double durationMs() const { return (endNs - startNs) / 1e6; }
+};
+
+/**
+ * @brief Hierarchiczny profiler CPU.
+ *
+ * PROFILE_ZONE("Nazwa") mierzy zakres do końca bloku. Strefy można
+ * zagnieżdżać i otwierać na dowolnym wątku - każdy wątek zapisuje do
+ * własnego bufora, a endFrame() (wątek główny) zbiera je do pierścienia
+ * ostatnich klatek. Wyłączony profiler kosztuje jeden odczyt atomowy na
+ * strefę; PROFILER_ENABLED=0 usuwa makra całkowicie.
+ *
+ * Klatki z pierścienia trafiają do nakładki (renderOverlay) i do pliku
+ * Chrome trace (chrome://tracing, Perfetto). Liczniki (recordCounter, np.
+ * RenderStats) są zapisywane przy klatce i eksportowane jako tory "C".
+ */
+class Profiler {
+public:
+    static constexpr size_t DEFAULT_FRAME_CAPACITY = 240;
+
+    // Zagregowana strefa (nazwa + głębokość) z kilku klatek
+    struct ZoneSummary {
+        const char* name = nullptr;
+        uint16_t depth = 0;
+        uint16_t thread = 0;
+        double totalMs = 0.0;
+        double maxMs = 0.0;
+        double calls = 0.0; // na klatkę
+    };
+
+    static bool isEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+    static void setEnabled(bool enabled);
+
+    // Granice klatki - tylko wątek główny
+    static void beginFrame();
+    static void endFrame();
+
+    // Stabilny wskaźnik dla nazw budowanych w locie (np. nazwa systemu)
+    static const char* intern(const std::string& name);
+    static void setThreadName(const std::string& name);
+    // Licznik bieżącej klatki - tylko wątek główny, przed endFrame()
+    static void recordCounter(const char* track, const char* series, double value);
+
+    static void setFrameCapacity(size_t frames);
+    static size_t getFrameCount();
+    static bool getLastFrame(ProfileFrame& out);
+    // Średnio na klatkę z ostatnich `frames` klatek, w kolejności wywołań
+    static std::vector<ZoneSummary> summarize(size_t frames);
+    static void clear();
+
+    static bool exportChromeTrace(const std::string& path);
+
+    static void setOverlayVisible(bool visible) { s_overlayVisible = visible; }
+    static bool isOverlayVisible() { return s_overlayVisible; }
+    static void renderOverlay(int x, int y);
+
+    // Dla ProfileZone
+    static int64_t nowNs();
+    static uint16_t enterZone();
+    static void leaveZone(const char* name, int64_t startNs, uint16_t depth);
+
+private:
+    static std::atomic<bool> s_enabled;
+    static bool s_overlayVisible;
+};
+
+class ProfileZone {
+public:
+    explicit ProfileZone(const char* name) : m_name(nullptr) {
+        if (!Profiler::isEnabled())
+            return;
+        m_name = name;
+        m_depth = Profiler::enterZone();
+        m_startNs = Profiler::nowNs();
+    }
+
+    ~ProfileZone() {
+        if (m_name)
+            Profiler::leaveZone(m_name, m_startNs, m_depth);
+    }
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    const char* m_name;
+    int64_t m_startNs = 0;
+    uint16_t m_depth = 0;
+};
+
+#if PROFILER_ENABLED
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_ZONE(name) ProfileZone PROFILE_CONCAT(profileZone_, __LINE__)(name)
+#else
+#define PROFILE_ZONE(name) ((void)0)
+#endif
@@ -0,0 +1,230 @@
+#include "RenderStats.h"
+#include "Profiler.h"
+#include "raylib.h"
+#include "rlgl.h"
+#if defined(GRAPHICS_API_OPENGL_33)
+#include "external/glad.h" // wskaźniki glad_gl* z rlgl
+#endif
+
+namespace {
+bool g_installed = false;
+bool g_enabled = false;
+RenderPass g_pass = RenderPass::Other;
+RenderFrameStats g_frame;
+RenderFrameStats g_lastFrame;
+
+RenderPassStats& current() {
+    return g_frame.passes[static_cast<size_t>(g_pass)];
+}
+
+#if defined(GRAPHICS_API_OPENGL_33)
+rlRenderBatch g_batch{}; // własny batch - znane id VAO
+GLuint g_boundTexture = 0;
+
+PFNGLDRAWARRAYSPROC g_drawArrays = nullptr;
+PFNGLDRAWELEMENTSPROC g_drawElements = nullptr;
+PFNGLDRAWARRAYSINSTANCEDPROC g_drawArraysInstanced = nullptr;
+PFNGLDRAWELEMENTSINSTANCEDPROC g_drawElementsInstanced = nullptr;
+PFNGLBINDTEXTUREPROC g_bindTexture = nullptr;
+PFNGLBINDVERTEXARRAYPROC g_bindVertexArray = nullptr;
+
+void countDraw(GLsizei count, GLsizei instances) {
+    if (!g_enabled)
+        return;
+    RenderPassStats& stats = current();
+    stats.drawCalls++;
+    stats.vertices += static_cast<uint64_t>(count) * static_cast<uint64_t>(instances);
+    if (instances > 1)
+        stats.instances += static_cast<uint64_t>(instances);
+}
+
+void GLAD_API_PTR hookDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    countDraw(count, 1);
+    g_drawArrays(mode, first, count);
+}
+
+void GLAD_API_PTR hookDrawElements(GLenum mode, GLsizei count, GLenum type,
+                                   const void* indices) {
+    countDraw(count, 1);
+    g_drawElements(mode, count, type, indices);
+}
+
+void GLAD_API_PTR hookDrawArraysInstanced(GLenum mode, GLint first, GLsizei count,
+                                          GLsizei instances) {
+    countDraw(count, instances);
+    g_drawArraysInstanced(mode, first, count, instances);
+}
+
+void GLAD_API_PTR hookDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type,
+                                            const void* indices, GLsizei instances) {
+    countDraw(count, instances);
+    g_drawElementsInstanced(mode, count, type, indices, instances);
+}
+
+void GLAD_API_PTR hookBindTexture(GLenum target, GLuint texture) {
+    if (g_enabled && target == GL_TEXTURE_2D && texture != g_boundTexture)
+        current().textureSwitches++;
+    if (target == GL_TEXTURE_2D)
+        g_boundTexture = texture;
+    g_bindTexture(target, texture);
+}
+
+void GLAD_API_PTR hookBindVertexArray(GLuint array) {
+    // rlDrawRenderBatch wiąże VAO batcha tylko, gdy ma coś do narysowania
+    if (g_enabled && array != 0) {
+        for (int i = 0; i < g_batch.bufferCount; ++i) {
+            if (g_batch.vertexBuffer[i].vaoId == array) {
+                current().batchFlushes++;
+                break;
+            }
+        }
+    }
+    g_bindVertexArray(array);
+}
+
+bool batchPending() {
+    return g_installed &&
+           (g_batch.drawCounter > 1 || (g_batch.draws && g_batch.draws[0].vertexCount > 0));
+}
+
+template <typename Fn> void replace(Fn& saved, Fn& glad, Fn hook) {
+    saved = glad;
+    if (glad)
+        glad = hook;
+}
+
+template <typename Fn> void restore(Fn& saved, Fn& glad) {
+    if (saved)
+        glad = saved;
+    saved = nullptr;
+}
+#else
+// rlsw (src/rcore_offscreen.c) nie ma wskaźników GL do podmiany ani batcha
+bool batchPending() { return false; }
+#endif
+} // namespace
+
+void RenderPassStats::add(const RenderPassStats& other) {
+    drawCalls += other.drawCalls;
+    vertices += other.vertices;
+    instances += other.instances;
+    textureSwitches += other.textureSwitches;
+    batchFlushes += other.batchFlushes;
+    forcedFlushes += other.forcedFlushes;
+}
+
+RenderPassStats RenderFrameStats::total() const {
+    RenderPassStats sum;
+    for (const RenderPassStats& pass : passes)
+        sum.add(pass);
+    return sum;
+}
+
+void RenderStats::install() {
+    if (g_installed || !IsWindowReady())
+        return;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    g_batch = rlLoadRenderBatch(1, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
+    rlSetRenderBatchActive(&g_batch);
+
+    replace(g_drawArrays, glad_glDrawArrays, &hookDrawArrays);
+    replace(g_drawElements, glad_glDrawElements, &hookDrawElements);
+    replace(g_drawArraysInstanced, glad_glDrawArraysInstanced, &hookDrawArraysInstanced);
+    replace(g_drawElementsInstanced, glad_glDrawElementsInstanced, &hookDrawElementsInstanced);
+    replace(g_bindTexture, glad_glBindTexture, &hookBindTexture);
+    replace(g_bindVertexArray, glad_glBindVertexArray, &hookBindVertexArray);
+#endif
+    g_installed = true;
+}
+
+void RenderStats::uninstall() {
+    if (!g_installed)
+        return;
+#if defined(GRAPHICS_API_OPENGL_33)
+    rlSetRenderBatchActive(nullptr); // opróżnia nasz batch, wraca domyślny
+    rlUnloadRenderBatch(g_batch);
+    g_batch = rlRenderBatch{};
+
+    restore(g_drawArrays, glad_glDrawArrays);
+    restore(g_drawElements, glad_glDrawElements);
+    restore(g_drawArraysInstanced, glad_glDrawArraysInstanced);
+    restore(g_drawElementsInstanced, glad_glDrawElementsInstanced);
+    restore(g_bindTexture, glad_glBindTexture);
+    restore(g_bindVertexArray, glad_glBindVertexArray);
+#endif
+    g_installed = false;
+}
+
+bool RenderStats::isInstalled() { return g_installed; }
+
+void RenderStats::setEnabled(bool enabled) { g_enabled = enabled; }
+
+bool RenderStats::isEnabled() { return g_enabled; }
+
+void RenderStats::beginFrame() {
+    g_frame = RenderFrameStats();
+    g_pass = RenderPass::Other;
+}
+
+void RenderStats::endFrame() {
+    g_lastFrame = g_frame;
+    if (!g_enabled || !Profiler::isEnabled())
+        return;
+
+    // Jeden tor licznika na metrykę, serie = przebiegi
+    for (size_t i = 0; i < static_cast<size_t>(RenderPass::Count); ++i) {
+        const char* pass = passName(static_cast<RenderPass>(i));
+        const RenderPassStats& stats = g_frame.passes[i];
+        Profiler::recordCounter("Draw calls", pass, stats.drawCalls);
+        Profiler::recordCounter("Vertices", pass, static_cast<double>(stats.vertices));
+        Profiler::recordCounter("Texture switches", pass, stats.textureSwitches);
+        Profiler::recordCounter("Batch flushes", pass, stats.batchFlushes);
+        Profiler::recordCounter("Forced flushes", pass, stats.forcedFlushes);
+    }
+}
+
+void RenderStats::flushBatch() {
+    if (g_enabled)
+        current().forcedFlushes++;
+    rlDrawRenderBatchActive();
+}
+
+RenderPass RenderStats::getPass() { return g_pass; }
+
+void RenderStats::setPass(RenderPass pass) {
+    if (pass == g_pass)
+        return;
+    // Geometria poprzedniego przebiegu czeka w batchu - rysujemy ją na jego konto
+    if (g_enabled && batchPending())
+        rlDrawRenderBatchActive();
+    g_pass = pass;
+}
+
+const RenderFrameStats& RenderStats::getLastFrame() { return g_lastFrame; }
+
+const char* RenderStats::passName(RenderPass pass) {
+    switch (pass) {
+    case RenderPass::Other:
+        return "other";
+    case RenderPass::Terrain:
+        return "terrain";
+    case RenderPass::Colony:
+        return "colony";
+    case RenderPass::Buildings:
+        return "buildings";
+    case RenderPass::Scene:
+        return "scene";
+    case RenderPass::UI:
+        return "ui";
+    case RenderPass::Count:
+        break;
+    }
+    return "?";
+}
+
+RenderPassScope::RenderPassScope(RenderPass pass) : m_previous(RenderStats::getPass()) {
+    RenderStats::setPass(pass);
+}
+
+RenderPassScope::~RenderPassScope() { RenderStats::setPass(m_previous); }
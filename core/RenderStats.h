@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Przebiegi klatki, do których przypisywane są wywołania rysowania
+enum class RenderPass : uint8_t {
+    Other,
+    Terrain,
+    Colony,
+    Buildings,
+    Scene, // reszta sceny 3D (przedmioty, interakcje, podgląd)
+    UI,
+    Count
+};
+
+struct RenderPassStats {
+    uint32_t drawCalls = 0;       // glDraw* (batch rlgl + meshe)
+    uint64_t vertices = 0;        // wierzchołki/indeksy wysłane do rysowania
+    uint64_t instances = 0;       // instancje w DrawMeshInstanced
+    uint32_t textureSwitches = 0; // zmiany związanej tekstury
+    uint32_t batchFlushes = 0;    // opróżnienia batcha rlgl (wszystkie)
+    uint32_t forcedFlushes = 0;   // z tego wymuszone przez kod gry
+
+    void add(const RenderPassStats& other);
+};
+
+struct RenderFrameStats {
+    RenderPassStats passes[static_cast<size_t>(RenderPass::Count)];
+    RenderPassStats total() const;
+};
+
+/**
+ * @brief Liczniki renderowania (wywołania rysowania, wierzchołki, zmiany
+ * tekstur, opróżnienia batcha) w podziale na przebiegi klatki.
+ *
+ * install() po InitWindow podmienia kilka wskaźników funkcji GL z glad
+ * (glDraw*, glBindTexture, glBindVertexArray) na cienkie nakładki i ustawia
+ * własny batch rlgl, żeby rozpoznać jego opróżnienia. Wyłączone liczniki
+ * kosztują jedno sprawdzenie flagi na wywołanie GL. W buildzie z rlsw
+ * (RENDER_BENCH) nie ma czego podmieniać - liczą się tylko flushBatch().
+ *
+ * RenderPassScope przypisuje wywołania do przebiegu. Przy włączonych
+ * licznikach granica przebiegu opróżnia niepusty batch, żeby geometria
+ * jednego przebiegu nie była liczona w następnym. Wymuszone opróżnienia
+ * w kodzie gry idą przez flushBatch().
+ *
+ * endFrame() zapisuje klatkę i, przy włączonym profilerze, dopisuje liczniki
+ * do Profiler (nakładka, eksport Chrome trace).
+ */
+class RenderStats {
+public:
+    static void install();
+    static void uninstall();
+    static bool isInstalled();
+
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    static void beginFrame();
+    static void endFrame();
+
+    /** rlDrawRenderBatchActive() liczone jako wymuszone opróżnienie */
+    static void flushBatch();
+
+    static RenderPass getPass();
+    static void setPass(RenderPass pass);
+
+    static const RenderFrameStats& getLastFrame();
+    static const char* passName(RenderPass pass);
+};
+
+class RenderPassScope {
+public:
+    explicit RenderPassScope(RenderPass pass);
+    ~RenderPassScope();
+
+    RenderPassScope(const RenderPassScope&) = delete;
+    RenderPassScope& operator=(const RenderPassScope&) = delete;
+
+private:
+    RenderPass m_previous;
+};
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <raylib.h>
+
+/**
+ * @brief Poziom szczegółowości symulacji (LOD) zależny od odległości.
+ */
+enum class SimLodTier : uint8_t {
+  Full,    // blisko obserwatora - aktualizacja co tick
+  Reduced, // średni dystans - co kilka ticków ze zgromadzoną deltą
+  Macro    // daleko - rzadkie, zgrubne kroki (ruch bez kolizji, praca
+           // liczona z dużej delty)
+};
+
+/**
+ * @brief Stan LOD pojedynczej encji (osadnik, zwierzę).
+ *
+ * Pominięte ticki nie giną - ich czas trafia do pendingDelta i jest oddany
+ * przy najbliższej aktualizacji. Interpolacja renderowania obejmuje cały
+ * czas, który pokryła ostatnia aktualizacja, więc encja na niższym poziomie
+ * porusza się płynnie, tylko z większym opóźnieniem.
+ */
+struct SimLodState {
+  SimLodTier tier = SimLodTier::Full;
+  float pendingDelta = 0.0f; // czas od ostatniej aktualizacji
+  float stepDelta = 0.0f;    // delta bieżącego ticku (0 = pominięty)
+  float tickDelta = 0.0f;    // długość ticku symulacji (do interpolacji)
+  float renderWindow = 0.0f; // czas, na który rozłożona jest interpolacja
+  float blendFrom = 1.0f;    // pokazany ułamek interpolacji w chwili
+                             // aktualizacji (ciągłość pozycji)
+
+  bool isMacro() const { return tier == SimLodTier::Macro; }
+
+  /**
+   * @brief Ułamek interpolacji prev -> bieżąca pozycja dla renderowania
+   * @param frameAlpha Reszta akumulatora stałego kroku (FixedTimestep)
+   */
+  float renderAlpha(float frameAlpha) const {
+    if (renderWindow <= 0.0f)
+      return frameAlpha;
+    return std::clamp((pendingDelta + frameAlpha * tickDelta) / renderWindow,
+                      0.0f, 1.0f);
+  }
+};
+
+/**
+ * @brief Przydziela encjom poziomy LOD symulacji wg odległości od
+ * obserwatora (sterowany osadnik albo kamera).
+ *
+ * Użycie (raz na tick dla każdej encji):
+ *   lod.beginTick();
+ *   float dt = lod.advance(entity.lodState, entity.pos, step, index);
+ *   if (dt > 0.0f) entity.update(dt);
+ *
+ * Aktualizacje na niższych poziomach są rozłożone między ticki (index),
+ * więc koszt ticku jest równy, a nie skokowy co N ticków. Histereza na
+ * granicach promieni zapobiega migotaniu poziomu przy obserwatorze
+ * stojącym na granicy.
+ */
+class SimulationLOD {
+public:
+  struct Config {
+    bool enabled = true;
+    float fullRadius = 40.0f;   // do tej odległości pełna symulacja
+    float macroRadius = 100.0f; // dalej symulacja zgrubna
+    float hysteresis = 5.0f;
+    int reducedInterval = 4; // co ile ticków na poziomie Reduced
+    int macroInterval = 15;  // co ile ticków na poziomie Macro
+  };
+
+  struct Stats {
+    size_t full = 0;
+    size_t reduced = 0;
+    size_t macro = 0;
+    size_t updated = 0; // encje zaktualizowane w tym ticku
+  };
+
+  void setViewer(Vector3 position) { m_viewer = position; }
+  Vector3 getViewer() const { return m_viewer; }
+
+  void beginTick() {
+    m_tick++;
+    m_stats = Stats();
+  }
+
+  /**
+   * @brief Wyznacza poziom encji i deltę do przekazania w tym ticku.
+   * @param staggerKey Rozkłada aktualizacje encji między ticki (np. indeks)
+   * @param forceFull Encja zawsze symulowana w pełni (sterowana przez gracza)
+   * @return Zgromadzona delta do symulacji albo 0, gdy tick jest pominięty
+   */
+  float advance(SimLodState &state, Vector3 position, float deltaTime,
+                size_t staggerKey, bool forceFull = false) {
+    SimLodTier tier = forceFull || !m_config.enabled
+                          ? SimLodTier::Full
+                          : classify(state.tier, position);
+    state.tier = tier;
+    state.tickDelta = deltaTime;
+    state.pendingDelta += deltaTime;
+
+    int interval = getInterval(tier);
+    float catchUp = state.pendingDelta - deltaTime;
+    // Zaległy czas ze starszego (rzadszego) poziomu oddajemy od razu po
+    // zmianie na częstszy - inaczej encja czekałaby pełny stary interwał
+    bool due = interval <= 1 ||
+               (m_tick + staggerKey) % static_cast<size_t>(interval) == 0 ||
+               catchUp >= deltaTime * (interval - 0.5f);
+
+    countTier(tier);
+    if (!due) {
+      state.stepDelta = 0.0f;
+      return 0.0f;
+    }
+
+    // Nowa interpolacja startuje z aktualnie pokazanej pozycji; niepokazana
+    // reszta poprzedniego okna wygasa stopniowo zamiast skoku pozycji
+    float shown = state.renderWindow > 0.0f
+                      ? std::min(state.pendingDelta / state.renderWindow, 1.0f)
+                      : 1.0f;
+    float unshown = std::max(state.renderWindow - state.pendingDelta, 0.0f);
+    state.blendFrom = shown;
+    state.stepDelta = state.pendingDelta;
+    state.renderWindow = state.stepDelta + unshown * 0.75f;
+    state.pendingDelta = 0.0f;
+    m_stats.updated++;
+    return state.stepDelta;
+  }
+
+  /**
+   * @brief Poziom dla jednorazowych zdarzeń (bez stanu i histerezy)
+   */
+  SimLodTier tierFor(Vector3 position) const {
+    return m_config.enabled ? classify(SimLodTier::Full, position)
+                            : SimLodTier::Full;
+  }
+
+  int getInterval(SimLodTier tier) const {
+    switch (tier) {
+    case SimLodTier::Reduced:
+      return std::max(m_config.reducedInterval, 1);
+    case SimLodTier::Macro:
+      return std::max(m_config.macroInterval, 1);
+    default:
+      return 1;
+    }
+  }
+
+  Config &getConfig() { return m_config; }
+  const Stats &getStats() const { return m_stats; }
+
+private:
+  SimLodTier classify(SimLodTier current, Vector3 position) const {
+    float dx = position.x - m_viewer.x;
+    float dz = position.z - m_viewer.z;
+    float distSq = dx * dx + dz * dz;
+
+    // Granica przesunięta na korzyść bieżącego poziomu (histereza)
+    float fullEdge = m_config.fullRadius +
+                     (current == SimLodTier::Full ? m_config.hysteresis
+                                                  : -m_config.hysteresis);
+    float macroEdge = m_config.macroRadius +
+                      (current == SimLodTier::Macro ? -m_config.hysteresis
+                                                    : m_config.hysteresis);
+    if (distSq <= fullEdge * fullEdge)
+      return SimLodTier::Full;
+    if (distSq <= macroEdge * macroEdge)
+      return SimLodTier::Reduced;
+    return SimLodTier::Macro;
+  }
+
+  void countTier(SimLodTier tier) {
+    switch (tier) {
+    case SimLodTier::Full:
+      m_stats.full++;
+      break;
+    case SimLodTier::Reduced:
+      m_stats.reduced++;
+      break;
+    case SimLodTier::Macro:
+      m_stats.macro++;
+      break;
+    }
+  }
+
+  Config m_config;
+  Stats m_stats;
+  Vector3 m_viewer = {0.0f, 0.0f, 0.0f};
+  size_t m_tick = 0;
+};
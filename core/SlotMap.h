@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Uchwyt do elementu SlotMap: indeks slotu + generacja.
+ * Po usunięciu elementu generacja slotu rośnie, więc stary uchwyt
+ * przestaje pasować nawet gdy slot zostanie ponownie użyty.
+ */
+struct SlotHandle {
+  static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+  uint32_t index = INVALID_INDEX;
+  uint32_t generation = 0;
+
+  bool isValid() const { return index != INVALID_INDEX; }
+  uint64_t value() const {
+    return (static_cast<uint64_t>(generation) << 32) | index;
+  }
+  bool operator==(const SlotHandle &other) const {
+    return index == other.index && generation == other.generation;
+  }
+  bool operator!=(const SlotHandle &other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Gęsty magazyn obiektów adresowanych uchwytami.
+ *
+ * Obiekty leżą w ciągłym wektorze (iteracja bez dziur), sloty tłumaczą
+ * uchwyt na pozycję w nim. insert/erase/get są O(1): erase przenosi
+ * ostatni obiekt na miejsce usuniętego. Wskaźniki do obiektów są ważne
+ * tylko do następnego insert/erase - trwały jest uchwyt.
+ */
+template <typename T> class SlotMap {
+public:
+  SlotHandle insert(T value) {
+    uint32_t slotIndex;
+    if (!m_freeSlots.empty()) {
+      slotIndex = m_freeSlots.back();
+      m_freeSlots.pop_back();
+    } else {
+      slotIndex = static_cast<uint32_t>(m_slots.size());
+      m_slots.push_back(Slot());
+    }
+
+    Slot &slot = m_slots[slotIndex];
+    slot.dense = static_cast<uint32_t>(m_dense.size());
+    m_dense.push_back(std::move(value));
+    m_denseToSlot.push_back(slotIndex);
+    return SlotHandle{slotIndex, slot.generation};
+  }
+
+  bool erase(SlotHandle handle) {
+    if (!contains(handle))
+      return false;
+
+    Slot &slot = m_slots[handle.index];
+    uint32_t dense = slot.dense;
+    uint32_t last = static_cast<uint32_t>(m_dense.size() - 1);
+    if (dense != last) {
+      m_dense[dense] = std::move(m_dense[last]);
+      m_denseToSlot[dense] = m_denseToSlot[last];
+      m_slots[m_denseToSlot[dense]].dense = dense;
+    }
+    m_dense.pop_back();
+    m_denseToSlot.pop_back();
+
+    slot.generation++;
+    slot.dense = SlotHandle::INVALID_INDEX;
+    m_freeSlots.push_back(handle.index);
+    return true;
+  }
+
+  bool contains(SlotHandle handle) const {
+    return handle.index < m_slots.size() &&
+           m_slots[handle.index].generation == handle.generation &&
+           m_slots[handle.index].dense != SlotHandle::INVALID_INDEX;
+  }
+
+  T *get(SlotHandle handle) {
+    return contains(handle) ? &m_dense[m_slots[handle.index].dense] : nullptr;
+  }
+  const T *get(SlotHandle handle) const {
+    return contains(handle) ? &m_dense[m_slots[handle.index].dense] : nullptr;
+  }
+
+  /** Uchwyt obiektu na pozycji i gęstej tablicy */
+  SlotHandle handleAt(size_t i) const {
+    uint32_t slotIndex = m_denseToSlot[i];
+    return SlotHandle{slotIndex, m_slots[slotIndex].generation};
+  }
+
+  size_t size() const { return m_dense.size(); }
+  bool empty() const { return m_dense.empty(); }
+
+  void clear() {
+    // Generacje zostają - stare uchwyty nie ożyją po clear()
+    for (uint32_t slotIndex : m_denseToSlot) {
+      m_slots[slotIndex].generation++;
+      m_slots[slotIndex].dense = SlotHandle::INVALID_INDEX;
+      m_freeSlots.push_back(slotIndex);
+    }
+    m_dense.clear();
+    m_denseToSlot.clear();
+  }
+
+  typename std::vector<T>::iterator begin() { return m_dense.begin(); }
+  typename std::vector<T>::iterator end() { return m_dense.end(); }
+  typename std::vector<T>::const_iterator begin() const {
+    return m_dense.begin();
+  }
+  typename std::vector<T>::const_iterator end() const { return m_dense.end(); }
+
+private:
+  struct Slot {
+    uint32_t dense = SlotHandle::INVALID_INDEX;
+    uint32_t generation = 0;
+  };
+
+  std::vector<T> m_dense;
+  std::vector<uint32_t> m_denseToSlot;
+  std::vector<Slot> m_slots;
+  std::vector<uint32_t> m_freeSlots;
+};
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * @brief 32-bitowy symbol dla często porównywanych identyfikatorów
+ * (blueprinty, magazyny, typy zasobów).
+ *
+ * Wartość symbolu to FNV-1a z tekstu, więc "floor"_sid liczony w czasie
+ * kompilacji jest równy StringInterner::intern("floor") w runtime.
+ * Porównanie dwóch symboli to porównanie dwóch liczb.
+ */
+constexpr uint32_t fnv1a32(const char *str, size_t length) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; ++i) {
+    hash ^= static_cast<uint8_t>(str[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+struct StringId {
+  uint32_t value = 0; // 0 = brak identyfikatora (pusty string)
+
+  constexpr StringId() = default;
+  constexpr explicit StringId(uint32_t v) : value(v) {}
+
+  // Sam hash bez rejestracji w interner - do zapytań w gorących ścieżkach
+  static constexpr StringId of(std::string_view str) {
+    return str.empty() ? StringId() : StringId(fnv1a32(str.data(), str.size()));
+  }
+
+  constexpr bool isValid() const { return value != 0; }
+  constexpr bool operator==(StringId other) const { return value == other.value; }
+  constexpr bool operator!=(StringId other) const { return value != other.value; }
+  constexpr bool operator<(StringId other) const { return value < other.value; }
+
+  // Tekst symbolu (tylko dla zinternowanych, do logów/UI)
+  const std::string &str() const;
+};
+
+constexpr StringId operator""_sid(const char *str, size_t length) {
+  return StringId::of(std::string_view(str, length));
+}
+
+struct StringIdHash {
+  size_t operator()(StringId id) const { return id.value; }
+};
+
+/**
+ * @brief Globalny rejestr symbol -> tekst.
+ *
+ * intern() wołamy przy tworzeniu obiektów (blueprint, magazyn, przedmiot),
+ * nie w pętli gry. Wykrywa kolizje hashy i zgłasza je w logu.
+ */
+class StringInterner {
+public:
+  static StringId intern(std::string_view str) {
+    StringId id = StringId::of(str);
+    if (!id.isValid())
+      return id;
+
+    {
+      std::shared_lock<std::shared_mutex> lock(mutex());
+      auto it = table().find(id.value);
+      if (it != table().end()) {
+        if (it->second != str) {
+          std::cerr << "[StringInterner] Hash collision: '" << str
+                    << "' vs '" << it->second << "'" << std::endl;
+        }
+        return id;
+      }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex());
+    table().emplace(id.value, std::string(str));
+    return id;
+  }
+
+  static const std::string &lookup(StringId id) {
+    static const std::string empty;
+    std::shared_lock<std::shared_mutex> lock(mutex());
+    auto it = table().find(id.value);
+    return it != table().end() ? it->second : empty;
+  }
+
+  static size_t size() {
+    std::shared_lock<std::shared_mutex> lock(mutex());
+    return table().size();
+  }
+
+private:
+  static std::unordered_map<uint32_t, std::string> &table() {
+    static std::unordered_map<uint32_t, std::string> strings;
+    return strings;
+  }
+
+  static std::shared_mutex &mutex() {
+    static std::shared_mutex m;
+    return m;
+  }
+};
+
+inline const std::string &StringId::str() const {
+  return StringInterner::lookup(*this);
+}
+
+/**
+ * @brief Znane identyfikatory liczone w czasie kompilacji.
+ */
+namespace Ids {
+// Blueprinty
+inline constexpr StringId Floor = "floor"_sid;
+inline constexpr StringId Wall = "wall"_sid;
+inline constexpr StringId Door = "door"_sid;
+inline constexpr StringId Bed = "bed"_sid;
+inline constexpr StringId Stockpile = "stockpile"_sid;
+inline constexpr StringId SimpleStorage = "simple_storage"_sid;
+inline constexpr StringId Storehouse = "storehouse"_sid;
+inline constexpr StringId Sawmill = "sawmill"_sid;
+inline constexpr StringId Blacksmith = "blacksmith"_sid;
+inline constexpr StringId Well = "well"_sid;
+inline constexpr StringId House4 = "house_4"_sid;
+inline constexpr StringId HouseSmall = "house_small"_sid;
+inline constexpr StringId Campfire = "campfire"_sid;
+inline constexpr StringId Taverna = "taverna"_sid;
+
+// Typy zasobów (nazwy jak w ResourceItem::getResourceType)
+inline constexpr StringId Wood = "Wood"_sid;
+inline constexpr StringId Stone = "Stone"_sid;
+inline constexpr StringId Food = "Food"_sid;
+inline constexpr StringId Metal = "Metal"_sid;
+inline constexpr StringId Gold = "Gold"_sid;
+inline constexpr StringId Water = "Water"_sid;
+} // namespace Ids
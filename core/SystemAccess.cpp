@@ -0,0 +1,29 @@
+#include "SystemAccess.h"
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <utility>
+
+namespace {
+std::mutex g_violationMutex;
+// Zgłaszamy każdą parę (system, typ) tylko raz - inaczej log co tick
+std::set<std::pair<std::string, std::string>> g_violations;
+} // namespace
+
+void SystemAccess::checkSlow(std::type_index type, Mode mode) {
+  if (t_current->allows(type, mode))
+    return;
+
+  std::string system = t_currentName ? *t_currentName : "?";
+  std::lock_guard<std::mutex> lock(g_violationMutex);
+  if (!g_violations.emplace(system, type.name()).second)
+    return;
+  std::cout << "[SystemAccess] " << system << " uses undeclared "
+            << (mode == Mode::Write ? "write" : "read") << " of "
+            << type.name() << std::endl;
+}
+
+size_t SystemAccess::getViolationCount() {
+  std::lock_guard<std::mutex> lock(g_violationMutex);
+  return g_violations.size();
+}
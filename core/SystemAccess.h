@@ -0,0 +1,124 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+
+/**
+ * @brief Deklaracja danych, które system czyta i zapisuje w update().
+ *
+ * Kluczem jest typ danych: komponent (StatsComponent), encja (Settler),
+ * współdzielony zasób (Colony, NavigationGrid) albo inny system
+ * (StorageSystem). GameEngine buduje z deklaracji graf zależności - dwa
+ * systemy bez konfliktu (zapis-zapis lub zapis-odczyt tego samego typu)
+ * mogą działać równolegle w JobSystem.
+ *
+ * System, który nic nie zadeklarował, jest traktowany jako wyłączny -
+ * konfliktuje ze wszystkimi i działa sam, w kolejności priorytetów.
+ *
+ * Przykład:
+ *   void declareAccess(SystemAccess &access) const override {
+ *     access.write<Settler>().read<BuildingInstance>();
+ *   }
+ */
+class SystemAccess {
+public:
+  enum class Mode { Read, Write };
+
+  template <typename T> SystemAccess &read() {
+    add(m_reads, typeid(T));
+    m_declared = true;
+    return *this;
+  }
+
+  template <typename T> SystemAccess &write() {
+    add(m_writes, typeid(T));
+    m_declared = true;
+    return *this;
+  }
+
+  /** update() woła raylib/GPU albo stan okna - tylko wątek główny */
+  SystemAccess &mainThread() {
+    m_mainThread = true;
+    m_declared = true;
+    return *this;
+  }
+
+  /** Stan własny systemu - zapisywany przez niego, czytany przez innych */
+  void setOwner(std::type_index owner) { add(m_writes, owner); }
+
+  bool isDeclared() const { return m_declared; }
+  bool needsMainThread() const { return m_mainThread; }
+
+  bool reads(std::type_index type) const { return contains(m_reads, type); }
+  bool writes(std::type_index type) const { return contains(m_writes, type); }
+  bool allows(std::type_index type, Mode mode) const {
+    return writes(type) || (mode == Mode::Read && reads(type));
+  }
+
+  /**
+   * @brief Czy dwa systemy nie mogą działać jednocześnie
+   */
+  bool conflictsWith(const SystemAccess &other) const {
+    if (!m_declared || !other.m_declared)
+      return true;
+    for (const auto &type : m_writes) {
+      if (other.writes(type) || other.reads(type))
+        return true;
+    }
+    for (const auto &type : m_reads) {
+      if (other.writes(type))
+        return true;
+    }
+    return false;
+  }
+
+  // ----- Tryb debug: wykrywanie niezadeklarowanego dostępu -----
+
+  /**
+   * @brief Włącza sprawdzanie getSystem/getComponent/GameSystem::get*
+   * względem deklaracji systemu, który działa na bieżącym wątku
+   */
+  static void setCheckEnabled(bool enabled) { s_checkEnabled = enabled; }
+  static bool isCheckEnabled() { return s_checkEnabled; }
+
+  /**
+   * @brief Ustawia system działający na bieżącym wątku (nullptr = brak)
+   */
+  static void setCurrent(const SystemAccess *access, const std::string *name) {
+    t_current = access;
+    t_currentName = name;
+  }
+
+  template <typename T> static void check(Mode mode) {
+    if (s_checkEnabled && t_current)
+      checkSlow(typeid(T), mode);
+  }
+
+  /** Liczba wykrytych (unikalnych) naruszeń od startu */
+  static size_t getViolationCount();
+
+private:
+  static void add(std::vector<std::type_index> &list, std::type_index type) {
+    if (!contains(list, type))
+      list.push_back(type);
+  }
+  static bool contains(const std::vector<std::type_index> &list,
+                       std::type_index type) {
+    return std::find(list.begin(), list.end(), type) != list.end();
+  }
+
+  static void checkSlow(std::type_index type, Mode mode);
+
+  std::vector<std::type_index> m_reads;
+  std::vector<std::type_index> m_writes;
+  bool m_declared = false;
+  bool m_mainThread = false;
+
+  inline static bool s_checkEnabled = false;
+  inline static thread_local const SystemAccess *t_current = nullptr;
+  inline static thread_local const std::string *t_currentName = nullptr;
+};
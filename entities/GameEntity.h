@@ -9,6 +9,7 @@
 #include <raylib.h> // Pozostawiam jedno dołączenie raylib.h
 
 #include "../core/IComponent.h"  // Poprawiona ścieżka do IComponent.h
+#include "../core/SystemAccess.h"
 
 class GameEntity {
 public:
@@ -47,6 +48,7 @@ public:
     // Zwraca std::shared_ptr<const T>
     template<typename T>
     std::shared_ptr<const T> getComponent() const {
+        SystemAccess::check<T>(SystemAccess::Mode::Read);
         auto it = m_components.find(typeid(T));
         if (it != m_components.end()) {
             // Użyj dynamic_pointer_cast do bezpiecznego rzutowania na typ T
@@ -59,6 +61,9 @@ public:
     // Zwraca std::shared_ptr<T>
     template<typename T>
     std::shared_ptr<T> getComponent() {
+        // Wersja non-const też służy głównie do odczytu - wymagamy tylko,
+        // żeby typ był zadeklarowany (odczyt albo zapis)
+        SystemAccess::check<T>(SystemAccess::Mode::Read);
         auto it = m_components.find(typeid(T));
         if (it != m_components.end()) {
             // Użyj dynamic_pointer_cast do bezpiecznego rzutowania na typ T
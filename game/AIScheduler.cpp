@@ -0,0 +1,100 @@
+#include "AIScheduler.h"
+#include "../core/FrameArena.h"
+#include "Settler.h"
+#include <algorithm>
+
+bool AIScheduler::isWaitingForDecision(const Settler *settler) const {
+  return settler->GetState() == SettlerState::IDLE &&
+         !settler->HasQueuedActions() && !settler->isPlayerControlled() &&
+         settler->getStats().isAlive();
+}
+
+void AIScheduler::beginTick(const std::vector<Settler *> &settlers,
+                            uint32_t buildTaskGeneration) {
+  m_stats = Stats();
+  m_stats.avgDecisionMs = m_avgDecisionMs;
+
+  bool newBuildTask = buildTaskGeneration != m_lastBuildTaskGeneration;
+  m_lastBuildTaskGeneration = buildTaskGeneration;
+
+  FrameVector<Settler *> queue;
+  queue.reserve(settlers.size());
+
+  for (Settler *settler : settlers) {
+    AIScheduleInfo &info = settler->m_aiSchedule;
+    info.evaluating = false;
+    // Pominięty przez LOD - zdecyduje, gdy przyjdzie jego aktualizacja
+    if (settler->m_simLod.stepDelta <= 0.0f)
+      continue;
+    info.sinceDecision += settler->m_simLod.stepDelta;
+
+    // Zajęci osadnicy wykonują swoje zadania normalnie
+    if (!isWaitingForDecision(settler)) {
+      info.granted = true;
+      continue;
+    }
+
+    bool taskFinished = info.lastState != SettlerState::IDLE;
+    bool becameHungry = settler->NeedsFood() && !info.wasHungry;
+    bool becameTired = settler->NeedsSleep() && !info.wasTired;
+    if (taskFinished || becameHungry || becameTired ||
+        (newBuildTask && settler->performBuilding)) {
+      info.forced = true;
+    }
+    if (info.sinceDecision >= m_config.maxStaleness) {
+      info.forced = true;
+    }
+
+    info.granted = false;
+    queue.push_back(settler);
+  }
+
+  m_stats.candidates = queue.size();
+  if (queue.empty())
+    return;
+
+  // Wymuszone najpierw, potem najdłużej czekający
+  std::sort(queue.begin(), queue.end(), [](Settler *a, Settler *b) {
+    const AIScheduleInfo &ia = a->m_aiSchedule;
+    const AIScheduleInfo &ib = b->m_aiSchedule;
+    if (ia.forced != ib.forced)
+      return ia.forced;
+    return ia.sinceDecision > ib.sinceDecision;
+  });
+
+  size_t allowed = static_cast<size_t>(
+      m_config.budgetMs / std::max(m_avgDecisionMs, 0.001));
+  allowed = std::max(allowed, static_cast<size_t>(
+                                  std::max(m_config.minDecisionsPerTick, 0)));
+  allowed = std::min(allowed, queue.size());
+
+  for (size_t i = 0; i < allowed; ++i) {
+    AIScheduleInfo &info = queue[i]->m_aiSchedule;
+    info.granted = true;
+    info.evaluating = true;
+    if (info.forced)
+      m_stats.forced++;
+  }
+  m_stats.granted = allowed;
+  m_stats.deferred = queue.size() - allowed;
+}
+
+void AIScheduler::recordDecision(double ms) {
+  m_stats.spentMs += ms;
+  // Średnia krocząca - odporna na pojedyncze skoki (np. pathfinding)
+  m_avgDecisionMs = m_avgDecisionMs * 0.9 + ms * 0.1;
+  m_stats.avgDecisionMs = m_avgDecisionMs;
+}
+
+void AIScheduler::endTick(const std::vector<Settler *> &settlers) {
+  for (Settler *settler : settlers) {
+    AIScheduleInfo &info = settler->m_aiSchedule;
+    if (settler->m_simLod.stepDelta <= 0.0f)
+      continue;
+    if (info.granted)
+      info.forced = false;
+    info.lastState = settler->GetState();
+    info.wasHungry = settler->NeedsFood();
+    info.wasTired = settler->NeedsSleep();
+  }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Settler;
+
+/**
+ * @brief Rozkłada decyzje osadników w czasie (time slicing).
+ *
+ * Osadnik w stanie IDLE bez kolejki akcji przeszukuje świat w poszukiwaniu
+ * pracy - robienie tego przez wszystkich co tick kosztuje proporcjonalnie do
+ * liczby osadników. Scheduler co tick przydziela prawo do decyzji tylko tylu
+ * osadnikom, ilu zmieści się w budżecie czasu (średni koszt decyzji jest
+ * mierzony na bieżąco).
+ *
+ * Kolejność: najpierw wymuszone (zakończone zadanie, przekroczony próg
+ * głodu/zmęczenia, nowe zadanie budowy) i czekający dłużej niż
+ * maxStaleness, potem najdłużej czekający - co daje round-robin przy
+ * równym obciążeniu. Koszt ticku nie rośnie z liczbą osadników, rośnie
+ * tylko czas oczekiwania na decyzję.
+ */
+class AIScheduler {
+public:
+  struct Config {
+    double budgetMs = 0.5;      // budżet decyzji na tick
+    int minDecisionsPerTick = 1; // gwarancja postępu przy drogich decyzjach
+    float maxStaleness = 1.0f;  // s - po tym czasie pierwszeństwo jak wymuszona
+  };
+
+  struct Stats {
+    size_t candidates = 0; // osadnicy czekający na decyzję w tym ticku
+    size_t granted = 0;
+    size_t forced = 0;
+    size_t deferred = 0;
+    double spentMs = 0.0;      // zmierzony czas przydzielonych osadników
+    double avgDecisionMs = 0.0; // średnia krocząca kosztu jednej decyzji
+  };
+
+  /**
+   * @brief Przydziela decyzje na bieżący tick (przed aktualizacją osadników)
+   *
+   * Osadnicy pominięci w tym ticku przez LOD symulacji (stepDelta == 0) nie
+   * biorą udziału w przydziale - czas oczekiwania liczy się z ich delty.
+   * @param buildTaskGeneration Licznik BuildingSystem - zmiana oznacza nowe
+   *        zadanie budowy i wymusza ocenę bezczynnych budowniczych
+   */
+  void beginTick(const std::vector<Settler *> &settlers,
+                 uint32_t buildTaskGeneration);
+
+  /**
+   * @brief Zgłasza zmierzony czas aktualizacji osadnika z przydziałem
+   */
+  void recordDecision(double ms);
+
+  /**
+   * @brief Zapamiętuje stan osadników po ticku (wykrywanie przejść)
+   */
+  void endTick(const std::vector<Settler *> &settlers);
+
+  Config &getConfig() { return m_config; }
+  const Stats &getStats() const { return m_stats; }
+
+private:
+  bool isWaitingForDecision(const Settler *settler) const;
+
+  Config m_config;
+  Stats m_stats;
+  double m_avgDecisionMs = 0.05;
+  uint32_t m_lastBuildTaskGeneration = 0;
+};
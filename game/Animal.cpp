@@ -2,6 +2,8 @@
 #include "Colony.h"
 #include "../systems/ResourceTypes.h"
 #include "../game/Item.h"
+#include "../core/FixedTimestep.h"
+#include <algorithm>
 #include <cmath>
 #include <raymath.h>
 #include <rlgl.h>  // Dla rlPushMatrix, rlRotatef, etc.
@@ -11,6 +13,7 @@ Animal::Animal(AnimalType type, Vector3 position)
     , BaseInteractableObject((type == AnimalType::RABBIT) ? "Krolik" : "Jelen", InteractionType::HUNTING, position, 2.0f)
     , m_type(type)
     , m_targetPosition(position)
+    , m_prevPosition(position)
     , m_moveTimer(0.0f)
     , m_idleTimer(0.0f)
     , m_isMoving(false)
@@ -31,6 +34,7 @@ Animal::Animal(AnimalType type, Vector3 position)
 }
 
 void Animal::update(float deltaTime) {
+    m_prevPosition = Vector3Lerp(m_prevPosition, getPosition(), m_simLod.blendFrom);
     updateAI(deltaTime);
     
     // Note: We do NOT call m_stats->update(deltaTime) here.
@@ -39,8 +43,24 @@ void Animal::update(float deltaTime) {
     // Only health is managed via takeDamage.
 }
 
+Vector3 Animal::getRenderPosition() const {
+    // Interpolacja między tickami symulacji (stały krok)
+    return Vector3Lerp(m_prevPosition, getPosition(),
+                       m_simLod.renderAlpha(FixedTimestep::getRenderAlpha()));
+}
+
+Matrix Animal::getRenderTransform() const {
+    // To samo co rlTranslatef / rlRotatef(Y) / rlRotatef(Z) w render()
+    Vector3 pos = getRenderPosition();
+    Matrix transform = MatrixMultiply(MatrixRotateY(m_rotation),
+                                      MatrixTranslate(pos.x, 0.0f, pos.z));
+    if (isDead())
+        transform = MatrixMultiply(MatrixRotateZ(m_deathRoll * DEG2RAD), transform);
+    return transform;
+}
+
 void Animal::render() {
-    Vector3 pos = getPosition();
+    Vector3 pos = getRenderPosition();
     Color color = (m_type == AnimalType::RABBIT) ? BROWN : DARKBROWN;
     
     // Zastosuj rotację - zapisz stan macierzy
@@ -110,7 +130,12 @@ void Animal::render() {
     
     rlPopMatrix();  // Przywróć stan macierzy
     
-    // Health bar - TYLKO GDY HP < 100% ORAZ JEŚLI ŻYJE
+    renderHealthBar();
+}
+
+void Animal::renderHealthBar() const {
+    Vector3 pos = getRenderPosition();
+    // TYLKO GDY HP < 100% ORAZ JEŚLI ŻYJE
     if (m_stats && m_stats->isAlive() && m_stats->getCurrentHealth() < m_stats->getMaxHealth()) {
         Vector3 barPos = { pos.x, pos.y + 1.2f, pos.z };
         float healthPct = m_stats->getCurrentHealth() / m_stats->getMaxHealth();
@@ -247,7 +272,8 @@ void Animal::updateAI(float deltaTime) {
             // Model orientation
             m_rotation = atan2f(-dir.x, -dir.z);
             
-            Vector3 newPos = Vector3Add(currentPos, Vector3Scale(dir, m_moveSpeed * deltaTime));
+            // Duża delta (LOD) nie może przeskoczyć celu
+            Vector3 newPos = Vector3Add(currentPos, Vector3Scale(dir, std::min(m_moveSpeed * deltaTime, dist)));
             newPos.y = 0.0f;
             
             auto* posComp = getComponent<PositionComponent>();
@@ -4,6 +4,7 @@
 #include "InteractableObject.h"
 #include "../components/StatsComponent.h"
 #include "../components/PositionComponent.h"
+#include "../core/SimulationLOD.h"
 #include <memory>
 #include <string>
 
@@ -20,6 +21,12 @@ public:
 
     void update(float deltaTime);
     void render();
+    /** Pasek zdrowia nad zranionym zwierzęciem (też przy proxy LOD) */
+    void renderHealthBar() const;
+    /** Pozycja interpolowana między tickami symulacji */
+    Vector3 getRenderPosition() const;
+    /** Przewrót po śmierci, obrót Y i pozycja na ziemi - proxy LOD */
+    Matrix getRenderTransform() const;
 
     // InteractableObject Interface Overrides (from BaseInteractableObject)
     // We can override these if needed or use BaseInteractableObject defaults
@@ -43,6 +50,9 @@ public:
     // Override isActive to keep body visible until skinned
     bool isActive() const override;
 
+    // Poziom LOD symulacji (ustawiany przez Colony)
+    SimLodState& getSimLod() { return m_simLod; }
+
 private:
     AnimalType m_type;
     std::unique_ptr<StatsComponent> m_stats;
@@ -51,11 +61,13 @@ private:
     
     // AI State
     Vector3 m_targetPosition;
+    Vector3 m_prevPosition;  // Pozycja z poprzedniego ticku (interpolacja)
     float m_moveTimer;
     float m_idleTimer;
     bool m_isMoving;
     float m_moveSpeed;
     float m_rotation;  // Rotacja w radianach (kierunek patrzenia)
+    SimLodState m_simLod;
 
     void updateAI(float deltaTime);
     void die();
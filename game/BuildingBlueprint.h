@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../core/StringId.h"
 #include "../systems/ResourceTypes.h"
 #include "raylib.h"
 #include "raymath.h"
@@ -37,18 +38,20 @@ struct BlueprintComponent {
 class BuildingBlueprint {
 public:
   BuildingBlueprint(std::string id, std::string name, BuildingCategory category)
-      : m_id(id), m_name(name), m_category(category), m_model({}),
-        m_walkable(false) {}
+      : m_id(id), m_sid(StringInterner::intern(m_id)), m_name(name),
+        m_category(category), m_model({}), m_walkable(false) {}
 
   // Keep old constructor for compatibility if needed
   BuildingBlueprint(std::string id, std::string name, std::string description)
-      : m_id(id), m_name(name), m_description(description),
+      : m_id(id), m_sid(StringInterner::intern(m_id)), m_name(name),
+        m_description(description),
         m_category(BuildingCategory::STRUCTURE), m_model({}),
         m_walkable(false) {}
 
   ~BuildingBlueprint() { unloadModel(); }
 
   const std::string &getId() const { return m_id; }
+  StringId getSid() const { return m_sid; }
   const std::string &getName() const { return m_name; }
   const std::string &getDescription() const { return m_description; }
   BuildingCategory getCategory() const { return m_category; }
@@ -123,6 +126,7 @@ public:
 
 private:
   std::string m_id;
+  StringId m_sid;
   std::string m_name;
   std::string m_description;
   BuildingCategory m_category;
@@ -0,0 +1,264 @@
+#include "BuildingChunkMeshes.h"
+#include "../core/Profiler.h"
+#include "../systems/BuildingSystem.h"
+#include "BuildingBlueprint.h"
+#include "BuildingInstance.h"
+#include "RenderCulling.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+constexpr float kEdgeThickness = 0.03f;
+
+bool hasUsableModel(const BuildingBlueprint *blueprint) {
+  const Model *model = blueprint ? blueprint->getModel() : nullptr;
+  return model && model->meshCount > 0 && model->materialCount > 0;
+}
+
+// Geometria jednego chunka składana na CPU (trójkąty bez indeksów)
+class ChunkBuilder {
+public:
+  void append(const BuildingRenderPiece &piece) {
+    m_pieces++;
+    Matrix placement =
+        MatrixMultiply(MatrixRotateY(piece.rotation * DEG2RAD),
+                       MatrixTranslate(piece.position.x, piece.position.y,
+                                       piece.position.z));
+    if (hasUsableModel(piece.blueprint)) {
+      appendModel(*piece.blueprint->getModel(), placement, piece.modelColor);
+      return;
+    }
+
+    // Pudełko stoi na podstawie - środek podniesiony o połowę wysokości
+    Vector3 half = Vector3Scale(piece.blueprint->getSize(), 0.5f);
+    Matrix box = MatrixMultiply(MatrixTranslate(0.0f, half.y, 0.0f), placement);
+    appendBox(Vector3Negate(half), half, box, piece.boxColor);
+    if (piece.outlined)
+      appendEdges(half, box, piece.wireColor);
+  }
+
+  bool empty() const { return m_vertices.empty(); }
+  size_t pieces() const { return m_pieces; }
+  const BoundingBox &bounds() const { return m_bounds; }
+
+  Model upload() const {
+    Mesh mesh = {};
+    mesh.vertexCount = static_cast<int>(m_vertices.size() / 3);
+    mesh.triangleCount = mesh.vertexCount / 3;
+    mesh.vertices =
+        static_cast<float *>(MemAlloc(m_vertices.size() * sizeof(float)));
+    std::memcpy(mesh.vertices, m_vertices.data(),
+                m_vertices.size() * sizeof(float));
+    mesh.colors = static_cast<unsigned char *>(MemAlloc(m_colors.size()));
+    std::memcpy(mesh.colors, m_colors.data(), m_colors.size());
+    UploadMesh(&mesh, false);
+    return LoadModelFromMesh(mesh);
+  }
+
+private:
+  void addVertex(Vector3 position, Color color) {
+    if (m_vertices.empty()) {
+      m_bounds = BoundingBox{position, position};
+    } else {
+      m_bounds.min = Vector3Min(m_bounds.min, position);
+      m_bounds.max = Vector3Max(m_bounds.max, position);
+    }
+    m_vertices.insert(m_vertices.end(), {position.x, position.y, position.z});
+    m_colors.insert(m_colors.end(), {color.r, color.g, color.b, color.a});
+  }
+
+  // Odpowiednik DrawModelEx(model, ..., tint) - kolor materiału * tint
+  void appendModel(const Model &model, Matrix placement, Color tint) {
+    Matrix transform = MatrixMultiply(model.transform, placement);
+    for (int m = 0; m < model.meshCount; ++m) {
+      const Mesh &mesh = model.meshes[m];
+      int material = model.meshMaterial ? model.meshMaterial[m] : 0;
+      Color color = ColorTint(
+          model.materials[material].maps[MATERIAL_MAP_DIFFUSE].color, tint);
+      int count = mesh.indices ? mesh.triangleCount * 3 : mesh.vertexCount;
+      for (int i = 0; i < count; ++i) {
+        int v = mesh.indices ? mesh.indices[i] : i;
+        Vector3 position = {mesh.vertices[v * 3], mesh.vertices[v * 3 + 1],
+                            mesh.vertices[v * 3 + 2]};
+        Color vertexColor = color;
+        if (mesh.colors) {
+          const unsigned char *c = &mesh.colors[v * 4];
+          vertexColor = ColorTint(Color{c[0], c[1], c[2], c[3]}, color);
+        }
+        addVertex(Vector3Transform(position, transform), vertexColor);
+      }
+    }
+  }
+
+  void appendBox(Vector3 min, Vector3 max, Matrix transform, Color color) {
+    const Vector3 c[8] = {{min.x, min.y, min.z}, {max.x, min.y, min.z},
+                          {max.x, max.y, min.z}, {min.x, max.y, min.z},
+                          {min.x, min.y, max.z}, {max.x, min.y, max.z},
+                          {max.x, max.y, max.z}, {min.x, max.y, max.z}};
+    // Ściany CCW patrząc z zewnątrz
+    const int faces[6][4] = {{4, 5, 6, 7}, {1, 0, 3, 2}, {5, 1, 2, 6},
+                             {0, 4, 7, 3}, {3, 7, 6, 2}, {0, 1, 5, 4}};
+    for (const auto &face : faces) {
+      const int order[6] = {face[0], face[1], face[2],
+                            face[0], face[2], face[3]};
+      for (int index : order)
+        addVertex(Vector3Transform(c[index], transform), color);
+    }
+  }
+
+  // DrawCubeWires jako cienkie prostopadłościany wzdłuż 12 krawędzi
+  void appendEdges(Vector3 half, Matrix transform, Color color) {
+    const float t = kEdgeThickness * 0.5f;
+    for (float sa : {-1.0f, 1.0f}) {
+      for (float sb : {-1.0f, 1.0f}) {
+        float y = sa * half.y, z = sb * half.z;
+        appendBox({-half.x, y - t, z - t}, {half.x, y + t, z + t}, transform,
+                  color);
+        float x = sa * half.x;
+        appendBox({x - t, -half.y, z - t}, {x + t, half.y, z + t}, transform,
+                  color);
+        y = sb * half.y;
+        appendBox({x - t, y - t, -half.z}, {x + t, y + t, half.z}, transform,
+                  color);
+      }
+    }
+  }
+
+  std::vector<float> m_vertices;
+  std::vector<unsigned char> m_colors;
+  BoundingBox m_bounds{};
+  size_t m_pieces = 0;
+};
+} // namespace
+
+int64_t BuildingChunkMeshes::chunkKey(Vector3 position) const {
+  float size = std::max(m_config.chunkSize, 1.0f);
+  int32_t x = static_cast<int32_t>(std::floor(position.x / size));
+  int32_t z = static_cast<int32_t>(std::floor(position.z / size));
+  return (static_cast<int64_t>(x) << 32) ^ static_cast<uint32_t>(z);
+}
+
+void BuildingChunkMeshes::markDirty(Vector3 position) {
+  m_dirty.insert(chunkKey(position));
+}
+
+bool BuildingChunkMeshes::isDynamicPiece(const BuildingRenderPiece &piece) {
+  return piece.sid == Ids::Door || piece.sid == Ids::Bed;
+}
+
+bool BuildingChunkMeshes::canMerge(const BuildingRenderPiece &piece) {
+  if (!piece.blueprint || isDynamicPiece(piece))
+    return false;
+  if (!hasUsableModel(piece.blueprint))
+    return true; // pudełko zastępcze
+
+  // Scalona siatka ma tylko kolory wierzchołków - modele z teksturą zostają
+  const Model &model = *piece.blueprint->getModel();
+  for (int i = 0; i < model.materialCount; ++i) {
+    const Texture2D &texture =
+        model.materials[i].maps[MATERIAL_MAP_DIFFUSE].texture;
+    if (texture.id != 0 && texture.id != rlGetTextureIdDefault())
+      return false;
+  }
+  for (int i = 0; i < model.meshCount; ++i) {
+    if (!model.meshes[i].vertices)
+      return false;
+  }
+  return true;
+}
+
+bool BuildingChunkMeshes::prepare(const BuildingSystem &buildingSystem) {
+  m_stats.chunksDrawn = 0;
+  if (!m_config.enabled || !IsWindowReady())
+    return false;
+  if (!m_allDirty && m_dirty.empty())
+    return true;
+
+  PROFILE_ZONE("BuildingChunks::rebuild");
+  if (m_allDirty) {
+    for (const auto &chunk : m_chunks)
+      m_dirty.insert(chunk.first);
+  }
+
+  // Jedno przejście po budynkach: geometria brudnych chunków + lista
+  // budynków z elementami dynamicznymi (dla wszystkich chunków)
+  std::unordered_map<int64_t, ChunkBuilder> builders;
+  std::vector<BuildingRenderPiece> pieces;
+  m_dynamic.clear();
+  for (const auto &building : buildingSystem.getBuildings()) {
+    if (!building->isVisible())
+      continue;
+    int64_t key = chunkKey(building->getPosition());
+    bool rebuild = m_allDirty || m_dirty.count(key) > 0;
+    if (rebuild)
+      m_dirty.insert(key);
+
+    pieces.clear();
+    buildingSystem.collectRenderPieces(*building, pieces);
+    bool dynamic = !building->getStorageId().empty();
+    for (const BuildingRenderPiece &piece : pieces) {
+      if (!canMerge(piece))
+        dynamic = true;
+      else if (rebuild)
+        builders[key].append(piece);
+    }
+    if (dynamic)
+      m_dynamic.push_back(building.get());
+  }
+
+  for (int64_t key : m_dirty) {
+    auto it = m_chunks.find(key);
+    if (it != m_chunks.end()) {
+      UnloadModel(it->second.model);
+      m_chunks.erase(it);
+    }
+    auto builder = builders.find(key);
+    if (builder == builders.end() || builder->second.empty())
+      continue;
+    Chunk &chunk = m_chunks[key];
+    chunk.model = builder->second.upload();
+    chunk.bounds = builder->second.bounds();
+    chunk.pieces = builder->second.pieces();
+    m_stats.rebuilds++;
+  }
+  m_dirty.clear();
+  m_allDirty = false;
+  updateStats();
+  return true;
+}
+
+void BuildingChunkMeshes::draw(const RenderCulling &culling) {
+  for (const auto &entry : m_chunks) {
+    const Chunk &chunk = entry.second;
+    if (!culling.isBoxVisible(chunk.bounds))
+      continue;
+    DrawModel(chunk.model, Vector3{0.0f, 0.0f, 0.0f}, 1.0f, WHITE);
+    m_stats.chunksDrawn++;
+  }
+}
+
+void BuildingChunkMeshes::updateStats() {
+  m_stats.chunks = m_chunks.size();
+  m_stats.staticPieces = 0;
+  m_stats.vertices = 0;
+  for (const auto &entry : m_chunks) {
+    m_stats.staticPieces += entry.second.pieces;
+    m_stats.vertices += static_cast<size_t>(entry.second.model.meshes[0].vertexCount);
+  }
+  m_stats.dynamicBuildings = m_dynamic.size();
+}
+
+void BuildingChunkMeshes::clear() {
+  if (IsWindowReady()) {
+    for (auto &entry : m_chunks)
+      UnloadModel(entry.second.model);
+  }
+  m_chunks.clear();
+  m_dirty.clear();
+  m_dynamic.clear();
+  m_allDirty = true;
+  updateStats();
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "../core/StringId.h"
+#include <cstddef>
+#include <cstdint>
+#include <raylib.h>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class BuildingBlueprint;
+class BuildingInstance;
+class BuildingSystem;
+class RenderCulling;
+
+/**
+ * @brief Jeden element rysowany przez BuildingSystem::render - komponent
+ * złożonego budynku albo cały prosty budynek.
+ */
+struct BuildingRenderPiece {
+  StringId sid;                     // blueprint elementu
+  const BuildingBlueprint *blueprint = nullptr;
+  Vector3 position{};       // podstawa elementu
+  float rotation = 0.0f;    // stopnie wokół Y
+  Color modelColor = WHITE; // tint modelu
+  Color boxColor = GRAY;    // pudełko, gdy blueprint nie ma modelu
+  bool outlined = false;    // krawędzie pudełka
+  Color wireColor = BLACK;
+  bool component = false;
+};
+
+/**
+ * @brief Statyczna geometria ukończonych budynków scalona w siatki chunków.
+ *
+ * Ściany, podłogi i inne nieanimowane elementy budynków z jednego chunka XZ
+ * są składane na CPU w jeden Mesh z kolorami wierzchołków i rysowane jednym
+ * DrawModel. Chunk jest przebudowywany tylko po markDirty (postawienie,
+ * ukończenie, przesunięcie w edytorze, usunięcie budynku).
+ *
+ * Drzwi, łóżka, zawartość magazynów i modele z teksturą nie są scalane -
+ * ich budynki trafiają do getDynamicBuildings() i są rysowane po staremu.
+ * Bez okna prepare() zwraca false i BuildingSystem rysuje wszystko
+ * element po elemencie.
+ */
+class BuildingChunkMeshes {
+public:
+  struct Config {
+    bool enabled = true;
+    float chunkSize = 32.0f; // bok chunka (m)
+  };
+
+  struct Stats {
+    size_t chunks = 0;
+    size_t chunksDrawn = 0; // w ostatniej klatce
+    size_t staticPieces = 0;
+    size_t vertices = 0;
+    size_t dynamicBuildings = 0;
+    size_t rebuilds = 0; // przebudowane chunki od startu
+  };
+
+  void markDirty(Vector3 position);
+  void markAllDirty() { m_allDirty = true; }
+
+  /** Przebudowuje brudne chunki; false - rysować bez scalania */
+  bool prepare(const BuildingSystem &buildingSystem);
+  /** Rysuje widoczne chunki (wewnątrz BeginMode3D) */
+  void draw(const RenderCulling &culling);
+
+  /** Budynki z elementami rysowanymi osobno (ważne po prepare() == true) */
+  const std::vector<BuildingInstance *> &getDynamicBuildings() const {
+    return m_dynamic;
+  }
+
+  /** Czy element może trafić do siatki chunka */
+  static bool canMerge(const BuildingRenderPiece &piece);
+  /** Drzwi i łóżka mają własne obiekty z animacją/stanem */
+  static bool isDynamicPiece(const BuildingRenderPiece &piece);
+
+  Config &getConfig() { return m_config; }
+  const Stats &getStats() const { return m_stats; }
+  /** Zwalnia siatki z GPU; następny prepare() zbuduje wszystko od nowa */
+  void clear();
+
+private:
+  struct Chunk {
+    Model model{};
+    BoundingBox bounds{};
+    size_t pieces = 0;
+  };
+
+  int64_t chunkKey(Vector3 position) const;
+  void updateStats();
+
+  Config m_config;
+  Stats m_stats;
+  std::unordered_map<int64_t, Chunk> m_chunks;
+  std::unordered_set<int64_t> m_dirty;
+  bool m_allDirty = true;
+  std::vector<BuildingInstance *> m_dynamic;
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../core/StringId.h"
 #include "../entities/GameEntity.h"
 #include "../game/BuildingBlueprint.h"
 #include "../systems/StorageSystem.h" // Include full definition for StorageSlot
@@ -23,6 +24,7 @@ public:
   BuildingInstance(const std::string &blueprintId, const Vector3 &position,
                    float rotation)
       : GameEntity("Building_" + blueprintId), m_blueprintId(blueprintId),
+        m_blueprintSid(StringInterner::intern(blueprintId)),
         m_rotation(rotation), m_constructionProgress(0.0f), m_isBuilt(false),
         m_health(100.0f), m_maxHealth(100.0f), m_cachedBlueprint(nullptr) {
     setPosition(position); // Use base class setter
@@ -35,14 +37,17 @@ public:
   void setPosition(const Vector3 &position) override { m_position = position; }
 
   // Getters
-  std::string getBlueprintId() const { return m_blueprintId; }
+  const std::string &getBlueprintId() const { return m_blueprintId; }
+  // Symbol blueprintu - do porównań z Ids:: zamiast porównań stringów
+  StringId getBlueprintSid() const { return m_blueprintSid; }
   float getRotation() const { return m_rotation; }
   void setRotation(float rot) { m_rotation = rot; }
   float getConstructionProgress() const { return m_constructionProgress; }
   bool isBuilt() const { return m_isBuilt; }
   float getHealth() const { return m_health; }
   std::string getOwner() const { return m_owner; }
-  std::string getStorageId() const { return m_storageId; }
+  const std::string &getStorageId() const { return m_storageId; }
+  StringId getStorageSid() const { return m_storageSid; }
   BuildingBlueprint *getBlueprint() const { return m_cachedBlueprint; }
   struct VisualStorageSlot {
     Resources::ResourceType type;
@@ -84,7 +89,10 @@ public:
   }
 
   void setOwner(const std::string &owner) { m_owner = owner; }
-  void setStorageId(const std::string &id) { m_storageId = id; }
+  void setStorageId(const std::string &id) {
+    m_storageId = id;
+    m_storageSid = StringInterner::intern(id);
+  }
   void setBlueprint(BuildingBlueprint *bp) { m_cachedBlueprint = bp; }
 
   void setDoor(std::shared_ptr<Door> door) { m_door = door; }
@@ -110,7 +118,7 @@ public:
     float startZ = -spacing;
 
     // Check if blueprint ID is "stockpile" to use specific logic
-    if (m_blueprintId == "stockpile") {
+    if (m_blueprintSid == Ids::Stockpile) {
       // Stockpile layout logic (possibly wider grid)
       cols = 4;
       spacing = 0.6f;
@@ -163,13 +171,13 @@ public:
     Vector3 size = {2.0f, 3.0f, 2.0f}; // Default size
     if (m_cachedBlueprint) {
       size = m_cachedBlueprint->getSize();
-    } else if (m_blueprintId == "floor") {
+    } else if (m_blueprintSid == Ids::Floor) {
       size = {2.0f, 0.1f, 2.0f};
-    } else if (m_blueprintId == "wall") {
+    } else if (m_blueprintSid == Ids::Wall) {
       size = {2.0f, 3.0f, 0.5f};
-    } else if (m_blueprintId == "stockpile") {
+    } else if (m_blueprintSid == Ids::Stockpile) {
       size = {3.0f, 0.1f, 3.0f};
-    } else if (m_blueprintId == "house_4") {
+    } else if (m_blueprintSid == Ids::House4) {
       size = {4.0f, 3.0f, 4.0f};
     }
 
@@ -218,6 +226,7 @@ public:
 private:
   bool m_isVisible = true; // Default to visible
   std::string m_blueprintId;
+  StringId m_blueprintSid;
   float m_rotation;
   float m_constructionProgress;
   bool m_isBuilt;
@@ -225,6 +234,7 @@ private:
   float m_maxHealth;
   std::string m_owner;
   std::string m_storageId;
+  StringId m_storageSid;
 
   BuildingBlueprint *m_cachedBlueprint;
 
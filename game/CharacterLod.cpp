@@ -0,0 +1,147 @@
+#include "CharacterLod.h"
+#include "Animal.h"
+#include "InstancedRenderer.h"
+#include "Settler.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+void CharacterLod::beginFrame(const Camera3D &camera, float screenHeight) {
+  m_stats = Stats();
+  m_camera = camera;
+  m_screenHeight = screenHeight;
+
+  Vector3 forward =
+      Vector3Normalize(Vector3Subtract(camera.target, camera.position));
+  m_right = Vector3Normalize(Vector3CrossProduct(forward, camera.up));
+  m_up = Vector3CrossProduct(m_right, forward);
+  m_facing = Vector3Negate(forward);
+}
+
+float CharacterLod::worldPerPixel(Vector3 point) const {
+  if (m_screenHeight <= 0.0f)
+    return 0.0f;
+  if (m_camera.projection == CAMERA_ORTHOGRAPHIC)
+    return m_camera.fovy / m_screenHeight; // fovy = wysokość widoku w metrach
+  float distance = Vector3Distance(m_camera.position, point);
+  return 2.0f * distance * tanf(m_camera.fovy * 0.5f * DEG2RAD) /
+         m_screenHeight;
+}
+
+float CharacterLod::projectedPixels(Vector3 base, float height) const {
+  Vector3 center = {base.x, base.y + height * 0.5f, base.z};
+  float perPixel = worldPerPixel(center);
+  if (perPixel <= 0.0f)
+    return std::numeric_limits<float>::max();
+  return height / perPixel;
+}
+
+CharacterLodLevel CharacterLod::choose(Vector3 base, float height) {
+  CharacterLodLevel level = CharacterLodLevel::Full;
+  if (m_config.enabled && m_screenHeight > 0.0f) {
+    float pixels = projectedPixels(base, height);
+    if (pixels < m_config.proxyPixels)
+      level = CharacterLodLevel::Marker;
+    else if (pixels < m_config.fullPixels)
+      level = CharacterLodLevel::Proxy;
+  }
+
+  switch (level) {
+  case CharacterLodLevel::Full:
+    m_stats.full++;
+    break;
+  case CharacterLodLevel::Proxy:
+    m_stats.proxy++;
+    break;
+  case CharacterLodLevel::Marker:
+    m_stats.marker++;
+    break;
+  }
+  return level;
+}
+
+float CharacterLod::animalHeight(const Animal &animal) {
+  return animal.getType() == AnimalType::RABBIT ? 0.9f : 1.5f;
+}
+
+void CharacterLod::drawMarker(Vector3 base, float width, float height,
+                              Color color) {
+  // Daleko znacznik nie maleje poniżej markerPixels - postać nie znika
+  Vector3 center = Vector3Add(base, Vector3Scale(m_up, height * 0.5f));
+  float minSize = m_config.markerPixels * worldPerPixel(center);
+  width = std::max(width, minSize);
+  height = std::max(height, minSize);
+
+  InstancedRenderer &instances = InstancedRenderer::getInstance();
+  if (instances.isReady()) {
+    // Kolumny: prawo i góra kamery (skalowane), kierunek do kamery, pozycja
+    Matrix transform = {m_right.x * width, m_up.x * height, m_facing.x, base.x,
+                        m_right.y * width, m_up.y * height, m_facing.y, base.y,
+                        m_right.z * width, m_up.z * height, m_facing.z, base.z,
+                        0.0f,              0.0f,            0.0f,       1.0f};
+    instances.addMarker(transform, color);
+    return;
+  }
+  DrawCube(Vector3{base.x, base.y + height * 0.5f, base.z}, width, height,
+           width, color);
+}
+
+void CharacterLod::renderSettler(Settler &settler) {
+  Vector3 base = settler.getRenderPosition();
+  switch (choose(base, settlerHeight())) {
+  case CharacterLodLevel::Full:
+    settler.render();
+    return;
+  case CharacterLodLevel::Proxy: {
+    InstancedRenderer &instances = InstancedRenderer::getInstance();
+    if (instances.isReady()) {
+      instances.addSettlerProxy(settler);
+      return;
+    }
+    rlPushMatrix();
+    rlMultMatrixf(MatrixToFloat(settler.getRenderTransform()));
+    DrawCube({0.0f, 0.3f, 0.0f}, 0.4f, 0.5f, 0.15f, DARKBLUE);
+    DrawCube({0.0f, 0.9f, 0.0f}, 0.4f, 0.5f, 0.25f, settler.getRenderColor());
+    DrawCube({0.0f, 1.32f, 0.02f}, 0.25f, 0.25f, 0.25f,
+             Color{255, 220, 177, 255});
+    rlPopMatrix();
+    return;
+  }
+  case CharacterLodLevel::Marker:
+    drawMarker(base, 0.6f, settlerHeight(), settler.getRenderColor());
+    return;
+  }
+}
+
+void CharacterLod::renderAnimal(Animal &animal) {
+  Vector3 base = animal.getRenderPosition();
+  base.y = 0.0f; // zwierzęta stoją na y = 0 (jak w Animal::render)
+  bool rabbit = animal.getType() == AnimalType::RABBIT;
+  switch (choose(base, animalHeight(animal))) {
+  case CharacterLodLevel::Full:
+    animal.render();
+    return;
+  case CharacterLodLevel::Proxy: {
+    InstancedRenderer &instances = InstancedRenderer::getInstance();
+    if (instances.isReady()) {
+      instances.addAnimalProxy(animal);
+    } else {
+      rlPushMatrix();
+      rlMultMatrixf(MatrixToFloat(animal.getRenderTransform()));
+      if (rabbit)
+        DrawCube({0.0f, 0.3f, -0.1f}, 0.6f, 0.6f, 1.0f, BROWN);
+      else
+        DrawCube({0.0f, 0.75f, 0.0f}, 1.0f, 1.5f, 2.0f, DARKBROWN);
+      rlPopMatrix();
+    }
+    animal.renderHealthBar();
+    return;
+  }
+  case CharacterLodLevel::Marker:
+    drawMarker(base, rabbit ? 0.6f : 1.2f, animalHeight(animal),
+               rabbit ? BROWN : DARKBROWN);
+    return;
+  }
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <raylib.h>
+
+class Animal;
+class Settler;
+
+enum class CharacterLodLevel : uint8_t { Full, Proxy, Marker };
+
+/**
+ * @brief Poziom szczegółów rysowania osadników i zwierząt.
+ *
+ * Poziom wynika z rzutowanej wysokości postaci na ekranie (piksele):
+ *   Full   - pełny model z animacją (Settler::render, Animal::render),
+ *   Proxy  - jeden Mesh w pozie spoczynkowej przez InstancedRenderer,
+ *   Marker - kwadrat zwrócony do kamery, nie mniejszy niż markerPixels.
+ * Koszt postaci poza zbliżeniem to jedna macierz instancji, więc tysiące
+ * osadników w widoku RTS kosztują kilka wywołań rysowania.
+ *
+ * Raz na klatkę (przed BeginMode3D): beginFrame(kamera, wysokość ekranu).
+ * Bez instancjonowania Proxy i Marker rysują kilka pudełek natychmiastowo.
+ */
+class CharacterLod {
+public:
+  struct Config {
+    bool enabled = true;
+    float fullPixels = 48.0f;  // od tej wysokości pełny model
+    float proxyPixels = 12.0f; // od tej - proxy, poniżej znacznik
+    float markerPixels = 3.0f; // minimalny rozmiar znacznika
+  };
+
+  struct Stats {
+    size_t full = 0;
+    size_t proxy = 0;
+    size_t marker = 0;
+  };
+
+  static CharacterLod &getInstance() {
+    static CharacterLod instance;
+    return instance;
+  }
+
+  void beginFrame(const Camera3D &camera, float screenHeight);
+
+  /** Wybiera poziom dla postaci o danej wysokości i liczy go w Stats */
+  CharacterLodLevel choose(Vector3 base, float height);
+  /** Wysokość w pikselach postaci stojącej w base */
+  float projectedPixels(Vector3 base, float height) const;
+
+  void renderSettler(Settler &settler);
+  void renderAnimal(Animal &animal);
+
+  Config &getConfig() { return m_config; }
+  const Stats &getStats() const { return m_stats; }
+
+  static float settlerHeight() { return 1.8f; }
+  static float animalHeight(const Animal &animal);
+
+private:
+  CharacterLod() = default;
+
+  /** Jednostki świata na piksel ekranu w odległości punktu od kamery */
+  float worldPerPixel(Vector3 point) const;
+  void drawMarker(Vector3 base, float width, float height, Color color);
+
+  Config m_config;
+  Stats m_stats;
+  Camera3D m_camera{};
+  Vector3 m_right{1.0f, 0.0f, 0.0f};
+  Vector3 m_up{0.0f, 1.0f, 0.0f};
+  Vector3 m_facing{0.0f, 0.0f, 1.0f}; // od sceny do kamery
+  float m_screenHeight = 0.0f;
+};
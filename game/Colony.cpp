@@ -1,15 +1,23 @@
 #include "Colony.h"
-#include "../core/EventSystem.h"
+#include "../core/EventBus.h"
 #include "../core/GameEngine.h"
 #include "../core/GameSystem.h"
+#include "../core/JobSystem.h"
+#include "../core/Logger.h"
+#include "../core/Profiler.h"
 #include "../game/BuildingInstance.h"
 #include "../game/ColonyAI.h"
 #include "../systems/BuildingSystem.h"
 #include "../systems/InteractionSystem.h"
 #include "../systems/ResourceSystem.h"
 #include "../systems/StorageSystem.h"
+#include "CharacterLod.h"
+#include "InstancedRenderer.h"
+#include "RenderCulling.h"
 #include "Terrain.h"
+#include "WorldCommandBuffer.h"
 #include "raymath.h"
+#include <chrono>
 #include <cstdlib>
 #include <iostream>
 
@@ -193,34 +201,24 @@ void Colony::initialize() {
 
     // [EVENT BUS] Subscribe to Storage Changes
     EventBus::registerHandler<ItemAddedToStorageEvent>(
-        [this](const std::any &e) {
-          try {
-            const auto &event =
-                std::any_cast<const ItemAddedToStorageEvent &>(e);
-            if (event.resourceType == Resources::ResourceType::Wood)
-              m_cachedWood += event.amount;
-            else if (event.resourceType == Resources::ResourceType::Stone)
-              m_cachedStone += event.amount;
-            else if (event.resourceType == Resources::ResourceType::Food)
-              m_cachedFood += event.amount;
-          } catch (...) {
-          }
+        [this](const ItemAddedToStorageEvent &event) {
+          if (event.resourceType == Resources::ResourceType::Wood)
+            m_cachedWood += event.amount;
+          else if (event.resourceType == Resources::ResourceType::Stone)
+            m_cachedStone += event.amount;
+          else if (event.resourceType == Resources::ResourceType::Food)
+            m_cachedFood += event.amount;
         },
         "Colony_AddResource");
 
     EventBus::registerHandler<ItemRemovedFromStorageEvent>(
-        [this](const std::any &e) {
-          try {
-            const auto &event =
-                std::any_cast<const ItemRemovedFromStorageEvent &>(e);
-            if (event.resourceType == Resources::ResourceType::Wood)
-              m_cachedWood -= event.amount;
-            else if (event.resourceType == Resources::ResourceType::Stone)
-              m_cachedStone -= event.amount;
-            else if (event.resourceType == Resources::ResourceType::Food)
-              m_cachedFood -= event.amount;
-          } catch (...) {
-          }
+        [this](const ItemRemovedFromStorageEvent &event) {
+          if (event.resourceType == Resources::ResourceType::Wood)
+            m_cachedWood -= event.amount;
+          else if (event.resourceType == Resources::ResourceType::Stone)
+            m_cachedStone -= event.amount;
+          else if (event.resourceType == Resources::ResourceType::Food)
+            m_cachedFood -= event.amount;
         },
         "Colony_RemoveResource");
 
@@ -235,31 +233,95 @@ void Colony::cleanup() {
 void Colony::update(float deltaTime, float currentTime,
                     const std::vector<std::unique_ptr<Tree>> &trees,
                     const std::vector<BuildingInstance *> &buildings) {
+  PROFILE_ZONE("Colony::update");
   // Auto-test for Concurrency & Stone & Inventory - REMOVED after verification
 
-  if (m_ai) {
-    m_ai->update(deltaTime);
-  }
+  // Punkt synchronizacji: komendy zapisane poza kolonią od ostatniego ticka
+  // (upadające drzewa, podniesienie przez gracza, systemy silnika)
+  WorldCommandBuffer::playback(*this);
 
-  // DEBUG: Check resources count periodically (every ~60 frames or so, or once
-  // per update if needed)
-  static int updateCounter = 0;
-  if (updateCounter++ % 60 == 0) {
-    std::cout << "DEBUG Colony: ResourceNodes count: " << m_resourceNodes.size()
-              << std::endl;
+  // LOD symulacji: dalecy osadnicy dostają zgromadzoną deltę co kilka ticków
+  // (stepDelta == 0 oznacza pominięcie w tym ticku)
+  m_simLod.beginTick();
+  for (size_t i = 0; i < settlers.size(); ++i) {
+    Settler *settler = settlers[i];
+    m_simLod.advance(settler->m_simLod, settler->getPosition(), deltaTime, i,
+                     settler->isPlayerControlled());
   }
 
-  for (auto *settler : settlers) {
-    // Pass our own resources to settler
-    settler->Update(deltaTime, currentTime, trees, m_droppedItemsStorage,
-                    bushes, buildings, m_animals, m_resourceNodes);
+  // Przydział decyzji bezczynnym osadnikom (przed ColonyAI i Think)
+  m_aiScheduler.beginTick(settlers,
+                          g_buildingSystem
+                              ? g_buildingSystem->getBuildTaskGeneration()
+                              : 0);
+
+  if (m_ai) {
+    m_ai->update(deltaTime);
   }
-  // Update animals
-  for (auto &animal : m_animals) {
-    if (animal->isActive()) {
-      animal->update(deltaTime);
+
+  // DEBUG: Check resources count periodically (limit miejsca wywołania)
+  LOG_RATE(Debug, Colony, 1, "ResourceNodes count: ", m_resourceNodes.size());
+
+  // Faza 1 (równolegle): osadnicy wyszukują cele na niezmienionym świecie
+  SettlerWorldView worldView{trees, m_droppedItemsStorage, bushes, m_animals,
+                             m_resourceNodes};
+  {
+    PROFILE_ZONE("Colony::think");
+    WorldCommandBuffer::Batch thinkBatch;
+    JobSystem::getInstance().parallelFor(
+        settlers.size(), 16, [&](size_t begin, size_t end) {
+          PROFILE_ZONE("Colony::thinkChunk");
+          for (size_t i = begin; i < end; ++i) {
+            if (settlers[i]->m_simLod.stepDelta > 0.0f) {
+              WorldCommandBuffer::EntityScope scope((uint32_t)i + 1);
+              settlers[i]->Think(worldView);
+            }
+          }
+        });
+  }
+
+  // Faza 2 (szeregowo): zatwierdzenie - rezerwacje i zmiany stanu świata.
+  // Spawny/dropy trafiają do bufora komend, nie do iterowanych wektorów.
+  {
+    PROFILE_ZONE("Colony::commit");
+    WorldCommandBuffer::Batch updateBatch;
+    for (size_t i = 0; i < settlers.size(); ++i) {
+      Settler *settler = settlers[i];
+      WorldCommandBuffer::EntityScope scope((uint32_t)i + 1);
+      float settlerDelta = settler->m_simLod.stepDelta;
+      if (settlerDelta <= 0.0f)
+        continue;
+      // Pass our own resources to settler
+      if (!settler->m_aiSchedule.evaluating) {
+        settler->Update(settlerDelta, currentTime, trees, m_droppedItemsStorage,
+                        bushes, buildings, m_animals, m_resourceNodes);
+        continue;
+      }
+      // Mierzony koszt decyzji steruje liczbą przydziałów w kolejnych tickach
+      auto decisionStart = std::chrono::steady_clock::now();
+      settler->Update(settlerDelta, currentTime, trees, m_droppedItemsStorage,
+                      bushes, buildings, m_animals, m_resourceNodes);
+      m_aiScheduler.recordDecision(
+          std::chrono::duration<double, std::milli>(
+              std::chrono::steady_clock::now() - decisionStart)
+              .count());
     }
   }
+  m_aiScheduler.endTick(settlers);
+  // Pociski i upuszczone przedmioty z fazy Update działają jeszcze w tym
+  // ticku (przed sprzątaniem pendingRemoval), jak przy wykonaniu inline
+  WorldCommandBuffer::playback(*this);
+  // Update animals (LOD jak u osadników, przesunięte za nimi w rozkładzie)
+  for (size_t i = 0; i < m_animals.size(); ++i) {
+    Animal *animal = m_animals[i].get();
+    if (!animal->isActive())
+      continue;
+    float animalDelta =
+        m_simLod.advance(animal->getSimLod(), animal->getPosition(), deltaTime,
+                         settlers.size() + i);
+    if (animalDelta > 0.0f)
+      animal->update(animalDelta);
+  }
   // Update projectiles
   for (auto &proj : m_projectiles) {
     proj->update(deltaTime);
@@ -268,10 +330,19 @@ void Colony::update(float deltaTime, float currentTime,
     if (proj->isActive()) {
       for (auto &animal : m_animals) {
         if (animal->isActive() && !animal->isDead()) {
-          // Simple distance check for collision (bullet radius 0.1 + animal
-          // radius approx 0.5)
-          if (Vector3Distance(proj->getPosition(), animal->getPosition()) <
-              0.6f) {
+          // Odległość od odcinka przebytego w tym ticku, nie tylko od punktu
+          // końcowego - szybki pocisk nie przeskoczy celu (bullet radius 0.1
+          // + animal radius approx 0.5)
+          Vector3 from = proj->getPreviousPosition();
+          Vector3 segment = Vector3Subtract(proj->getPosition(), from);
+          Vector3 toAnimal = Vector3Subtract(animal->getPosition(), from);
+          float segLenSq = Vector3LengthSqr(segment);
+          float t = segLenSq > 0.0f
+                        ? Clamp(Vector3DotProduct(toAnimal, segment) / segLenSq,
+                                0.0f, 1.0f)
+                        : 0.0f;
+          Vector3 closest = Vector3Add(from, Vector3Scale(segment, t));
+          if (Vector3Distance(closest, animal->getPosition()) < 0.6f) {
             animal->takeDamage(proj->getDamage());
             proj->deactivate();
             std::cout << "Projectile hit animal!" << std::endl;
@@ -326,7 +397,7 @@ void Colony::update(float deltaTime, float currentTime,
         if (terrain) {
           PositionComponent posComp(spawnPos);
           auto newTree = std::make_unique<Tree>(posComp, 100.0f, 50.0f);
-          terrain->addTree(std::move(newTree));
+          WorldCommandBuffer::spawnTree(std::move(newTree));
           std::cout << "[Nature] A new tree sprouted at " << spawnPos.x << ", "
                     << spawnPos.z << std::endl;
         }
@@ -334,36 +405,47 @@ void Colony::update(float deltaTime, float currentTime,
     }
     m_treeRespawnTimer = 10.0f; // Check every 10 seconds
   }
+  WorldCommandBuffer::playback(*this);
 }
 void Colony::render(bool isFPSMode, Settler *selectedSettler) {
+  PROFILE_ZONE("Colony::render");
   static int debugFrame = 0;
   debugFrame++;
   if (debugFrame % 300 == 0) { // Log every ~5 seconds
-    std::cout << "[Colony::render] isFPS: " << isFPSMode
-              << " Ptr: " << selectedSettler << std::endl;
+    LOG_DBG(Colony, "render isFPS: ", isFPSMode, " Ptr: ",
+            static_cast<const void *>(selectedSettler));
   }
 
+  // Zbiór widocznych z RenderCulling::cull (pętla główna, przed BeginMode3D)
+  const RenderCulling &culling = RenderCulling::getInstance();
+  // Poziom szczegółów z rzutowanej wysokości (CharacterLod::beginFrame)
+  CharacterLod &lod = CharacterLod::getInstance();
   for (auto *settler : settlers) {
     // Render FPS view for selected settler
     if (isFPSMode && settler == selectedSettler) {
       if (debugFrame % 300 == 0)
-        std::cout << " -> Rendering FPS for " << settler->getName()
-                  << std::endl;
+        LOG_DBG(Colony, " -> Rendering FPS for ", settler->getName());
       settler->render(true); // Unified render (hides head, applies FPS offsets)
       continue;
     }
-    settler->render();
+    if (culling.isVisible(settler))
+      lod.renderSettler(*settler);
   }
-  // Render resource nodes
+  // Render resource nodes (i krzewy niżej) - instancjonowane, jeśli się da
+  InstancedRenderer &instances = InstancedRenderer::getInstance();
+  bool instanced = instances.isReady();
   for (const auto &node : m_resourceNodes) {
-    if (node && node->isActive()) {
-      node->render();
+    if (node && node->isActive() && culling.isVisible(node.get())) {
+      if (instanced)
+        instances.addResourceNode(*node);
+      else
+        node->render();
     }
   }
   // Render animals
   for (auto &animal : m_animals) {
-    if (animal->isActive()) {
-      animal->render();
+    if (animal->isActive() && culling.isVisible(animal.get())) {
+      lod.renderAnimal(*animal);
     }
   }
   // Render projectiles
@@ -372,6 +454,12 @@ void Colony::render(bool isFPSMode, Settler *selectedSettler) {
   }
   // Render bushes
   for (auto *bush : bushes) {
+    if (!culling.isVisible(bush))
+      continue;
+    if (instanced) {
+      instances.addBush(*bush);
+      continue;
+    }
     Vector3 drawPos = bush->position;
     drawPos.y +=
         0.5f; // Lift up so it sits on ground (assuming center is origin)
@@ -384,6 +472,8 @@ void Colony::render(bool isFPSMode, Settler *selectedSettler) {
       DrawSphere(berryPos, 0.25f, RED);
     }
   }
+  if (instanced)
+    instances.flush();
 }
 void Colony::addSettler(Vector3 position, std::string name,
                         SettlerProfession profession) {
@@ -400,7 +490,7 @@ void Colony::addSettler(Vector3 position, std::string name,
       auto buildings = g_buildingSystem->getBuildingsInRange(p, 5.0f);
       for (auto *b : buildings) {
         // Ignore floors (optional, but usually we can walk on floors)
-        if (b->getBlueprintId() == "floor")
+        if (b->getBlueprintSid() == Ids::Floor)
           continue;
 
         if (CheckCollisionBoxSphere(b->getBoundingBox(), p, settlerRadius)) {
@@ -552,6 +642,9 @@ void Colony::registerStorageBuilding(BuildingInstance *b) {
       return;
   }
   m_storageBuildings.push_back(b);
+  // Zawartość sprzed rejestracji nie wyśle zdarzenia - pierwsza wizualizacja
+  if (g_buildingSystem)
+    g_buildingSystem->markStorageVisualDirty(b->getStorageSid());
 }
 const std::vector<BuildingInstance *> &Colony::getStorageBuildings() const {
   return m_storageBuildings;
@@ -683,22 +776,22 @@ float Colony::getEfficiencyModifier(Vector3 pos, SettlerState state) const {
     if (!building->isBuilt())
       continue;
 
-    std::string bid = building->getBlueprintId();
+    StringId bid = building->getBlueprintSid();
     float dist = Vector3Distance(pos, building->getPosition());
 
     // 1. TARTAK (Sawmill) -> Bonus do wycinania
-    if (bid == "sawmill" && state == SettlerState::CHOPPING && dist < 40.0f) {
+    if (bid == Ids::Sawmill && state == SettlerState::CHOPPING && dist < 40.0f) {
       modifier += 0.5f;
     }
 
     // 2. KUŹNIA (Blacksmith) -> Bonus globalny (sprawdzamy zasięg 100m dla
     // "globalności" w tej skali mapy)
-    if (bid == "blacksmith") {
+    if (bid == Ids::Blacksmith) {
       hasGlobalBlacksmith = true; // Flaga, żeby nie dodawać wielokrotnie
     }
 
     // 3. STUDNIA (Well) -> Bonus do regeneracji (używamy flagi dla Update)
-    if (bid == "well" && dist < 25.0f) {
+    if (bid == Ids::Well && dist < 25.0f) {
       modifier +=
           0.1f; // Mały bonus do modifiera, żeby Update wiedziało o Studni
     }
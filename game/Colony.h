@@ -28,6 +28,8 @@ class Terrain;
 class BuildingInstance;
 class Door;
 class Settler;        // Forward declaration of Settler (defined in Settler.h)
+#include "../core/SimulationLOD.h"
+#include "AIScheduler.h"
 #include "ColonyAI.h" // Include full definition for unique_ptr
 #include "Settler.h"  // Include the full definition of Settler
 
@@ -53,6 +55,8 @@ private:
   std::vector<Bush *> bushes;
   std::vector<WorldItem> m_droppedItemsStorage;
   std::unique_ptr<ColonyAI> m_ai;
+  AIScheduler m_aiScheduler;
+  SimulationLOD m_simLod;
   std::vector<BuildingInstance *> m_storageBuildings;
   std::unordered_map<std::string, int>
       m_activeGatheringTasks;  // resource type -> count
@@ -84,6 +88,9 @@ public:
   }
 
   const std::vector<Settler *> &getSettlers() const { return settlers; }
+  AIScheduler &getAIScheduler() { return m_aiScheduler; }
+  /** LOD symulacji - obserwatora ustawia pętla główna co klatkę */
+  SimulationLOD &getSimulationLOD() { return m_simLod; }
   const std::vector<std::unique_ptr<Animal>> &getAnimals() const {
     return m_animals;
   }
@@ -102,6 +109,7 @@ public:
   const std::vector<WorldItem> &getDroppedItems() const {
     return m_droppedItemsStorage;
   }
+  std::vector<WorldItem> &getDroppedItems() { return m_droppedItemsStorage; }
   void addDroppedItem(std::unique_ptr<Item> item, Vector3 position,
                       int amount = 1);
   std::unique_ptr<Item> takeDroppedItem(size_t index);
@@ -42,9 +42,11 @@ void ColonyAI::update(float deltaTime)
     checkNeeds();
 
     processConstructionRequests();
-
-    assignJobs(); // New job assignment phase
   }
+
+  // Przydział pracy co tick, ale tylko dla osadników z przydziałem
+  // AIScheduler - koszt rozkłada się równomiernie zamiast skoku co 0.5s
+  assignJobs();
 }
 void ColonyAI::registerHouse(Vector3 pos, int size, bool occupied)
 
@@ -204,15 +206,28 @@ void ColonyAI::processConstructionRequests()
 }
 void ColonyAI::assignJobs() {
 
-  auto settlers = m_colony->getSettlers();
+  if (!m_buildingSystem)
+    return;
 
-  auto buildTasks = m_buildingSystem->getActiveBuildTasks();
+  const auto &settlers = m_colony->getSettlers();
 
-  if (!m_buildingSystem)
+  // Bez kandydatów nie ma po co zbierać zadań
+  bool anyGranted = false;
+  for (auto *settler : settlers) {
+    if (settler->m_aiSchedule.evaluating) {
+      anyGranted = true;
+      break;
+    }
+  }
+  if (!anyGranted)
     return;
-  // Only assign jobs to idle settlers
+
+  auto buildTasks = m_buildingSystem->getActiveBuildTasks();
+
+  // Only assign jobs to idle settlers granted a decision this tick
   for (auto *settler : settlers) {
-    if (settler->GetState() != SettlerState::IDLE)
+    if (settler->GetState() != SettlerState::IDLE ||
+        !settler->m_aiSchedule.evaluating)
       continue;
 
     // Skip if hungry or tired (NeedsSystem should handle this, but extra check
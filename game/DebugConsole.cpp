@@ -3,11 +3,26 @@
 #include <sstream>
 #include <iostream>
 #include <algorithm>
+#include <cmath>
 
 // Include necessary game systems
+#include "../core/FrameArena.h"
+#include "../core/GameEngine.h"
 #include "../core/GameSystem.h"
 #include "Colony.h"
 #include "Settler.h"
+#include "WorldCommandBuffer.h"
+#include "WorldManager.h"
+#include "../core/Logger.h"
+#include "../core/MainThreadQueue.h"
+#include "../core/Profiler.h"
+#include "../core/RenderStats.h"
+#include "CharacterLod.h"
+#include "InstancedRenderer.h"
+#include "UIRenderCache.h"
+#include "WorldOverlay.h"
+#include "../systems/BuildingSystem.h"
+#include "RenderCulling.h"
 #include "Item.h"
 #include "../systems/TimeCycleSystem.h"
 #include "../game/ResourceNode.h"
@@ -337,4 +352,400 @@ void DebugConsole::registerDefaultCommands() {
         stats.setHealth(100.0f);
              log("Refilled stats for controlled settler.");
     }, "Refills health/hunger/energy for controlled settler");
+
+    // FRAME ARENA
+    registerCommand("arena", [this](const std::vector<std::string>& args) {
+        (void)args;
+        FrameArena::Stats stats = FrameArena::getStats();
+        log("Frame arenas: " + std::to_string(stats.arenaCount));
+        log("Last frame: " + std::to_string(stats.lastFrameBytes / 1024) + " KB");
+        log("Peak: " + std::to_string(stats.peakBytes / 1024) + " KB");
+        log("Capacity: " + std::to_string(stats.capacity / 1024) + " KB");
+    }, "Shows per-frame arena memory usage");
+
+    registerCommand("ai", [this](const std::vector<std::string>& args) {
+        Colony* colony = GameSystem::getColony();
+        if (!colony) {
+            log("Error: Colony not found");
+            return;
+        }
+        AIScheduler& scheduler = colony->getAIScheduler();
+        if (args.size() > 1) {
+            try {
+                scheduler.getConfig().budgetMs = std::max(0.0, std::stod(args[1]));
+            } catch (...) {
+                log("Usage: ai [budget_ms]");
+                return;
+            }
+        }
+        const AIScheduler::Stats& stats = scheduler.getStats();
+        log("AI budget: " + std::to_string(scheduler.getConfig().budgetMs) + " ms/tick");
+        log("Waiting: " + std::to_string(stats.candidates) +
+            ", granted: " + std::to_string(stats.granted) +
+            " (forced " + std::to_string(stats.forced) + ")" +
+            ", deferred: " + std::to_string(stats.deferred));
+        log("Spent: " + std::to_string(stats.spentMs) + " ms, avg decision: " +
+            std::to_string(stats.avgDecisionMs) + " ms");
+    }, "Shows AI scheduler stats, optionally sets budget (ai [budget_ms])");
+
+    registerCommand("lod", [this](const std::vector<std::string>& args) {
+        Colony* colony = GameSystem::getColony();
+        if (!colony) {
+            log("Error: Colony not found");
+            return;
+        }
+        SimulationLOD& lod = colony->getSimulationLOD();
+        if (args.size() > 1) {
+            if (args[1] == "on" || args[1] == "off") {
+                lod.getConfig().enabled = args[1] == "on";
+            } else {
+                log("Usage: lod [on|off]");
+                return;
+            }
+        }
+        const SimulationLOD::Stats& stats = lod.getStats();
+        log(std::string("Sim LOD: ") + (lod.getConfig().enabled ? "on" : "off") +
+            " (full < " + std::to_string((int)lod.getConfig().fullRadius) +
+            ", macro > " + std::to_string((int)lod.getConfig().macroRadius) + ")");
+        log("Full: " + std::to_string(stats.full) +
+            ", reduced: " + std::to_string(stats.reduced) +
+            ", macro: " + std::to_string(stats.macro) +
+            ", updated this tick: " + std::to_string(stats.updated));
+    }, "Shows simulation LOD tiers, optionally toggles it (lod [on|off])");
+
+    registerCommand("systems", [this](const std::vector<std::string>& args) {
+        GameEngine& engine = GameEngine::getInstance();
+        if (args.size() > 2 && (args[2] == "on" || args[2] == "off")) {
+            bool enable = args[2] == "on";
+            if (args[1] == "parallel") {
+                engine.setParallelSystemsEnabled(enable);
+            } else if (args[1] == "check") {
+                engine.setAccessCheckEnabled(enable);
+            }
+        } else if (args.size() > 1) {
+            log("Usage: systems [parallel|check on|off]");
+            return;
+        }
+        log(std::string("Parallel systems: ") +
+            (engine.isParallelSystemsEnabled() ? "on" : "off") +
+            ", access check: " + (SystemAccess::isCheckEnabled() ? "on" : "off") +
+            " (" + std::to_string(SystemAccess::getViolationCount()) + " violations)");
+        for (const std::string& line : engine.describeSchedule()) {
+            log("  " + line);
+        }
+    }, "Shows system dependency graph (systems [parallel|check on|off])");
+
+    registerCommand("commands", [this](const std::vector<std::string>& args) {
+        if (args.size() > 1 && args[1] == "reset") {
+            WorldCommandBuffer::resetStats();
+        }
+        WorldCommandBuffer::Stats stats = WorldCommandBuffer::getStats();
+        log("World commands pending: " + std::to_string(WorldCommandBuffer::getPendingCount()));
+        log("Recorded: " + std::to_string(stats.recorded) +
+            ", applied: " + std::to_string(stats.applied) +
+            ", failed: " + std::to_string(stats.failed));
+        log("Last playback: " + std::to_string(stats.lastPlayback) +
+            ", peak: " + std::to_string(stats.peakPlayback));
+    }, "Shows deferred world command stats (commands [reset])");
+
+    registerCommand("profile", [this](const std::vector<std::string>& args) {
+        std::string mode = args.size() > 1 ? args[1] : "";
+        if (mode == "on") {
+            Profiler::setEnabled(true);
+            Profiler::setOverlayVisible(true);
+        } else if (mode == "off") {
+            Profiler::setEnabled(false);
+            Profiler::setOverlayVisible(false);
+        } else if (mode == "overlay") {
+            Profiler::setOverlayVisible(!Profiler::isOverlayVisible());
+        } else if (mode == "clear") {
+            Profiler::clear();
+        } else if (mode == "dump") {
+            std::string path = args.size() > 2 ? args[2] : "profile_trace.json";
+            if (Profiler::exportChromeTrace(path)) {
+                log("Chrome trace (" + std::to_string(Profiler::getFrameCount()) +
+                    " frames) written to " + path);
+            } else {
+                log("Cannot write " + path);
+            }
+            return;
+        } else if (!mode.empty()) {
+            log("Usage: profile [on|off|overlay|clear|dump <file>]");
+            return;
+        }
+
+        log(std::string("Profiler: ") + (Profiler::isEnabled() ? "on" : "off") +
+            ", frames: " + std::to_string(Profiler::getFrameCount()));
+        int shown = 0;
+        for (const Profiler::ZoneSummary& zone : Profiler::summarize(60)) {
+            if (zone.thread != 0 || zone.depth > 1 || shown++ >= 8)
+                continue;
+            log(std::string(zone.depth * 2, ' ') + zone.name + ": " +
+                std::to_string(zone.totalMs) + " ms");
+        }
+    }, "CPU profiler (profile [on|off|overlay|clear|dump <file>])");
+
+    registerCommand("cull", [this](const std::vector<std::string>& args) {
+        RenderCulling& culling = RenderCulling::getInstance();
+        if (args.size() > 1) {
+            if (args[1] == "on" || args[1] == "off") {
+                culling.getConfig().enabled = args[1] == "on";
+                culling.clear();
+            } else {
+                try {
+                    culling.getConfig().cellSize = std::stof(args[1]);
+                } catch (...) {
+                    log("Usage: cull [on|off|cell_size]");
+                    return;
+                }
+            }
+        }
+        const RenderCulling::Stats& stats = culling.getStats();
+        log(std::string("Frustum culling: ") + (culling.getConfig().enabled ? "on" : "off") +
+            ", cell " + std::to_string((int)culling.getConfig().cellSize) + " m, cached " +
+            std::to_string(culling.getCachedCount()));
+        log("Tested: " + std::to_string(stats.tested) + ", culled: " + std::to_string(stats.culled) +
+            ", drawn: " + std::to_string(stats.drawn));
+        log("Cells culled: " + std::to_string(stats.cellsCulled) + "/" + std::to_string(stats.cells) +
+            ", box tests: " + std::to_string(stats.boxTests) +
+            ", AABB rebuilds: " + std::to_string(stats.boundsRebuilt));
+        std::string drawn = "Drawn:";
+        for (size_t i = 0; i < static_cast<size_t>(CullCategory::Count); ++i) {
+            drawn += std::string(" ") + RenderCulling::categoryName(static_cast<CullCategory>(i)) +
+                     " " + std::to_string(stats.drawnByCategory[i]);
+        }
+        log(drawn);
+    }, "Frustum culling stats (cull [on|off|cell_size])");
+
+    registerCommand("instancing", [this](const std::vector<std::string>& args) {
+        InstancedRenderer& instances = InstancedRenderer::getInstance();
+        if (args.size() > 1)
+            instances.setEnabled(args[1] == "on");
+        const InstancedRenderer::Stats& stats = instances.getStats();
+        log(std::string("Instanced trees/bushes/nodes: ") + (instances.isEnabled() ? "on" : "off") +
+            ", last frame " + std::to_string(stats.instances) + " instances in " +
+            std::to_string(stats.drawCalls) + " draw calls");
+    }, "Instanced world props (instancing [on|off])");
+
+    registerCommand("chunks", [this](const std::vector<std::string>& args) {
+        BuildingSystem* buildings = GameEngine::getInstance().getSystem<BuildingSystem>();
+        if (!buildings) {
+            log("BuildingSystem not available");
+            return;
+        }
+        BuildingChunkMeshes& chunks = buildings->getChunkMeshes();
+        if (args.size() > 1) {
+            if (args[1] == "on" || args[1] == "off") {
+                chunks.getConfig().enabled = args[1] == "on";
+            } else if (args[1] == "rebuild") {
+                chunks.markAllDirty();
+            } else {
+                try {
+                    chunks.getConfig().chunkSize = std::stof(args[1]);
+                    chunks.clear();
+                } catch (...) {
+                    log("Usage: chunks [on|off|rebuild|chunk_size]");
+                    return;
+                }
+            }
+        }
+        const BuildingChunkMeshes::Stats& stats = chunks.getStats();
+        log(std::string("Static building chunks: ") + (chunks.getConfig().enabled ? "on" : "off") +
+            ", chunk " + std::to_string((int)chunks.getConfig().chunkSize) + " m, drawn " +
+            std::to_string(stats.chunksDrawn) + "/" + std::to_string(stats.chunks));
+        log("Merged pieces: " + std::to_string(stats.staticPieces) + ", vertices: " +
+            std::to_string(stats.vertices) + ", dynamic buildings: " +
+            std::to_string(stats.dynamicBuildings) + ", rebuilds: " + std::to_string(stats.rebuilds));
+        log("Storage visuals: " + std::to_string(buildings->getStorageVisualCount()) +
+            " cached, " + std::to_string(buildings->getStorageVisualRebuilds()) +
+            " event-driven rebuilds");
+    }, "Merged static building meshes (chunks [on|off|rebuild|chunk_size])");
+
+    registerCommand("drawlod", [this](const std::vector<std::string>& args) {
+        CharacterLod& lod = CharacterLod::getInstance();
+        if (args.size() == 2 && (args[1] == "on" || args[1] == "off")) {
+            lod.getConfig().enabled = args[1] == "on";
+        } else if (args.size() == 3) {
+            try {
+                lod.getConfig().fullPixels = std::stof(args[1]);
+                lod.getConfig().proxyPixels = std::stof(args[2]);
+            } catch (...) {
+                log("Usage: drawlod [on|off] | drawlod <full_px> <proxy_px>");
+                return;
+            }
+        } else if (args.size() > 1) {
+            log("Usage: drawlod [on|off] | drawlod <full_px> <proxy_px>");
+            return;
+        }
+        const CharacterLod::Config& config = lod.getConfig();
+        const CharacterLod::Stats& stats = lod.getStats();
+        log(std::string("Character draw LOD: ") + (config.enabled ? "on" : "off") +
+            ", full >= " + std::to_string((int)config.fullPixels) + " px, proxy >= " +
+            std::to_string((int)config.proxyPixels) + " px");
+        log("Last frame: " + std::to_string(stats.full) + " full, " + std::to_string(stats.proxy) +
+            " proxy, " + std::to_string(stats.marker) + " marker");
+    }, "Settler/animal render LOD (drawlod [on|off] | drawlod <full_px> <proxy_px>)");
+
+    registerCommand("renderstats", [this](const std::vector<std::string>& args) {
+        if (args.size() == 2 && (args[1] == "on" || args[1] == "off")) {
+            RenderStats::setEnabled(args[1] == "on");
+        } else if (args.size() > 1) {
+            log("Usage: renderstats [on|off]");
+            return;
+        }
+        if (!RenderStats::isInstalled()) {
+            log("Render stats not installed (no window)");
+            return;
+        }
+        log(std::string("Render stats: ") + (RenderStats::isEnabled() ? "on" : "off") +
+            " (counters in profiler overlay/trace when profiler is on)");
+        auto row = [this](const char* name, const RenderPassStats& stats) {
+            log(std::string(name) + ": " + std::to_string(stats.drawCalls) + " draws, " +
+                std::to_string(stats.vertices) + " verts, " + std::to_string(stats.instances) +
+                " instances, " + std::to_string(stats.textureSwitches) + " tex, " +
+                std::to_string(stats.batchFlushes) + " flushes (" +
+                std::to_string(stats.forcedFlushes) + " forced)");
+        };
+        const RenderFrameStats& frame = RenderStats::getLastFrame();
+        for (size_t i = 0; i < static_cast<size_t>(RenderPass::Count); ++i) {
+            const RenderPassStats& stats = frame.passes[i];
+            if (stats.drawCalls > 0 || stats.forcedFlushes > 0)
+                row(RenderStats::passName(static_cast<RenderPass>(i)), stats);
+        }
+        row("total", frame.total());
+    }, "Draw calls/vertices/texture switches/batch flushes per pass (renderstats [on|off])");
+
+    registerCommand("uicache", [this](const std::vector<std::string>& args) {
+        GlyphRunCache& glyphs = GlyphRunCache::getInstance();
+        if (args.size() == 2 && (args[1] == "on" || args[1] == "off")) {
+            CachedPanel::setEnabled(args[1] == "on");
+            glyphs.setEnabled(args[1] == "on");
+        } else if (args.size() == 2 && args[1] == "clear") {
+            glyphs.clear();
+        } else if (args.size() > 1) {
+            log("Usage: uicache [on|off|clear]");
+            return;
+        }
+        const CachedPanel::Stats& panels = CachedPanel::getStats();
+        const GlyphRunCache::Stats& runs = glyphs.getStats();
+        log(std::string("UI cache: ") + (CachedPanel::isEnabled() ? "on" : "off") + ", " +
+            std::to_string(glyphs.size()) + " glyph runs cached");
+        log("Last frame: " + std::to_string(panels.draws) + " panels (" +
+            std::to_string(panels.redraws) + " redrawn), text " + std::to_string(runs.hits) +
+            " hits / " + std::to_string(runs.misses) + " misses");
+    }, "Cached UI panels and glyph runs (uicache [on|off|clear])");
+
+    registerCommand("overlay", [this](const std::vector<std::string>&) {
+        const WorldOverlay::Stats& stats = WorldOverlay::getInstance().getStats();
+        log("World overlay (last flush): " + std::to_string(stats.anchors) + " anchors, " +
+            std::to_string(stats.culled) + " culled, " + std::to_string(stats.items) +
+            " items, " + std::to_string(stats.quads) + " quads");
+    }, "Batched world-space bars/labels stats");
+
+    registerCommand("log", [this](const std::vector<std::string>& args) {
+        static const LogLevel levels[] = {LogLevel::Debug, LogLevel::Info,
+                                          LogLevel::Warning, LogLevel::Error};
+        if (args.size() == 2) {
+            if (args[1] == "reset") {
+                Logger::resetStats();
+            } else {
+                bool found = false;
+                for (LogLevel level : levels) {
+                    std::string name = Logger::levelName(level);
+                    std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+                    if (name == args[1]) {
+                        Logger::setLevel(level);
+                        found = true;
+                    }
+                }
+                if (!found) {
+                    log("Usage: log [debug|info|warning|error|reset] | log <category> on|off");
+                    return;
+                }
+            }
+        } else if (args.size() == 3) {
+            bool found = false;
+            for (int i = 0; i < static_cast<int>(LogCategory::Count); ++i) {
+                LogCategory category = static_cast<LogCategory>(i);
+                std::string name = Logger::categoryName(category);
+                std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+                if (name == args[1]) {
+                    Logger::setCategoryEnabled(category, args[2] == "on");
+                    found = true;
+                }
+            }
+            if (!found) {
+                log("Unknown log category: " + args[1]);
+                return;
+            }
+        }
+
+        Logger::Stats stats = Logger::getStats();
+        log(std::string("Log level: ") + Logger::levelName(Logger::getLevel()) +
+            " (compiled from level " + std::to_string(Logger::COMPILE_LEVEL) + ")");
+        std::string disabled;
+        for (int i = 0; i < static_cast<int>(LogCategory::Count); ++i) {
+            LogCategory category = static_cast<LogCategory>(i);
+            if (!Logger::isCategoryEnabled(category))
+                disabled += std::string(" ") + Logger::categoryName(category);
+        }
+        if (!disabled.empty())
+            log("Disabled categories:" + disabled);
+        log("Queued: " + std::to_string(stats.queued) +
+            ", written: " + std::to_string(stats.written) +
+            ", rate-limited: " + std::to_string(stats.suppressed) +
+            ", dropped: " + std::to_string(stats.dropped));
+    }, "Log filter and stats (log [level|reset] | log <category> on|off)");
+
+    registerCommand("streaming", [this](const std::vector<std::string>& args) {
+        WorldManager* world = WorldManager::GetInstance();
+        if (args.size() > 1) {
+            try {
+                world->GetStreamingConfig().lookaheadSeconds = std::stof(args[1]);
+            } catch (...) {
+                log("Usage: streaming [lookahead_seconds]");
+                return;
+            }
+        }
+        const WorldManager::StreamingStats& stats = world->GetStreamingStats();
+        Vector3 velocity = world->GetPlayerVelocity();
+        log("Lookahead: " + std::to_string(world->GetStreamingConfig().lookaheadSeconds) +
+            " s, player speed: " + std::to_string(std::sqrt(velocity.x * velocity.x + velocity.z * velocity.z)) + " m/s");
+        log("Regions generated: " + std::to_string(stats.completed) +
+            ", in flight: " + std::to_string(stats.inFlight));
+        log("Prefetch hits: " + std::to_string(stats.prefetchHits) +
+            ", misses: " + std::to_string(stats.prefetchMisses) +
+            ", deferred: " + std::to_string(stats.deferredActivations));
+        MainThreadQueue::Stats uploads = MainThreadQueue::getInstance().getStats();
+        log("Main thread tasks pending: " + std::to_string(uploads.pending) +
+            ", last frame: " + std::to_string(uploads.lastFrameTasks) +
+            " (" + std::to_string(uploads.lastFrameMs) + " ms, max " +
+            std::to_string(uploads.maxFrameMs) + " ms)");
+    }, "Shows region streaming stats (streaming [lookahead_seconds])");
+
+    registerCommand("events", [this](const std::vector<std::string>& args) {
+        if (args.size() > 1) {
+            if (args[1] == "reset") {
+                EventBus::resetQueueStats();
+            } else {
+                try {
+                    EventBus::setMaxEventsPerFrame(std::stoul(args[1]));
+                } catch (...) {
+                    log("Usage: events [max_per_frame|reset]");
+                    return;
+                }
+            }
+        }
+        EventBus::QueueStats stats = EventBus::getQueueStats();
+        log("Event handlers: " + std::to_string(EventBus::getTotalHandlersCount()) +
+            ", max per frame: " + std::to_string(EventBus::getMaxEventsPerFrame()));
+        log("Queued: " + std::to_string(stats.enqueued) +
+            ", dispatched: " + std::to_string(stats.dispatched) +
+            ", pending: " + std::to_string(stats.pending) +
+            ", overflow: " + std::to_string(stats.overflowed) +
+            ", carried over: " + std::to_string(stats.carriedOver));
+        for (const std::string& line : EventBus::describeQueues()) {
+            log("  " + line);
+        }
+    }, "Shows deferred event queue stats (events [max_per_frame|reset])");
 }
@@ -0,0 +1,293 @@
+#include "InstancedRenderer.h"
+#include "Animal.h"
+#include "Colony.h"
+#include "ResourceNode.h"
+#include "Settler.h"
+#include "Tree.h"
+#include "../core/RenderStats.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include <cstring>
+
+namespace {
+const char *kVertexShader = R"(#version 330
+in vec3 vertexPosition;
+in vec4 vertexColor;
+in mat4 instanceTransform;
+uniform mat4 mvp;
+uniform vec4 colDiffuse;
+out vec4 fragColor;
+void main() {
+    mat4 model = instanceTransform;
+    // Kolor instancji siedzi w dolnym wierszu macierzy (m3, m7, m11).
+    // Wierzchołek z alfa 0 ma stały kolor (części proxy postaci), bez
+    // kolorów wierzchołków raylib podaje (1,1,1,1) - kolor instancji.
+    vec3 instanceColor = vec3(model[0][3], model[1][3], model[2][3]);
+    fragColor = colDiffuse *
+        vec4(mix(vertexColor.rgb, instanceColor, vertexColor.a), 1.0);
+    model[0][3] = 0.0;
+    model[1][3] = 0.0;
+    model[2][3] = 0.0;
+    gl_Position = mvp * model * vec4(vertexPosition, 1.0);
+}
+)";
+
+const char *kFragmentShader = R"(#version 330
+in vec4 fragColor;
+out vec4 finalColor;
+void main() {
+    finalColor = fragColor;
+}
+)";
+
+// Wymiary jak w dotychczasowym Tree::render / Colony::render
+constexpr float kTrunkRadius = 0.4f;
+constexpr float kTrunkBase = -0.2f;
+constexpr float kTrunkHeight = 3.2f; // -0.2 .. 3.0
+constexpr float kStumpHeight = 0.7f; // -0.2 .. 0.5
+constexpr float kFoliageBase = 2.0f;
+constexpr float kEdgeThickness = 0.03f;
+constexpr Color kInstanceTint = {255, 255, 255, 255}; // kolor z instancji
+constexpr Color kSkinColor = {255, 220, 177, 0};
+constexpr Color kPantsColor = {0, 82, 172, 0}; // DARKBLUE
+
+void appendBox(std::vector<float> &vertices, Vector3 min, Vector3 max) {
+  const Vector3 c[8] = {{min.x, min.y, min.z}, {max.x, min.y, min.z},
+                        {max.x, max.y, min.z}, {min.x, max.y, min.z},
+                        {min.x, min.y, max.z}, {max.x, min.y, max.z},
+                        {max.x, max.y, max.z}, {min.x, max.y, max.z}};
+  // Ściany CCW patrząc z zewnątrz
+  const int faces[6][4] = {{4, 5, 6, 7}, {1, 0, 3, 2}, {5, 1, 2, 6},
+                           {0, 4, 7, 3}, {3, 7, 6, 2}, {0, 1, 5, 4}};
+  for (const auto &face : faces) {
+    const int order[6] = {face[0], face[1], face[2], face[0], face[2], face[3]};
+    for (int index : order) {
+      vertices.push_back(c[index].x);
+      vertices.push_back(c[index].y);
+      vertices.push_back(c[index].z);
+    }
+  }
+}
+
+Mesh uploadMesh(const std::vector<float> &vertices,
+                const std::vector<unsigned char> &colors) {
+  Mesh mesh = {};
+  mesh.vertexCount = static_cast<int>(vertices.size() / 3);
+  mesh.triangleCount = mesh.vertexCount / 3;
+  mesh.vertices =
+      static_cast<float *>(MemAlloc(vertices.size() * sizeof(float)));
+  std::memcpy(mesh.vertices, vertices.data(), vertices.size() * sizeof(float));
+  if (!colors.empty()) {
+    mesh.colors = static_cast<unsigned char *>(MemAlloc(colors.size()));
+    std::memcpy(mesh.colors, colors.data(), colors.size());
+  }
+  UploadMesh(&mesh, false);
+  return mesh;
+}
+
+// Krawędzie sześcianu 1x1x1 jako cienkie prostopadłościany (odpowiednik
+// DrawCubeWires - DrawMeshInstanced rysuje tylko trójkąty)
+Mesh genCubeEdges(float thickness) {
+  const float h = 0.5f;
+  const float t = thickness * 0.5f;
+  std::vector<float> vertices;
+  for (float a : {-h, h}) {
+    for (float b : {-h, h}) {
+      appendBox(vertices, {-h, a - t, b - t}, {h, a + t, b + t}); // wzdłuż X
+      appendBox(vertices, {a - t, -h, b - t}, {a + t, h, b + t}); // wzdłuż Y
+      appendBox(vertices, {a - t, b - t, -h}, {a + t, b + t, h}); // wzdłuż Z
+    }
+  }
+  return uploadMesh(vertices, {});
+}
+
+// Pudełko o środku center i wymiarach size; alfa 0 = stały kolor
+void appendPart(std::vector<float> &vertices, std::vector<unsigned char> &colors,
+                Vector3 center, Vector3 size, Color color) {
+  Vector3 half = Vector3Scale(size, 0.5f);
+  appendBox(vertices, Vector3Subtract(center, half), Vector3Add(center, half));
+  for (int i = 0; i < 36; ++i)
+    colors.insert(colors.end(), {color.r, color.g, color.b, color.a});
+}
+
+// Osadnik w pozie spoczynkowej (wymiary jak w Settler::render), jeden Mesh
+Mesh genSettlerProxy() {
+  std::vector<float> vertices;
+  std::vector<unsigned char> colors;
+  const float bodyY = 0.5f;
+  appendPart(vertices, colors, {0.0f, bodyY + 0.4f, 0.0f}, {0.4f, 0.5f, 0.25f},
+             kInstanceTint);
+  appendPart(vertices, colors, {0.0f, bodyY + 0.82f, 0.02f},
+             {0.25f, 0.25f, 0.25f}, kSkinColor);
+  for (float side : {-1.0f, 1.0f}) {
+    appendPart(vertices, colors, {side * 0.12f, bodyY - 0.2f, 0.0f},
+               {0.15f, 0.5f, 0.15f}, kPantsColor);
+    appendPart(vertices, colors, {side * 0.3f, bodyY + 0.4f, 0.0f},
+               {0.12f, 0.4f, 0.12f}, kSkinColor);
+  }
+  return uploadMesh(vertices, colors);
+}
+
+// Królik jak w Animal::render (tułów, głowa, uszy, ogon)
+Mesh genRabbitProxy() {
+  std::vector<float> vertices;
+  std::vector<unsigned char> colors;
+  const Color body = {127, 106, 79, 0};   // BROWN
+  const Color head = {211, 176, 131, 0};  // BEIGE
+  const Color tail = {255, 255, 255, 0};
+  appendPart(vertices, colors, {0.0f, 0.25f, 0.0f}, {0.6f, 0.5f, 0.8f}, body);
+  appendPart(vertices, colors, {0.0f, 0.4f, -0.5f}, {0.4f, 0.35f, 0.4f}, head);
+  for (float side : {-1.0f, 1.0f})
+    appendPart(vertices, colors, {side * 0.15f, 0.7f, -0.5f},
+               {0.1f, 0.4f, 0.1f}, body);
+  appendPart(vertices, colors, {0.0f, 0.25f, 0.45f}, {0.25f, 0.25f, 0.25f},
+             tail);
+  return uploadMesh(vertices, colors);
+}
+
+// Kwadrat w płaszczyźnie XY (x -0.5..0.5, y 0..1), widoczny z obu stron
+Mesh genMarker() {
+  std::vector<float> vertices = {
+      -0.5f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f, 0.5f,  1.0f, 0.0f,
+      -0.5f, 0.0f, 0.0f, 0.5f, 1.0f, 0.0f, -0.5f, 1.0f, 0.0f,
+      -0.5f, 0.0f, 0.0f, 0.5f, 1.0f, 0.0f, 0.5f,  0.0f, 0.0f,
+      -0.5f, 0.0f, 0.0f, -0.5f, 1.0f, 0.0f, 0.5f, 1.0f, 0.0f};
+  return uploadMesh(vertices, {});
+}
+
+} // namespace
+
+Matrix InstancedRenderer::packColor(Matrix transform, Color color) {
+  transform.m3 = color.r / 255.0f;
+  transform.m7 = color.g / 255.0f;
+  transform.m11 = color.b / 255.0f;
+  return transform;
+}
+
+bool InstancedRenderer::isReady() {
+  if (!m_enabled || m_failed)
+    return false;
+  if (m_loaded)
+    return true;
+  if (!IsWindowReady())
+    return false;
+
+  Shader shader = LoadShaderFromMemory(kVertexShader, kFragmentShader);
+  if (shader.id == rlGetShaderIdDefault() ||
+      shader.locs[SHADER_LOC_VERTEX_INSTANCE_TX] < 0) {
+    TraceLog(LOG_WARNING, "InstancedRenderer: instancing shader unavailable, "
+                          "falling back to immediate drawing");
+    if (shader.id != rlGetShaderIdDefault())
+      UnloadShader(shader);
+    m_failed = true;
+    return false;
+  }
+
+  m_material = LoadMaterialDefault();
+  m_material.shader = shader;
+  m_material.maps[MATERIAL_MAP_DIFFUSE].color = WHITE;
+
+  m_batches[TreeTrunk].mesh = GenMeshCylinder(kTrunkRadius, 1.0f, 8);
+  m_batches[TreeFoliage].mesh = GenMeshCone(1.5f, 3.0f, 8);
+  m_batches[Cube].mesh = GenMeshCube(1.0f, 1.0f, 1.0f);
+  m_batches[CubeEdges].mesh = genCubeEdges(kEdgeThickness);
+  m_batches[Berry].mesh = GenMeshSphere(0.25f, 12, 12);
+  m_batches[SettlerProxy].mesh = genSettlerProxy();
+  m_batches[RabbitProxy].mesh = genRabbitProxy();
+  m_batches[Marker].mesh = genMarker();
+  m_loaded = true;
+  return true;
+}
+
+void InstancedRenderer::add(Shape shape, Matrix transform, Color color) {
+  m_batches[shape].transforms.push_back(packColor(transform, color));
+}
+
+void InstancedRenderer::addCubes(const std::vector<Matrix> &packed) {
+  std::vector<Matrix> &transforms = m_batches[Cube].transforms;
+  transforms.insert(transforms.end(), packed.begin(), packed.end());
+}
+
+void InstancedRenderer::addTree(const Tree &tree) {
+  Matrix base = tree.getRenderTransform();
+  float trunkHeight = tree.isStump() ? kStumpHeight : kTrunkHeight;
+  Matrix trunk = MatrixMultiply(
+      MatrixMultiply(MatrixScale(1.0f, trunkHeight, 1.0f),
+                     MatrixTranslate(0.0f, kTrunkBase, 0.0f)),
+      base);
+  add(TreeTrunk, trunk, BROWN);
+  if (!tree.isStump()) {
+    add(TreeFoliage,
+        MatrixMultiply(MatrixTranslate(0.0f, kFoliageBase, 0.0f), base),
+        DARKGREEN);
+  }
+}
+
+void InstancedRenderer::addResourceNode(const ResourceNode &node) {
+  if (node.isDepleted())
+    return;
+  Vector3 pos = node.getPosition();
+  Matrix transform = MatrixTranslate(pos.x, pos.y + 0.5f, pos.z);
+  add(Cube, transform, node.getRenderColor());
+  add(CubeEdges, transform, DARKGRAY);
+}
+
+void InstancedRenderer::addBush(const Bush &bush) {
+  Vector3 pos = bush.position;
+  Matrix transform = MatrixTranslate(pos.x, pos.y + 0.5f, pos.z);
+  add(Cube, transform, DARKGREEN);
+  add(CubeEdges, transform, BLACK);
+  if (bush.hasFruit)
+    add(Berry, MatrixTranslate(pos.x, pos.y + 1.1f, pos.z), RED);
+}
+
+void InstancedRenderer::addSettlerProxy(const Settler &settler) {
+  add(SettlerProxy, settler.getRenderTransform(), settler.getRenderColor());
+}
+
+void InstancedRenderer::addAnimalProxy(const Animal &animal) {
+  Matrix transform = animal.getRenderTransform();
+  if (animal.getType() == AnimalType::RABBIT) {
+    add(RabbitProxy, transform, WHITE);
+    return;
+  }
+  // Jeleń to i tak jedno pudełko 1 x 1.5 x 2 stojące na ziemi
+  add(Cube,
+      MatrixMultiply(MatrixMultiply(MatrixScale(1.0f, 1.5f, 2.0f),
+                                    MatrixTranslate(0.0f, 0.75f, 0.0f)),
+                     transform),
+      DARKBROWN);
+}
+
+void InstancedRenderer::addMarker(Matrix transform, Color color) {
+  add(Marker, transform, color);
+}
+
+void InstancedRenderer::flush() {
+  if (!m_loaded)
+    return;
+  // Wcześniejsze rysowanie natychmiastowe idzie przed instancjami
+  RenderStats::flushBatch();
+  for (Batch &batch : m_batches) {
+    if (batch.transforms.empty())
+      continue;
+    DrawMeshInstanced(batch.mesh, m_material, batch.transforms.data(),
+                      static_cast<int>(batch.transforms.size()));
+    m_stats.instances += batch.transforms.size();
+    m_stats.drawCalls++;
+    batch.transforms.clear();
+  }
+}
+
+void InstancedRenderer::unload() {
+  if (!m_loaded)
+    return;
+  for (Batch &batch : m_batches) {
+    UnloadMesh(batch.mesh);
+    batch.mesh = Mesh{};
+    batch.transforms.clear();
+  }
+  UnloadMaterial(m_material); // razem z shaderem instancji
+  m_material = Material{};
+  m_loaded = false;
+}
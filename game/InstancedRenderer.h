@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <raylib.h>
+#include <vector>
+
+class Animal;
+class Bush;
+class ResourceNode;
+class Settler;
+class Tree;
+
+/**
+ * @brief Instancjonowane rysowanie drzew, krzewów i węzłów zasobów.
+ *
+ * Kształty (pień, korona, sześcian, krawędzie sześcianu, owoc) są budowane
+ * raz jako Mesh na GPU. Pętle rysujące tylko dopisują macierz instancji
+ * (addTree/addBush/addResourceNode), a flush() wysyła każdy kształt jednym
+ * DrawMeshInstanced. Stan drzewa (obrót, padanie, pniak) jest częścią
+ * macierzy instancji.
+ *
+ * DrawMeshInstanced przesyła tylko macierze, więc kolor instancji jest
+ * zapisany w nieużywanym wierszu macierzy (m3, m7, m11) i odtwarzany przez
+ * shader. Bez okna albo gdy shader się nie skompiluje isReady() zwraca
+ * false i wołający rysuje obiekty po staremu.
+ *
+ * Proxy postaci (CharacterLod) to jeden Mesh z kolorami wierzchołków -
+ * części z alfa 0 mają stały kolor, reszta bierze kolor instancji.
+ */
+class InstancedRenderer {
+public:
+  struct Stats {
+    size_t instances = 0;
+    size_t drawCalls = 0;
+  };
+
+  static InstancedRenderer &getInstance() {
+    static InstancedRenderer instance;
+    return instance;
+  }
+
+  /** Ładuje meshe i shader przy pierwszym wywołaniu (wymaga okna) */
+  bool isReady();
+  void setEnabled(bool enabled) { m_enabled = enabled; }
+  bool isEnabled() const { return m_enabled; }
+
+  void addTree(const Tree &tree);
+  void addResourceNode(const ResourceNode &node);
+  void addBush(const Bush &bush);
+  /** Uproszczone postacie średniego zasięgu (CharacterLod) */
+  void addSettlerProxy(const Settler &settler);
+  void addAnimalProxy(const Animal &animal);
+  /** Kwadrat 1x1 (podstawa w y = 0) - macierz ustawia go do kamery */
+  void addMarker(Matrix transform, Color color);
+  /** Gotowe macierze sześcianu 1x1x1 z kolorem z packColor (cache wołającego) */
+  void addCubes(const std::vector<Matrix> &packed);
+  /** Zapisuje kolor w macierzy instancji (dolny wiersz) */
+  static Matrix packColor(Matrix transform, Color color);
+
+  /** Rysuje zebrane instancje (wewnątrz BeginMode3D) i czyści bufory */
+  void flush();
+
+  void beginFrame() { m_stats = Stats(); }
+  const Stats &getStats() const { return m_stats; }
+  void unload();
+
+private:
+  enum Shape {
+    TreeTrunk,
+    TreeFoliage,
+    Cube,
+    CubeEdges,
+    Berry,
+    SettlerProxy,
+    RabbitProxy,
+    Marker,
+    ShapeCount
+  };
+
+  struct Batch {
+    Mesh mesh{};
+    std::vector<Matrix> transforms;
+  };
+
+  InstancedRenderer() = default;
+  ~InstancedRenderer() = default;
+
+  void add(Shape shape, Matrix transform, Color color);
+
+  Batch m_batches[ShapeCount];
+  Material m_material{};
+  bool m_loaded = false;
+  bool m_failed = false;
+  bool m_enabled = true;
+  Stats m_stats;
+};
@@ -11,56 +11,106 @@
 // Item - Bazowa klasa
 
 // ============================================================================
-Item::Item(ItemType itemType, const std::string& displayName, const std::string& description)
-
-: m_itemType(itemType)
-
-, m_displayName(displayName)
-
-, m_description(description)
-
-, m_weight(1.0f)
-
-, m_volume(1.0f)
-
-, m_value(1)
+namespace {
+
+// Prototyp definicji z domyślnymi wartościami bazowego Item
+ItemDefinition makeDefinition(ItemType itemType, const std::string& displayName,
+                              const std::string& description) {
+    ItemDefinition def;
+    def.type = itemType;
+    def.displayName = displayName;
+    def.description = description;
+    def.weight = 1.0f;
+    def.volume = 1.0f;
+    def.value = 1;
+    def.rarity = ItemRarity::COMMON;
+    def.stackable = true;
+    def.maxStackSize = 64;
+    return def;
+}
 
-, m_rarity(ItemRarity::COMMON)
+ItemDefinition makeResourceDefinition(const std::string& resourceType, const std::string& displayName,
+                                      const std::string& description) {
+    ItemDefinition def = makeDefinition(ItemType::RESOURCE, displayName, description);
+    def.resourceType = resourceType;
+    // Zasoby są zawsze stackowalne
+    def.stackable = true;
+    def.maxStackSize = 999;
+    // Ustaw domyślne właściwości zasobów
+    def.weight = 0.5f;
+    // Specjalna waga dla drewna - jedna kłoda zajmuje cały ekwipunek osadnika (50.0f)
+    if (resourceType == "Wood") {
+        def.weight = 10.0f;
+    }
+    def.volume = 0.5f;
+    def.value = 1;
+    def.rarity = ItemRarity::COMMON;
+    return def;
+}
 
-, m_stackable(true)
+ItemDefinition makeEquipmentDefinition(const std::string& displayName, const std::string& description) {
+    ItemDefinition def = makeDefinition(ItemType::EQUIPMENT, displayName, description);
+    // Ekwipunek nie jest stackowalny
+    def.stackable = false;
+    def.maxStackSize = 1;
+    // Ustaw domyślne właściwości ekwipunku
+    def.weight = 2.0f;
+    def.volume = 2.0f;
+    def.value = 10;
+    def.rarity = ItemRarity::COMMON;
+    return def;
+}
 
-, m_maxStackSize(64)
+ItemDefinition makeConsumableDefinition(const std::string& displayName, const std::string& description) {
+    ItemDefinition def = makeDefinition(ItemType::CONSUMABLE, displayName, description);
+    // Przedmioty zużywalne są stackowalne
+    def.stackable = true;
+    def.maxStackSize = 20;
+    // Ustaw domyślne właściwości
+    def.weight = 0.2f;
+    def.volume = 0.2f;
+    def.value = 5;
+    def.rarity = ItemRarity::COMMON;
+    return def;
+}
 
-, m_iconPath("")
+} // namespace
 
+Item::Item(ItemType itemType, const std::string& displayName, const std::string& description)
+: m_def(ItemDefinitionRegistry::getInstance().intern(makeDefinition(itemType, displayName, description)))
 {
+}
 
+Item::Item(const ItemDefinition& proto)
+: m_def(ItemDefinitionRegistry::getInstance().intern(proto))
+{
 }
+
 ItemDisplayInfo Item::getDisplayInfo() const {
 
 ItemDisplayInfo info;
 
-info.name = m_displayName;
+info.name = m_def->displayName;
 
-info.description = m_description;
+info.description = m_def->description;
 
-info.type = m_itemType;
+info.type = m_def->type;
 
-info.rarity = m_rarity;
+info.rarity = m_def->rarity;
 
 info.quantity = 1;
 
-info.weight = m_weight;
+info.weight = m_def->weight;
 
-info.volume = m_volume;
+info.volume = m_def->volume;
 
-info.value = m_value;
+info.value = m_def->value;
 
-info.rarityColor = getRarityColor(m_rarity);
+info.rarityColor = getRarityColor(m_def->rarity);
 
-info.iconPath = m_iconPath;
+info.iconPath = m_def->iconPath;
 
-info.properties = m_properties;
+info.properties = m_def->properties;
 
 return info;
 
@@ -109,31 +159,12 @@ ResourceItem::ResourceItem(const std::string& resourceType, const std::string& d
 
 const std::string& description)
 
-: Item(ItemType::RESOURCE, displayName, description)
-
-, m_resourceType(resourceType)
+: Item(makeResourceDefinition(resourceType, displayName, description))
 
 , m_quality(1.0f)
 
 {
 
-// Zasoby są zawsze stackowalne
-
-m_stackable = true;
-
-m_maxStackSize = 999;
-// Ustaw domyślne właściwości zasobów
-m_weight = 0.5f;
-
-// Specjalna waga dla drewna - jedna kłoda zajmuje cały ekwipunek osadnika (50.0f)
-if (m_resourceType == "Wood") {
-    m_weight = 10.0f;
-}
-
-m_volume = 0.5f;
-m_value = 1;
-m_rarity = ItemRarity::COMMON;
-
 }
 bool ResourceItem::use(GameEntity* user) {
 
@@ -146,7 +177,7 @@ return false;
 auto resourceComp = user->getComponent<ResourceComponent>();
 if (resourceComp) {
     // Dodaj zasób do komponentu
-    resourceComp->addResource(m_resourceType, 1);
+    resourceComp->addResource(getResourceType(), 1);
     return true;
 }
 
@@ -155,15 +186,9 @@ return false;
 }
 std::unique_ptr<Item> ResourceItem::clone() const {
 
-auto cloned = std::make_unique<ResourceItem>(m_resourceType, m_displayName, m_description);
-
-cloned->setWeight(m_weight);
-
-cloned->setVolume(m_volume);
+auto cloned = std::make_unique<ResourceItem>(getResourceType(), getDisplayName(), getDescription());
 
-cloned->setValue(m_value);
-
-cloned->setRarity(m_rarity);
+cloned->shareDefinition(*this);
 
 cloned->setQuality(m_quality);
 
@@ -179,7 +204,7 @@ EquipmentItem::EquipmentItem(const std::string& displayName, EquipmentSlot slot,
 
 const std::string& description)
 
-: Item(ItemType::EQUIPMENT, displayName, description)
+: Item(makeEquipmentDefinition(displayName, description))
 
 , m_equipmentSlot(slot)
 
@@ -187,17 +212,6 @@ const std::string& description)
 
 {
 
-// Ekwipunek nie jest stackowalny
-
-m_stackable = false;
-
-m_maxStackSize = 1;
-// Ustaw domyślne właściwości ekwipunku
-m_weight = 2.0f;
-m_volume = 2.0f;
-m_value = 10;
-m_rarity = ItemRarity::COMMON;
-
 }
 bool EquipmentItem::use(GameEntity* user) {
 
@@ -216,15 +230,9 @@ if (m_equipped) {
 }
 std::unique_ptr<Item> EquipmentItem::clone() const {
 
-auto cloned = std::make_unique<EquipmentItem>(m_displayName, m_equipmentSlot, m_description);
+auto cloned = std::make_unique<EquipmentItem>(getDisplayName(), m_equipmentSlot, getDescription());
 
-cloned->setWeight(m_weight);
-
-cloned->setVolume(m_volume);
-
-cloned->setValue(m_value);
-
-cloned->setRarity(m_rarity);
+cloned->shareDefinition(*this);
 
 cloned->setStats(m_stats);
 
@@ -266,7 +274,7 @@ return true;
 // ============================================================================
 ConsumableItem::ConsumableItem(const std::string& displayName, const std::string& description)
 
-: Item(ItemType::CONSUMABLE, displayName, description)
+: Item(makeConsumableDefinition(displayName, description))
 
 , m_healthEffect(0.0f)
 
@@ -276,17 +284,6 @@ ConsumableItem::ConsumableItem(const std::string& displayName, const std::string
 
 {
 
-// Przedmioty zużywalne są stackowalne
-
-m_stackable = true;
-
-m_maxStackSize = 20;
-// Ustaw domyślne właściwości
-m_weight = 0.2f;
-m_volume = 0.2f;
-m_value = 5;
-m_rarity = ItemRarity::COMMON;
-
 }
 bool ConsumableItem::use(GameEntity* user) {
 
@@ -304,21 +301,15 @@ return true;
 }
 void ConsumableItem::render(Vector3 position) {
     Color color = GREEN; // Default for food
-    if (m_displayName == "Raw Meat") color = RED; // Mięso na czerwono
+    if (getDisplayName() == "Raw Meat") color = RED; // Mięso na czerwono
     DrawCube(position, 0.3f, 0.3f, 0.3f, color);
     DrawCubeWires(position, 0.3f, 0.3f, 0.3f, DARKGRAY);
 }
 std::unique_ptr<Item> ConsumableItem::clone() const {
 
-auto cloned = std::make_unique<ConsumableItem>(m_displayName, m_description);
-
-cloned->setWeight(m_weight);
-
-cloned->setVolume(m_volume);
-
-cloned->setValue(m_value);
+auto cloned = std::make_unique<ConsumableItem>(getDisplayName(), getDescription());
 
-cloned->setRarity(m_rarity);
+cloned->shareDefinition(*this);
 
 cloned->setHealthEffect(m_healthEffect);
 
@@ -4,35 +4,11 @@
 #include <unordered_map>
 #include <memory>
 #include <raylib.h>
+#include "ItemDefinition.h"
 
 // Forward declarations
 class GameEntity;
 
-/**
- * @brief Typy przedmiotów w grze
- */
-enum class ItemType : uint32_t {
-    RESOURCE = 0,      // Surowce (drewno, kamień, etc.)
-    EQUIPMENT = 1,     // Ekwipunek (broń, zbroja)
-    CONSUMABLE = 2,    // Przedmioty zużywalne (jedzenie, mikstury)
-    TOOL = 3,          // Narzędzia (siekiera, kilof)
-    BUILDING = 4,      // Materiały budowlane
-    QUEST = 5,         // Przedmioty questowe
-    MISC = 6           // Różne
-};
-
-/**
- * @brief Rzadkość przedmiotu
- */
-enum class ItemRarity : uint32_t {
-    COMMON = 0,        // Biały
-    UNCOMMON = 1,      // Zielony
-    RARE = 2,          // Niebieski
-    EPIC = 3,          // Fioletowy
-    LEGENDARY = 4,     // Pomarańczowy
-    MYTHIC = 5         // Czerwony
-};
-
 /**
  * @brief Informacje wyświetlane o przedmiocie
  */
@@ -63,6 +39,12 @@ public:
      */
     Item(ItemType itemType, const std::string& displayName, const std::string& description = "");
 
+    /**
+     * @brief Konstruktor z prototypu definicji (współdzielona definicja z rejestru)
+     * @param proto Prototyp definicji
+     */
+    explicit Item(const ItemDefinition& proto);
+
     /**
      * @brief Wirtualny destruktor
      */
@@ -91,91 +73,111 @@ public:
      * @brief Pobiera typ przedmiotu
      * @return Typ przedmiotu
      */
-    ItemType getItemType() const { return m_itemType; }
+    ItemType getItemType() const { return m_def->type; }
 
     /**
      * @brief Pobiera nazwę wyświetlaną
      * @return Nazwa przedmiotu
      */
-    const std::string& getDisplayName() const { return m_displayName; }
+    const std::string& getDisplayName() const { return m_def->displayName; }
 
     /**
      * @brief Pobiera opis przedmiotu
      * @return Opis przedmiotu
      */
-    const std::string& getDescription() const { return m_description; }
+    const std::string& getDescription() const { return m_def->description; }
 
     /**
      * @brief Pobiera wagę przedmiotu
      * @return Waga w kg
      */
-    float getWeight() const { return m_weight; }
+    float getWeight() const { return m_def->weight; }
 
     /**
      * @brief Pobiera objętość przedmiotu
      * @return Objętość w litrach
      */
-    float getVolume() const { return m_volume; }
+    float getVolume() const { return m_def->volume; }
 
     /**
      * @brief Pobiera wartość przedmiotu
      * @return Wartość w złocie
      */
-    int getValue() const { return m_value; }
+    int getValue() const { return m_def->value; }
 
     /**
      * @brief Pobiera rzadkość przedmiotu
      * @return Rzadkość
      */
-    ItemRarity getRarity() const { return m_rarity; }
+    ItemRarity getRarity() const { return m_def->rarity; }
 
     /**
      * @brief Sprawdza czy przedmiot jest stackowalny
      * @return true jeśli można stackować
      */
-    bool isStackable() const { return m_stackable; }
+    bool isStackable() const { return m_def->stackable; }
 
     /**
      * @brief Pobiera maksymalny rozmiar stacka
      * @return Maksymalna liczba w stacku
      */
-    int getMaxStackSize() const { return m_maxStackSize; }
+    int getMaxStackSize() const { return m_def->maxStackSize; }
+
+    /**
+     * @brief Pobiera współdzieloną definicję przedmiotu
+     * @return Definicja z ItemDefinitionRegistry
+     */
+    const ItemDefinition& getDefinition() const { return *m_def; }
+
+    /**
+     * @brief Pobiera id definicji
+     * @return Id definicji
+     */
+    ItemDefId getDefinitionId() const { return m_def->id; }
+
+    /**
+     * @brief Czy przedmioty mają te same dane definicji (stackowanie)
+     */
+    bool hasSameDefinition(const Item& other) const {
+        // Rejestr nie duplikuje danych - te same dane = ten sam wskaźnik
+        return m_def == other.m_def;
+    }
 
     /**
      * @brief Ustawia wagę przedmiotu
      * @param weight Nowa waga
      */
-    void setWeight(float weight) { m_weight = weight; }
+    void setWeight(float weight) { modifyDefinition([&](ItemDefinition& d) { d.weight = weight; }); }
 
     /**
      * @brief Ustawia objętość przedmiotu
      * @param volume Nowa objętość
      */
-    void setVolume(float volume) { m_volume = volume; }
+    void setVolume(float volume) { modifyDefinition([&](ItemDefinition& d) { d.volume = volume; }); }
 
     /**
      * @brief Ustawia wartość przedmiotu
      * @param value Nowa wartość
      */
-    void setValue(int value) { m_value = value; }
+    void setValue(int value) { modifyDefinition([&](ItemDefinition& d) { d.value = value; }); }
 
     /**
      * @brief Ustawia rzadkość przedmiotu
      * @param rarity Nowa rzadkość
      */
-    void setRarity(ItemRarity rarity) { m_rarity = rarity; }
+    void setRarity(ItemRarity rarity) { modifyDefinition([&](ItemDefinition& d) { d.rarity = rarity; }); }
 
     /**
      * @brief Ustawia czy przedmiot jest stackowalny
      * @param stackable Flaga stackowalności
      */
-    void setStackable(bool stackable) { m_stackable = stackable; }
+    void setStackable(bool stackable) { modifyDefinition([&](ItemDefinition& d) { d.stackable = stackable; }); }
 
     /**
      * @brief Ustawia maksymalny rozmiar stacka
      * @param maxStackSize Maksymalny rozmiar
      */
-    void setMaxStackSize(int maxStackSize) { m_maxStackSize = maxStackSize; }
+    void setMaxStackSize(int maxStackSize) { modifyDefinition([&](ItemDefinition& d) { d.maxStackSize = maxStackSize; }); }
 
     /**
      * @brief Pobiera kolor dla rzadkości
@@ -185,38 +187,24 @@ public:
     static Color getRarityColor(ItemRarity rarity);
 
 protected:
-    /** Typ przedmiotu */
-    ItemType m_itemType;
-    
-    /** Nazwa wyświetlana */
-    std::string m_displayName;
-    
-    /** Opis przedmiotu */
-    std::string m_description;
-    
-    /** Waga przedmiotu w kg */
-    float m_weight;
-    
-    /** Objętość przedmiotu w litrach */
-    float m_volume;
-    
-    /** Wartość przedmiotu w złocie */
-    int m_value;
-    
-    /** Rzadkość przedmiotu */
-    ItemRarity m_rarity;
-    
-    /** Czy przedmiot jest stackowalny */
-    bool m_stackable;
-    
-    /** Maksymalny rozmiar stacka */
-    int m_maxStackSize;
-    
-    /** Ścieżka do ikony przedmiotu */
-    std::string m_iconPath;
-    
-    /** Dodatkowe właściwości przedmiotu */
-    std::unordered_map<std::string, std::string> m_properties;
+    /**
+     * @brief Copy-on-write: zmiana pola daje nową (lub istniejącą) definicję,
+     * współdzielona definicja nigdy nie jest modyfikowana
+     */
+    template <typename Fn>
+    void modifyDefinition(Fn&& fn) {
+        ItemDefinition proto = *m_def;
+        fn(proto);
+        m_def = ItemDefinitionRegistry::getInstance().intern(proto);
+    }
+
+    /**
+     * @brief Klon współdzieli definicję oryginału (bez ponownego internowania)
+     */
+    void shareDefinition(const Item& other) { m_def = other.m_def; }
+
+    /** Współdzielona definicja (nazwa, opis, waga, stack, właściwości) */
+    const ItemDefinition* m_def;
 };
 
 /**
@@ -255,7 +243,13 @@ public:
      * @brief Pobiera typ zasobu
      * @return Typ zasobu jako string
      */
-    const std::string& getResourceType() const { return m_resourceType; }
+    const std::string& getResourceType() const { return m_def->resourceType; }
+
+    /**
+     * @brief Pobiera symbol typu zasobu (porównania bez stringów)
+     * @return Zinternowany typ zasobu
+     */
+    StringId getResourceSid() const { return m_def->resourceSid; }
 
     /**
      * @brief Pobiera jakość zasobu
@@ -270,9 +264,6 @@ public:
     void setQuality(float quality) { m_quality = quality; }
 
 private:
-    /** Typ zasobu */
-    std::string m_resourceType;
-    
     /** Jakość zasobu (0.0 - 1.0) */
     float m_quality;
 };
@@ -494,7 +485,8 @@ public:
      * @brief Klonuje broń
      */
     std::unique_ptr<Item> clone() const override {
-        auto clone = std::make_unique<WeaponItem>(m_displayName, getEquipmentSlot(), m_damage, m_range, m_cooldown, m_description);
+        auto clone = std::make_unique<WeaponItem>(getDisplayName(), getEquipmentSlot(), m_damage, m_range, m_cooldown, getDescription());
+        clone->shareDefinition(*this);
         clone->setStats(getStats());
         // Copy other base properties if needed
         return clone;
@@ -541,13 +533,8 @@ public:
      * @brief Klonowanie przedmiotu
      */
     std::unique_ptr<Item> clone() const override {
-        auto item = std::make_unique<MiscItem>(m_displayName, m_description);
-        item->setWeight(m_weight);
-        item->setValue(m_value);
-        item->setVolume(m_volume);
-        item->setRarity(m_rarity);
-        item->setStackable(m_stackable);
-        item->setMaxStackSize(m_maxStackSize);
+        auto item = std::make_unique<MiscItem>(getDisplayName(), getDescription());
+        item->shareDefinition(*this);
         return item;
     }
 };
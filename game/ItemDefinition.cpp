@@ -0,0 +1,73 @@
+#include "ItemDefinition.h"
+#include <cstdlib>
+#include <iostream>
+
+bool ItemDefinition::sameData(const ItemDefinition& other) const {
+    return type == other.type && nameSid == other.nameSid &&
+           displayName == other.displayName &&
+           description == other.description && weight == other.weight &&
+           volume == other.volume && value == other.value &&
+           rarity == other.rarity && stackable == other.stackable &&
+           maxStackSize == other.maxStackSize && iconPath == other.iconPath &&
+           resourceSid == other.resourceSid && properties == other.properties;
+}
+
+ItemDefinitionRegistry& ItemDefinitionRegistry::getInstance() {
+    static ItemDefinitionRegistry instance;
+    return instance;
+}
+
+const ItemDefinition* ItemDefinitionRegistry::intern(const ItemDefinition& proto) {
+    ItemDefinition def = proto;
+    def.nameSid = StringInterner::intern(proto.displayName);
+    def.resourceSid = StringInterner::intern(proto.resourceType);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto range = m_byName.equal_range(def.nameSid.value);
+    for (auto it = range.first; it != range.second; ++it) {
+        const ItemDefinition& existing = m_definitions[it->second];
+        if (existing.sameData(def)) {
+            return &existing;
+        }
+    }
+
+    if (m_definitions.size() >= INVALID_ITEM_DEF) {
+        // Pełny rejestr - cudza definicja zepsułaby stackowanie i dane
+        // przedmiotu, a prywatna kopia kosztowałaby pamięć każdy Item
+        std::cerr << "[ItemDefinitionRegistry] Definition limit reached for '"
+                  << proto.displayName << "', aborting" << std::endl;
+        std::abort();
+    }
+
+    def.id = static_cast<ItemDefId>(m_definitions.size());
+    m_definitions.push_back(std::move(def));
+    m_byName.emplace(m_definitions.back().nameSid.value, m_definitions.back().id);
+    return &m_definitions.back();
+}
+
+const ItemDefinition* ItemDefinitionRegistry::get(ItemDefId id) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (id >= m_definitions.size()) {
+        return nullptr;
+    }
+    return &m_definitions[id];
+}
+
+const ItemDefinition* ItemDefinitionRegistry::findByName(StringId nameSid) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // Multimapa nie gwarantuje kolejności - bierzemy najniższe id (pierwszą rejestrację)
+    auto range = m_byName.equal_range(nameSid.value);
+    const ItemDefinition* first = nullptr;
+    for (auto it = range.first; it != range.second; ++it) {
+        if (!first || it->second < first->id) {
+            first = &m_definitions[it->second];
+        }
+    }
+    return first;
+}
+
+size_t ItemDefinitionRegistry::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_definitions.size();
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "../core/StringId.h"
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @brief Typy przedmiotów w grze
+ */
+enum class ItemType : uint32_t {
+    RESOURCE = 0,      // Surowce (drewno, kamień, etc.)
+    EQUIPMENT = 1,     // Ekwipunek (broń, zbroja)
+    CONSUMABLE = 2,    // Przedmioty zużywalne (jedzenie, mikstury)
+    TOOL = 3,          // Narzędzia (siekiera, kilof)
+    BUILDING = 4,      // Materiały budowlane
+    QUEST = 5,         // Przedmioty questowe
+    MISC = 6           // Różne
+};
+
+/**
+ * @brief Rzadkość przedmiotu
+ */
+enum class ItemRarity : uint32_t {
+    COMMON = 0,        // Biały
+    UNCOMMON = 1,      // Zielony
+    RARE = 2,          // Niebieski
+    EPIC = 3,          // Fioletowy
+    LEGENDARY = 4,     // Pomarańczowy
+    MYTHIC = 5         // Czerwony
+};
+
+/** Kompaktowy identyfikator definicji przedmiotu */
+using ItemDefId = uint16_t;
+constexpr ItemDefId INVALID_ITEM_DEF = 0xFFFF;
+
+/**
+ * @brief Niezmienne, współdzielone dane przedmiotu (flyweight).
+ *
+ * Wszystkie egzemplarze "Wood" w ekwipunkach, magazynach i na ziemi
+ * wskazują na tę samą definicję - pojedynczy Item trzyma tylko wskaźnik
+ * do niej i swój stan (jakość, założenie, cooldown).
+ */
+struct ItemDefinition {
+    ItemDefId id = 0;
+    ItemType type = ItemType::MISC;
+    StringId nameSid;
+    std::string displayName;
+    std::string description;
+    float weight = 1.0f;
+    float volume = 1.0f;
+    int value = 1;
+    ItemRarity rarity = ItemRarity::COMMON;
+    bool stackable = true;
+    int maxStackSize = 64;
+    std::string iconPath;
+    std::unordered_map<std::string, std::string> properties;
+
+    // Tylko dla ItemType::RESOURCE
+    std::string resourceType;
+    StringId resourceSid;
+
+    /**
+     * @brief Porównuje dane współdzielone (bez id)
+     */
+    bool sameData(const ItemDefinition& other) const;
+};
+
+/**
+ * @brief Rejestr definicji przedmiotów.
+ *
+ * intern() zwraca istniejącą definicję o identycznych danych albo
+ * rejestruje nową. Definicje nigdy nie są usuwane, więc wskaźniki są
+ * stabilne przez cały czas życia gry. Rejestr mieści INVALID_ITEM_DEF
+ * definicji - przekroczenie limitu jest błędem krytycznym (abort).
+ */
+class ItemDefinitionRegistry {
+public:
+    static ItemDefinitionRegistry& getInstance();
+
+    /**
+     * @brief Rejestruje definicję (lub zwraca istniejącą o tych samych danych)
+     * @param proto Prototyp - pole id jest ignorowane
+     * @return Wskaźnik na definicję w rejestrze (nigdy nullptr)
+     */
+    const ItemDefinition* intern(const ItemDefinition& proto);
+
+    /**
+     * @brief Pobiera definicję po id
+     * @return nullptr jeśli id jest nieznane
+     */
+    const ItemDefinition* get(ItemDefId id) const;
+
+    /**
+     * @brief Pierwsza zarejestrowana definicja o danej nazwie
+     */
+    const ItemDefinition* findByName(StringId nameSid) const;
+
+    size_t size() const;
+
+private:
+    ItemDefinitionRegistry() = default;
+
+    std::deque<ItemDefinition> m_definitions; // indeks == id, stabilne adresy
+    std::unordered_multimap<uint32_t, ItemDefId> m_byName;
+    mutable std::mutex m_mutex;
+};
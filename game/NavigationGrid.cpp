@@ -1,4 +1,6 @@
 #include "NavigationGrid.h"
+#include "../core/Profiler.h"
+#include "../core/SystemAccess.h"
 #include "../systems/BuildingSystem.h"
 #include "Tree.h"
 #include "ResourceNode.h"
@@ -77,9 +79,10 @@ bool NavigationGrid::IsWithinBounds(int x, int y) const {
 }
 
 void NavigationGrid::UpdateGrid(const std::vector<BuildingInstance*>& buildings, 
-               const std::vector<Tree*>& trees,
+               const FrameVector<Tree*>& trees,
                const std::vector<std::unique_ptr<ResourceNode>>& resources) {
-    
+    PROFILE_ZONE("NavigationGrid::UpdateGrid");
+
     // Reset walkability
     for (auto& node : m_nodes) {
         node.isWalkable = true;
@@ -90,7 +93,7 @@ void NavigationGrid::UpdateGrid(const std::vector<BuildingInstance*>& buildings,
         if (!building) continue;
         
         // Ignore floor and simple_storage - they are walkable
-        if (building->getBlueprintId() == "floor" || building->getBlueprintId() == "simple_storage") continue;
+        if (building->getBlueprintSid() == Ids::Floor || building->getBlueprintSid() == Ids::SimpleStorage) continue;
 
         const BuildingBlueprint* bp = building->getBlueprint();
 
@@ -203,9 +206,9 @@ void NavigationGrid::UpdateGrid(const std::vector<BuildingInstance*>& buildings,
 
             // Obsługa drzwi - jeśli są, odblokuj ich pole
             // Check building type if it is a door or has door component
-            if (building->getBlueprintId() == "door" || building->getDoor()) {
+            if (building->getBlueprintSid() == Ids::Door || building->getDoor()) {
                 // Drzwi są zawsze przechodnie dla Pathfindingu (osadnik je otworzy)
-                if (building->getBlueprintId() == "door") {
+                if (building->getBlueprintSid() == Ids::Door) {
                      Vector3 doorPos = building->getPosition();
                      GridCoords doorCoords = WorldToGridCoords(doorPos);
                      SetWalkable(doorCoords.x, doorCoords.y, true);
@@ -269,9 +272,8 @@ float NavigationGrid::GetDistance(GridNode* nodeA, GridNode* nodeB) const {
     return 14.0f * dstX + 10.0f * (dstY - dstX);
 }
 
-std::vector<GridNode*> NavigationGrid::GetNeighbors(GridNode* node) {
-    std::vector<GridNode*> neighbors;
-    neighbors.reserve(8);
+void NavigationGrid::GetNeighbors(GridNode* node, FrameVector<GridNode*>& neighbors) {
+    neighbors.clear();
     
     for (int x = -1; x <= 1; ++x) {
         for (int y = -1; y <= 1; ++y) {
@@ -297,11 +299,12 @@ std::vector<GridNode*> NavigationGrid::GetNeighbors(GridNode* node) {
             }
         }
     }
-    
-    return neighbors;
 }
 
 std::vector<Vector3> NavigationGrid::FindPath(Vector3 startWorld, Vector3 endWorld) {
+    PROFILE_ZONE("NavigationGrid::FindPath");
+    // A* zapisuje koszty i rodziców we wspólnych węzłach siatki
+    SystemAccess::check<NavigationGrid>(SystemAccess::Mode::Write);
     GridCoords startCoords = WorldToGridCoords(startWorld);
     GridCoords endCoords = WorldToGridCoords(endWorld);
     
@@ -312,12 +315,16 @@ std::vector<Vector3> NavigationGrid::FindPath(Vector3 startWorld, Vector3 endWor
 
     GridNode* startNode = &m_nodes[startCoords.y * m_width + startCoords.x];
     GridNode* endNode = &m_nodes[endCoords.y * m_width + endCoords.x];
+
+    // Bufor sąsiadów współdzielony przez całe wyszukiwanie (arena klatki)
+    FrameVector<GridNode*> neighbors;
+    neighbors.reserve(8);
     
     // Jeśli cel jest niedostępny, spróbuj znaleźć najbliższy dostępny węzeł wokół celu
     if (!endNode->isWalkable) {
         // Proste przeszukanie sąsiadów celu
         bool foundAlternative = false;
-        std::vector<GridNode*> neighbors = GetNeighbors(endNode);
+        GetNeighbors(endNode, neighbors);
         // Sortuj po dystansie do startu, żeby nie iść na około
         std::sort(neighbors.begin(), neighbors.end(), [this, startNode](GridNode* a, GridNode* b){
             return GetDistance(a, startNode) < GetDistance(b, startNode);
@@ -354,11 +361,11 @@ std::vector<Vector3> NavigationGrid::FindPath(Vector3 startWorld, Vector3 endWor
     
     openSet.push(startNode);
     
-    // Użyj std::vector<bool> dla szybkiego sprawdzania obecności w OpenSet i ClosedSet
+    // Bitsety dla szybkiego sprawdzania obecności w OpenSet i ClosedSet (z areny klatki)
     // Rozmiar musi być równy liczbie węzłów
     size_t gridSize = m_nodes.size();
-    std::vector<bool> inClosedSet(gridSize, false);
-    std::vector<bool> inOpenSet(gridSize, false);
+    std::vector<bool, FrameAllocator<bool>> inClosedSet(gridSize, false);
+    std::vector<bool, FrameAllocator<bool>> inOpenSet(gridSize, false);
 
     inOpenSet[startNode->y * m_width + startNode->x] = true;
 
@@ -382,7 +389,8 @@ std::vector<Vector3> NavigationGrid::FindPath(Vector3 startWorld, Vector3 endWor
             return path;
         }
 
-        for (GridNode* neighbor : GetNeighbors(currentNode)) {
+        GetNeighbors(currentNode, neighbors);
+        for (GridNode* neighbor : neighbors) {
             int neighborIndex = neighbor->y * m_width + neighbor->x;
             
             if (!neighbor->isWalkable || inClosedSet[neighborIndex]) {
@@ -4,6 +4,7 @@
 #include <raylib.h>
 #include <raymath.h>
 #include <memory>
+#include "../core/FrameArena.h"
 
 // Forward declarations
 class BuildingInstance;
@@ -43,7 +44,7 @@ public:
     // Główna funkcja aktualizacji siatki
     // Przyjmuje kontenery wskaźników (surowe lub smart pointery w zależności od definicji w systemie)
     void UpdateGrid(const std::vector<BuildingInstance*>& buildings, 
-                   const std::vector<Tree*>& trees,
+                   const FrameVector<Tree*>& trees,
                    const std::vector<std::unique_ptr<ResourceNode>>& resources);
 
     // Algorytm A*
@@ -62,5 +63,6 @@ private:
     std::vector<GridNode> m_nodes;
     
     float GetDistance(GridNode* nodeA, GridNode* nodeB) const;
-    std::vector<GridNode*> GetNeighbors(GridNode* node);
+    // Wypełnia bufor wywołującego (czyszczony na wejściu), bez alokacji per węzeł
+    void GetNeighbors(GridNode* node, FrameVector<GridNode*>& neighbors);
 };
\ No newline at end of file
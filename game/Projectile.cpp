@@ -1,7 +1,8 @@
 #include "Projectile.h"
+#include "../core/FixedTimestep.h"
 
 Projectile::Projectile(Vector3 startPos, Vector3 targetPos, float speed, float damage)
-    : position(startPos), speed(speed), damage(damage), active(true), lifeTime(5.0f) {
+    : position(startPos), prevPosition(startPos), speed(speed), damage(damage), active(true), lifeTime(5.0f) {
     
     // Calculate initial velocity based on direction to target
     Vector3 direction = Vector3Normalize(Vector3Subtract(targetPos, startPos));
@@ -10,7 +11,9 @@ Projectile::Projectile(Vector3 startPos, Vector3 targetPos, float speed, float d
 
 void Projectile::update(float deltaTime) {
     if (!active) return;
-    
+
+    prevPosition = position;
+
     // Apply Gravity to Velocity
     velocity.y -= GRAVITY * deltaTime;
 
@@ -31,7 +34,10 @@ void Projectile::update(float deltaTime) {
 
 void Projectile::render() {
     if (!active) return;
-    
+
+    // Interpolacja między tickami symulacji (stały krok)
+    Vector3 drawPos = Vector3Lerp(prevPosition, position, FixedTimestep::getRenderAlpha());
+
     // Draw tracer line (long, thin, bright)
     if (Vector3LengthSqr(velocity) > 0.1f) {
         // Oblicz ogon na podstawie prędkości - im szybciej tym dłuższy
@@ -40,10 +46,10 @@ void Projectile::render() {
         if (trailLen < 1.0f) trailLen = 1.0f; // Minimalna długość
 
         Vector3 dir = Vector3Normalize(velocity);
-        Vector3 tail = Vector3Subtract(position, Vector3Scale(dir, trailLen));
+        Vector3 tail = Vector3Subtract(drawPos, Vector3Scale(dir, trailLen));
         
         // Główny rdzeń pocisku (jasny żółty)
-        DrawLine3D(position, tail, YELLOW);
+        DrawLine3D(drawPos, tail, YELLOW);
         
         // Opcjonalnie: nieco szerszy wizualnie efekt (jeśli wspierane przez engine, np. druga linia obok)
         // Ale DrawLine3D jest cienkie. 
@@ -12,11 +12,14 @@ public:
     
     bool isActive() const { return active; }
     Vector3 getPosition() const { return position; }
+    // Pozycja przed ostatnim tickiem - odcinek [prev, position] do kolizji
+    Vector3 getPreviousPosition() const { return prevPosition; }
     float getDamage() const { return damage; }
     void deactivate() { active = false; }
 
 private:
     Vector3 position;
+    Vector3 prevPosition;
     Vector3 velocity; // Changed from direction/speed to velocity for physics
     float speed;      // Kept for initial calculation or reference if needed
     float damage;
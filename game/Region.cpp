@@ -5,6 +5,33 @@
 #include "Terrain.h"
 #include "Tree.h"
 #include <iostream>
+#include <random>
+
+// --- RegionContent ---
+
+std::shared_ptr<RegionContent>
+RegionContent::Generate(GridCoord coord, Vector3 center,
+                        unsigned int worldSeed) {
+  // Worker thread: no GetRandomValue (shared raylib state), no GL calls.
+  // Seed depends only on the coordinate, so a region looks the same no
+  // matter when or on which thread it was generated.
+  uint32_t hash = worldSeed ^ 0x9E3779B9u;
+  hash = (hash ^ static_cast<uint32_t>(coord.x)) * 16777619u;
+  hash = (hash ^ static_cast<uint32_t>(coord.z)) * 16777619u;
+  std::mt19937 rng(hash);
+
+  std::uniform_real_distribution<float> nearCenter(-10.0f, 10.0f);
+
+  auto content = std::make_shared<RegionContent>();
+  content->spawnPoints.reserve(32);
+  for (int i = 0; i < 32; ++i) {
+    content->spawnPoints.push_back(
+        {center.x + nearCenter(rng), 0.0f, center.z + nearCenter(rng)});
+  }
+  return content;
+}
+
+// --- Region ---
 
 Region::Region(GridCoord coord, Vector3 center)
     : gridCoord(coord), worldCenter(center), state(RegionState::UNINITIALIZED),
@@ -59,6 +86,21 @@ void Region::SetState(RegionState newState) {
 
 void Region::ActivateFullSimulation() { SetState(RegionState::ACTIVE); }
 
+void Region::AttachContent(std::shared_ptr<RegionContent> newContent) {
+  content = std::move(newContent);
+  if (!content)
+    return;
+
+  // Fresh region: seed the abstract state from generated data so a later
+  // activation restores the same population without touching the RNG
+  if (state == RegionState::UNINITIALIZED) {
+    passiveState.abstractPopulation =
+        static_cast<float>(content->spawnPoints.size() / 8);
+  }
+}
+
+void Region::ReleaseContent() { content.reset(); }
+
 void Region::DeactivateToPassive() { SetState(RegionState::PASSIVE); }
 
 void Region::BackgroundTick(float deltaTime) {
@@ -244,10 +286,16 @@ void Region::SyncFromPassiveState() {
   int targetPopulation = static_cast<int>(passiveState.abstractPopulation);
 
   // Spawn settlers to match abstract population
+  size_t spawnIndex = 0;
   while (static_cast<int>(colony->getSettlers().size()) < targetPopulation) {
     Vector3 spawnPos = worldCenter;
-    spawnPos.x += GetRandomValue(-10, 10);
-    spawnPos.z += GetRandomValue(-10, 10);
+    if (content && !content->spawnPoints.empty()) {
+      spawnPos = content->spawnPoints[spawnIndex++ %
+                                      content->spawnPoints.size()];
+    } else {
+      spawnPos.x += GetRandomValue(-10, 10);
+      spawnPos.z += GetRandomValue(-10, 10);
+    }
     colony->addSettler(spawnPos, "Survivor");
   }
 
@@ -22,6 +22,21 @@ enum class RegionState {
   ACTIVE         // Full simulation (all game objects)
 };
 
+/**
+ * RegionContent - data prepared for a region on a worker thread
+ *
+ * Generate() is pure CPU work (no raylib calls, no game systems), so the
+ * WorldManager runs it on the JobSystem before the player gets close.
+ * Activation itself only swaps pointers.
+ */
+struct RegionContent {
+  std::vector<Vector3> spawnPoints;
+
+  static std::shared_ptr<RegionContent> Generate(GridCoord coord,
+                                                 Vector3 center,
+                                                 unsigned int worldSeed);
+};
+
 /**
  * Region - A chunk of the game world (100x100m by default)
  *
@@ -38,6 +53,9 @@ private:
   Vector3 worldCenter;
   RegionState state;
 
+  // Prepared off-thread by WorldManager (CPU data only, no GPU resources)
+  std::shared_ptr<RegionContent> content;
+
   // Active simulation data
   std::unique_ptr<Colony> colony;
   std::unique_ptr<Terrain> terrain;
@@ -74,6 +92,11 @@ public:
   void BackgroundTick(float deltaTime);
   void Render();
 
+  // Streaming (main thread)
+  void AttachContent(std::shared_ptr<RegionContent> newContent);
+  void ReleaseContent();
+  bool HasContent() const { return content != nullptr; }
+
   // State queries
   bool IsActive() const { return state == RegionState::ACTIVE; }
   RegionState GetState() const { return state; }
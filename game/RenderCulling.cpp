@@ -0,0 +1,283 @@
+#include "RenderCulling.h"
+#include "../systems/BuildingSystem.h"
+#include "Animal.h"
+#include "Colony.h"
+#include "ResourceNode.h"
+#include "Settler.h"
+#include "Terrain.h"
+#include "Tree.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+BoundingBox boxAround(Vector3 base, float halfWidth, float below,
+                      float height) {
+  return BoundingBox{
+      Vector3{base.x - halfWidth, base.y - below, base.z - halfWidth},
+      Vector3{base.x + halfWidth, base.y + height, base.z + halfWidth}};
+}
+
+bool samePosition(Vector3 a, Vector3 b) {
+  return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+// Klucz kształtu z obrotu: kąt sprowadzony do [0,360), bo rzutowanie
+// ujemnej wartości na uint32_t to UB
+uint32_t rotationShape(float degrees) {
+  float angle = fmodf(degrees, 360.0f);
+  if (angle < 0.0f)
+    angle += 360.0f;
+  return static_cast<uint32_t>(angle * 16.0f);
+}
+} // namespace
+
+template <typename BoxFn>
+void RenderCulling::submit(const void *key, CullCategory category,
+                           Vector3 anchor, uint32_t shape,
+                           BoxFn &&computeBox) {
+  auto [it, inserted] =
+      m_index.try_emplace(key, static_cast<uint32_t>(m_entries.size()));
+  if (inserted)
+    m_entries.emplace_back();
+  Entry &entry = m_entries[it->second];
+  entry.seenFrame = m_frame;
+
+  // Ten sam obiekt w tym samym miejscu i kształcie - AABB z cache
+  if (!inserted && entry.category == category &&
+      entry.shape == shape && samePosition(entry.anchor, anchor))
+    return;
+
+  entry.key = key;
+  entry.category = category;
+  entry.shape = shape;
+  entry.anchor = anchor;
+  entry.box = computeBox();
+  m_stats.boundsRebuilt++;
+}
+
+void RenderCulling::gather(const Colony &colony, const Terrain &terrain,
+                           const BuildingSystem *buildingSystem) {
+  m_stats = Stats();
+  if (!m_config.enabled)
+    return;
+  m_frame++;
+
+  for (const Settler *settler : colony.getSettlers()) {
+    Vector3 pos = settler->getRenderPosition();
+    submit(settler, CullCategory::Settler, pos, 0,
+           [pos]() { return boxAround(pos, 1.0f, 0.5f, 2.5f); });
+  }
+  for (const auto &animal : colony.getAnimals()) {
+    if (!animal->isActive())
+      continue;
+    // Zwierzęta są rysowane na y = 0 - obrys obejmuje oba poziomy
+    Vector3 pos = animal->getPosition();
+    submit(animal.get(), CullCategory::Animal, pos, 0, [pos]() {
+      BoundingBox box = boxAround(pos, 1.5f, 0.5f, 2.5f);
+      box.min.y = std::min(box.min.y, -0.5f);
+      box.max.y = std::max(box.max.y, 2.5f);
+      return box;
+    });
+  }
+  for (const Bush *bush : colony.getBushes()) {
+    Vector3 pos = bush->position;
+    submit(bush, CullCategory::Bush, pos, 0,
+           [pos]() { return boxAround(pos, 0.6f, 0.1f, 1.5f); });
+  }
+  for (const WorldItem &worldItem : colony.getDroppedItems()) {
+    if (!worldItem.item || worldItem.pendingRemoval)
+      continue;
+    Vector3 pos = worldItem.position;
+    submit(worldItem.item.get(), CullCategory::DroppedItem, pos, 0,
+           [pos]() { return boxAround(pos, 0.5f, 0.1f, 1.0f); });
+  }
+
+  auto submitNodes = [this](const auto &nodes) {
+    for (const auto &node : nodes) {
+      if (!node || !node->isActive())
+        continue;
+      Vector3 pos = node->getPosition();
+      submit(node.get(), CullCategory::ResourceNode, pos, 0,
+             [pos]() { return boxAround(pos, 1.0f, 0.2f, 2.5f); });
+    }
+  };
+  submitNodes(colony.getResourceNodes());
+  submitNodes(terrain.getResourceNodes());
+
+  for (const auto &tree : terrain.getTrees()) {
+    // Padające drzewo obraca się wokół podstawy - kula o promieniu wysokości
+    uint32_t shape = tree->isStump() ? 1u : (tree->isFalling() ? 2u : 0u);
+    Vector3 pos = tree->getPosition();
+    submit(tree.get(), CullCategory::Tree, pos, shape, [pos, shape]() {
+      if (shape == 1u)
+        return boxAround(pos, 0.5f, 0.3f, 0.6f);
+      if (shape == 2u)
+        return boxAround(pos, 5.6f, 0.3f, 5.6f);
+      return boxAround(pos, 1.6f, 0.3f, 6.0f);
+    });
+  }
+
+  if (buildingSystem) {
+    for (const auto &building : buildingSystem->getBuildings()) {
+      if (!building->isVisible())
+        continue;
+      const BuildingInstance *instance = building.get();
+      submit(instance, CullCategory::Building, instance->getPosition(),
+             rotationShape(instance->getRotation()),
+             [buildingSystem, instance]() {
+               return buildingSystem->getRenderBounds(
+                   buildingSystem->getBlueprint(instance->getBlueprintId()),
+                   instance->getPosition(), instance->getRotation());
+             });
+    }
+    for (const auto &task : buildingSystem->getBuildTasks()) {
+      if (!task->isActive())
+        continue;
+      const BuildTask *buildTask = task.get();
+      submit(buildTask, CullCategory::BuildTask, buildTask->getPosition(),
+             rotationShape(buildTask->getRotation()),
+             [buildingSystem, buildTask]() {
+               return buildingSystem->getRenderBounds(
+                   buildTask->getBlueprint(), buildTask->getPosition(),
+                   buildTask->getRotation());
+             });
+    }
+  }
+
+  evictStale();
+  rebuildCells();
+}
+
+void RenderCulling::evictStale() {
+  for (size_t i = 0; i < m_entries.size();) {
+    if (m_entries[i].seenFrame == m_frame) {
+      ++i;
+      continue;
+    }
+    m_index.erase(m_entries[i].key);
+    if (i + 1 != m_entries.size()) {
+      m_entries[i] = m_entries.back();
+      m_index[m_entries[i].key] = static_cast<uint32_t>(i);
+    }
+    m_entries.pop_back();
+  }
+}
+
+int64_t RenderCulling::cellKey(const BoundingBox &box) const {
+  float size = std::max(m_config.cellSize, 1.0f);
+  int32_t x = static_cast<int32_t>(
+      std::floor((box.min.x + box.max.x) * 0.5f / size));
+  int32_t z = static_cast<int32_t>(
+      std::floor((box.min.z + box.max.z) * 0.5f / size));
+  return (static_cast<int64_t>(x) << 32) ^ static_cast<uint32_t>(z);
+}
+
+void RenderCulling::rebuildCells() {
+  // Przynależność liczona od nowa (obiekty się ruszają), pojemność zostaje
+  for (auto &cell : m_cells)
+    cell.second.members.clear();
+
+  for (uint32_t i = 0; i < m_entries.size(); ++i) {
+    const BoundingBox &box = m_entries[i].box;
+    Cell &cell = m_cells[cellKey(box)];
+    if (cell.members.empty()) {
+      cell.bounds = box;
+    } else {
+      cell.bounds.min = Vector3Min(cell.bounds.min, box.min);
+      cell.bounds.max = Vector3Max(cell.bounds.max, box.max);
+    }
+    cell.members.push_back(i);
+  }
+
+  for (auto it = m_cells.begin(); it != m_cells.end();) {
+    if (it->second.members.empty())
+      it = m_cells.erase(it);
+    else
+      ++it;
+  }
+}
+
+void RenderCulling::cull(const Frustum &frustum) {
+  m_visible.clear();
+  if (!m_config.enabled)
+    return;
+
+  size_t boundsRebuilt = m_stats.boundsRebuilt;
+  m_stats = Stats();
+  m_stats.boundsRebuilt = boundsRebuilt;
+  m_stats.cells = m_cells.size();
+
+  for (const auto &cellPair : m_cells) {
+    const Cell &cell = cellPair.second;
+    Frustum::Result cellResult = frustum.classify(cell.bounds);
+    if (cellResult == Frustum::Result::Outside)
+      m_stats.cellsCulled++;
+
+    for (uint32_t index : cell.members) {
+      Entry &entry = m_entries[index];
+      m_stats.tested++;
+      if (cellResult == Frustum::Result::Intersects) {
+        m_stats.boxTests++;
+        entry.visible = frustum.intersects(entry.box);
+      } else {
+        entry.visible = cellResult == Frustum::Result::Inside;
+      }
+
+      if (entry.visible) {
+        m_stats.drawn++;
+        m_stats.drawnByCategory[static_cast<size_t>(entry.category)]++;
+        m_visible.push_back(entry.key);
+      } else {
+        m_stats.culled++;
+      }
+    }
+  }
+  m_frustum = frustum;
+  m_culledFrame = m_frame;
+}
+
+bool RenderCulling::isVisible(const void *object) const {
+  if (!m_config.enabled || m_culledFrame != m_frame)
+    return true;
+  auto it = m_index.find(object);
+  return it == m_index.end() || m_entries[it->second].visible;
+}
+
+bool RenderCulling::isBoxVisible(const BoundingBox &box) const {
+  if (!m_config.enabled || m_culledFrame != m_frame)
+    return true;
+  return m_frustum.intersects(box);
+}
+
+void RenderCulling::clear() {
+  m_entries.clear();
+  m_index.clear();
+  m_cells.clear();
+  m_visible.clear();
+  m_stats = Stats();
+  m_culledFrame = 0;
+}
+
+const char *RenderCulling::categoryName(CullCategory category) {
+  switch (category) {
+  case CullCategory::Settler:
+    return "settlers";
+  case CullCategory::Animal:
+    return "animals";
+  case CullCategory::Tree:
+    return "trees";
+  case CullCategory::ResourceNode:
+    return "resources";
+  case CullCategory::Bush:
+    return "bushes";
+  case CullCategory::Building:
+    return "buildings";
+  case CullCategory::BuildTask:
+    return "build sites";
+  case CullCategory::DroppedItem:
+    return "items";
+  case CullCategory::Count:
+    break;
+  }
+  return "?";
+}
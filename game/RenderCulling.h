@@ -0,0 +1,124 @@
+#pragma once
+
+#include "../core/Frustum.h"
+#include <cstddef>
+#include <cstdint>
+#include <raylib.h>
+#include <unordered_map>
+#include <vector>
+
+class BuildingSystem;
+class Colony;
+class Terrain;
+
+enum class CullCategory : uint8_t {
+  Settler,
+  Animal,
+  Tree,
+  ResourceNode,
+  Bush,
+  Building,
+  BuildTask,
+  DroppedItem,
+  Count
+};
+
+/**
+ * @brief Odrzucanie obiektów poza bryłą widzenia aktywnej kamery.
+ *
+ * Raz na klatkę (przed BeginMode3D):
+ *   culling.gather(colony, terrain, g_buildingSystem); // AABB + siatka
+ *   culling.cull(Frustum::FromCamera(camera, aspect, near, far));
+ * a pętle rysujące pytają isVisible(obiekt).
+ *
+ * AABB są trzymane między klatkami i przeliczane tylko, gdy obiekt zmienił
+ * pozycję albo kształt (np. drzewo zaczęło padać). Obiekty są grupowane
+ * w komórki siatki XZ - komórka całkowicie poza bryłą odrzuca wszystkie
+ * swoje obiekty jednym testem, całkowicie wewnątrz - przyjmuje. Obiekty,
+ * które zniknęły ze świata, wypadają z cache przy następnym gather.
+ *
+ * Krok cull nie używa GPU, więc zbiór widocznych i liczniki można
+ * sprawdzić w trybie headless.
+ */
+class RenderCulling {
+public:
+  struct Config {
+    bool enabled = true;
+    float cellSize = 32.0f; // bok komórki siatki (m)
+  };
+
+  struct Stats {
+    size_t tested = 0;   // obiekty rozważone w klatce
+    size_t culled = 0;   // odrzucone
+    size_t drawn = 0;    // w zbiorze widocznych
+    size_t boxTests = 0; // testy AABB pojedynczych obiektów
+    size_t cells = 0;
+    size_t cellsCulled = 0;
+    size_t boundsRebuilt = 0; // AABB przeliczone (reszta z cache)
+    size_t drawnByCategory[static_cast<size_t>(CullCategory::Count)] = {};
+  };
+
+  static RenderCulling &getInstance() {
+    static RenderCulling instance;
+    return instance;
+  }
+
+  /** Zbiera obiekty świata i odświeża ich AABB oraz siatkę */
+  void gather(const Colony &colony, const Terrain &terrain,
+              const BuildingSystem *buildingSystem);
+  /** Wyznacza zbiór widocznych obiektów i liczniki klatki */
+  void cull(const Frustum &frustum);
+
+  /**
+   * @brief Czy obiekt przeszedł cull w tej klatce.
+   * Wyłączony culling, brak cull w tej klatce albo obiekt spoza gather -
+   * true (lepiej narysować za dużo niż zgubić obiekt).
+   */
+  bool isVisible(const void *object) const;
+  /** Test dowolnego AABB bryłą z ostatniego cull (np. siatki chunków) */
+  bool isBoxVisible(const BoundingBox &box) const;
+
+  const std::vector<const void *> &getVisible() const { return m_visible; }
+  Config &getConfig() { return m_config; }
+  const Stats &getStats() const { return m_stats; }
+  size_t getCachedCount() const { return m_entries.size(); }
+  void clear();
+
+  static const char *categoryName(CullCategory category);
+
+private:
+  struct Entry {
+    const void *key = nullptr;
+    BoundingBox box{};
+    Vector3 anchor{}; // pozycja, z której policzono box
+    uint32_t shape = 0;
+    CullCategory category = CullCategory::Settler;
+    uint32_t seenFrame = 0;
+    bool visible = true;
+  };
+
+  struct Cell {
+    BoundingBox bounds{};
+    std::vector<uint32_t> members;
+  };
+
+  RenderCulling() = default;
+
+  template <typename BoxFn>
+  void submit(const void *key, CullCategory category, Vector3 anchor,
+              uint32_t shape, BoxFn &&computeBox);
+  void evictStale();
+  void rebuildCells();
+  int64_t cellKey(const BoundingBox &box) const;
+
+  Config m_config;
+  Stats m_stats;
+  uint32_t m_frame = 0;
+  uint32_t m_culledFrame = 0;
+  Frustum m_frustum{};
+
+  std::vector<Entry> m_entries;
+  std::unordered_map<const void *, uint32_t> m_index;
+  std::unordered_map<int64_t, Cell> m_cells;
+  std::vector<const void *> m_visible;
+};
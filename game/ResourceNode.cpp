@@ -27,22 +27,23 @@ void ResourceNode::render() {
     // Offset Y to prevent sinking into ground (DrawCube draws from center)
     pos.y += 0.5f;
 
-    Color color = GRAY; // Default for Stone
-
-    switch (m_type) {
-        case Resources::ResourceType::Wood: color = BROWN; break;
-        case Resources::ResourceType::Stone: color = GRAY; break;
-        case Resources::ResourceType::Food: color = ORANGE; break; // Bush?
-        case Resources::ResourceType::Metal: color = DARKGRAY; break;
-        case Resources::ResourceType::Gold: color = YELLOW; break;
-        default: break;
-    }
-
     // Simple geometric representation for now
+    Color color = getRenderColor();
     DrawCube(pos, 1.0f, 1.0f, 1.0f, color);
     DrawCubeWires(pos, 1.0f, 1.0f, 1.0f, DARKGRAY);
 }
 
+Color ResourceNode::getRenderColor() const {
+    switch (m_type) {
+        case Resources::ResourceType::Wood: return BROWN;
+        case Resources::ResourceType::Stone: return GRAY;
+        case Resources::ResourceType::Food: return ORANGE; // Bush?
+        case Resources::ResourceType::Metal: return DARKGRAY;
+        case Resources::ResourceType::Gold: return YELLOW;
+        default: return GRAY; // Default for Stone
+    }
+}
+
 int32_t ResourceNode::getCurrentAmount() const {
     return m_currentAmount;
 }
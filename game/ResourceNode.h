@@ -15,6 +15,7 @@ public:
     
     void update(float deltaTime);
     void render();
+    Color getRenderColor() const;
     int32_t getCurrentAmount() const;
     int32_t getMaxAmount() const { return m_maxAmount; }
     bool isDepleted() const;
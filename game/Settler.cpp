@@ -16,6 +16,9 @@ extern std::unique_ptr<Player> g_player;
 #include <rlgl.h> // Matrix rotation
 
 #include "Settler.h"
+#include "../core/FixedTimestep.h"
+#include "../core/Logger.h"
+#include "../core/Profiler.h"
 #include "Terrain.h"
 #include "Tree.h"
 
@@ -45,6 +48,7 @@ extern std::unique_ptr<Player> g_player;
 #include "../core/GameEngine.h"
 #include "Item.h"
 #include "Projectile.h"
+#include "WorldCommandBuffer.h"
 
 #include "../core/GameSystem.h"
 
@@ -99,29 +103,34 @@ float Settler::s_fpsPitch = -80.0f;    // Unchanged
 
 Settler::Settler(const std::string &name, const Vector3 &pos,
                  SettlerProfession profession)
-    : GameEntity(name), m_name(name), m_profession(profession),
-      m_isSelected(false), position(pos), m_state(SettlerState::IDLE),
+    // Kolejność jak deklaracje w Settler.h (-Wreorder)
+    : GameEntity(name), m_weaponSpeed(120.0f),
 
-      m_targetPosition(pos), m_moveSpeed(5.0f), m_rotation(0.0f),
-      m_weaponSpeed(120.0f),
+      m_name(name), m_profession(profession), m_isSelected(false),
+      position(pos), m_prevPosition(pos),
+
+      m_moveSpeed(5.0f), m_targetPosition(pos), m_rotation(0.0f),
 
       m_currentBuildTask(nullptr), m_currentGatherTask(nullptr),
       m_targetStorage(nullptr), m_targetWorkshop(nullptr),
-
-      m_gatherTimer(0.0f), m_gatherInterval(1.0f),
+      m_isIndependentBuilder(false), m_myPrivateBuildTask(nullptr),
 
       m_currentGatherBush(nullptr), m_currentTree(nullptr),
       m_assignedBed(nullptr), m_targetFoodBush(nullptr),
+      m_gatherInterval(1.0f),
 
-      m_eatingTimer(0.0f),
-      m_craftingTimer(0.0f), // Removed /* m_currentPathIndex */ 0
-      m_aiSearchTimer((float)(rand() % 100) /
-                      200.0f), // Random offset 0-0.5s to desync settlers
       m_isMovingToCriticalTarget(false), m_pendingReevaluation(false),
       m_sleepCooldownTimer(0.0f), m_eatingCooldownTimer(0.0f),
       m_sleepEnterThreshold(30.0f), m_sleepExitThreshold(80.0f),
       m_hungerEnterThreshold(40.0f), m_hungerExitThreshold(80.0f),
-      m_isIndependentBuilder(false), m_myPrivateBuildTask(nullptr) {
+
+      m_gatherTimer(0.0f), m_eatingTimer(0.0f),
+      m_craftingTimer(0.0f), // Removed /* m_currentPathIndex */ 0
+
+      m_state(SettlerState::IDLE) {
+
+  // Random offset 0-0.5s to desync settlers in AIScheduler
+  m_aiSchedule.sinceDecision = (float)(rand() % 100) / 200.0f;
 
   m_traitsComponent = std::make_unique<TraitsComponent>(this);
   m_traitsComponent->initialize();
@@ -233,11 +242,8 @@ void Settler::shoot(Vector3 targetPos) {
   auto projectile = std::make_unique<Projectile>(muzzlePos, finalTarget,
                                                  m_weaponSpeed, m_weaponDamage);
 
-  // Add to world
-  Colony *colony = GameSystem::getColony();
-  if (colony) {
-    colony->addProjectile(std::move(projectile));
-  }
+  // Add to world (Colony odtworzy komendę w punkcie synchronizacji)
+  WorldCommandBuffer::spawnProjectile(std::move(projectile));
 
   // Set cooldown
   m_shootCooldownTimer = 0.5f; // 2 shots per second (adjustable)
@@ -300,6 +306,91 @@ void Settler::useHeldItem(Vector3 targetPos) {
   }
 }
 
+void Settler::Think(const SettlerWorldView &world) {
+  PROFILE_ZONE("Settler::Think");
+  m_intent = SettlerIntent();
+  if (!m_stats->isAlive() || m_isPlayerControlled)
+    return;
+
+  m_intent.state = m_state;
+
+  switch (m_state) {
+  case SettlerState::IDLE: {
+    // Cele do zbierania materiałów potrzebne tylko przy budowie; bez
+    // przydziału AIScheduler decyzja i tak nie zapadnie w tym ticku
+    if (!m_actionQueue.empty() || !m_aiSchedule.granted ||
+        !(performBuilding || m_currentBuildTask || m_myPrivateBuildTask))
+      return;
+
+    // Kłody leżące na ziemi (jak PRIORITY 0 w Update)
+    float minItemDist = 50.0f;
+    for (size_t i = 0; i < world.worldItems.size(); ++i) {
+      const WorldItem &wi = world.worldItems[i];
+      if (!wi.item || wi.pendingRemoval || wi.isReserved() ||
+          wi.item->getItemType() != ItemType::RESOURCE)
+        continue;
+      auto *resItem = dynamic_cast<const ResourceItem *>(wi.item.get());
+      if (resItem && resItem->getResourceSid() == Ids::Wood) {
+        float d = Vector3Distance(position, wi.position);
+        if (d < minItemDist) {
+          minItemDist = d;
+          m_intent.freeLogIndex = (int)i;
+          m_intent.freeLogItem = wi.item.get();
+        }
+      }
+    }
+
+    float minTreeDist = 100.0f;
+    for (const auto &t : world.trees) {
+      if (t->isActive() && !t->isStump() && !t->isReserved()) {
+        float d = Vector3Distance(position, t->getPosition());
+        if (d < minTreeDist) {
+          minTreeDist = d;
+          m_intent.freeTree = t.get();
+        }
+      }
+    }
+
+    float minStoneDist = 200.0f;
+    for (const auto &n : world.resourceNodes) {
+      if (n->isActive() && !n->isReserved() &&
+          n->getResourceType() == Resources::ResourceType::Stone) {
+        float d = Vector3Distance(position, n->getPosition());
+        if (d < minStoneDist) {
+          minStoneDist = d;
+          m_intent.freeStone = n.get();
+        }
+      }
+    }
+    break;
+  }
+  case SettlerState::SEARCHING_FOR_FOOD:
+    m_intent.nearestFood = FindNearestFood(world.bushes);
+    break;
+  case SettlerState::HUNTING: {
+    if (m_currentTargetAnimal)
+      break;
+    float minDist = 50.0f;
+    for (const auto &animalPtr : world.animals) {
+      Animal *animal = animalPtr.get();
+      if (!animal || !animal->isActive() || animal->isDead())
+        continue;
+      float dist = Vector3Distance(position, animal->getPosition());
+      if (dist < minDist) {
+        minDist = dist;
+        m_intent.nearestPrey = animal;
+        m_intent.preyDistance = dist;
+      }
+    }
+    break;
+  }
+  default:
+    break;
+  }
+
+  m_intent.valid = true;
+}
+
 void Settler::Update(
     float deltaTime,
     float currentTime, // [CIRCADIAN] Added time parameter
@@ -315,6 +406,17 @@ void Settler::Update(
     const std::vector<std::unique_ptr<Animal>> &animals,
 
     const std::vector<std::unique_ptr<ResourceNode>> &resourceNodes) {
+  PROFILE_ZONE("Settler::Update");
+  // Cele z Think są ważne tylko w tej klatce - unieważnij przy każdym wyjściu
+  struct IntentExpiry {
+    SettlerIntent &intent;
+    ~IntentExpiry() { intent.valid = false; }
+  } intentExpiry{m_intent};
+
+  // Interpolacja startuje z pokazanej pozycji (LOD może rozłożyć ostatni
+  // krok na kilka ticków)
+  m_prevPosition = Vector3Lerp(m_prevPosition, position, m_simLod.blendFrom);
+
   if (!m_stats->isAlive())
     return;
 
@@ -400,6 +502,7 @@ void Settler::Update(
     m_eatingCooldownTimer -= deltaTime;
 
   if (CheckForJobFlagActivation()) {
+    RequestReevaluation();
     if (IsStateInterruptible()) {
       InterruptCurrentAction();
     } else {
@@ -435,6 +538,11 @@ void Settler::Update(
     // m_currentPath removed - now handled by NavComponent
   }
 
+  // Wynik podniesienia, po które osadnik już nie wróci (zmiana stanu) -
+  // rezerwację i tak zwolnił playback, zapominamy tylko o zleceniu
+  if (m_state != SettlerState::PICKING_UP)
+    m_pendingPickup = 0;
+
   switch (m_state) {
   case SettlerState::SEARCHING_FOR_FOOD:
     UpdateSearchingForFood(deltaTime, bushes);
@@ -498,6 +606,12 @@ void Settler::Update(
       return;
     }
 
+    // Decyzje rozkłada w czasie AIScheduler (budżet na tick) - bez
+    // przydziału osadnik czeka, zamiast co tick przeszukiwać świat
+    if (!m_aiSchedule.granted)
+      break;
+    m_aiSchedule.sinceDecision = 0.0f;
+
     // 1. INDEPENDENT BUILDER LOGIC: Ensure House Exists
     if (m_isIndependentBuilder && !hasHouse) {
       if (!m_myPrivateBuildTask || !m_myPrivateBuildTask->isActive()) {
@@ -612,7 +726,27 @@ void Settler::Update(
             // PRIORITY 0: Check for WorldItems (Logs) on ground
             float minItemDist = 50.0f;
             int foundItemIdx = -1;
-            for (size_t i = 0; i < worldItems.size(); ++i) {
+            bool scanItems = true;
+            if (HasIntentFor(SettlerState::IDLE)) {
+              // Kandydat z Think - mógł go już zająć ktoś wcześniej w klatce,
+              // a slot mógł dostać inny przedmiot: ten sam Item i nadal drewno
+              int idx = m_intent.freeLogIndex;
+              if (idx < 0) {
+                scanItems = false;
+              } else if (idx < (int)worldItems.size() &&
+                         worldItems[idx].item &&
+                         worldItems[idx].item.get() == m_intent.freeLogItem &&
+                         !worldItems[idx].isReserved() &&
+                         !worldItems[idx].pendingRemoval) {
+                auto *resItem =
+                    dynamic_cast<ResourceItem *>(worldItems[idx].item.get());
+                if (resItem && resItem->getResourceSid() == Ids::Wood) {
+                  foundItemIdx = idx;
+                  scanItems = false;
+                }
+              }
+            }
+            for (size_t i = 0; scanItems && i < worldItems.size(); ++i) {
               if (worldItems[i].item &&
                   worldItems[i].item->getItemType() == ItemType::RESOURCE &&
                   !worldItems[i].isReserved()) {
@@ -648,7 +782,19 @@ void Settler::Update(
             // PRIORITY 1: Find Tree
             float minDist = 100.0f;
             Tree *nearest = nullptr;
-            for (const auto &t : trees) {
+            bool scanTrees = true;
+            if (HasIntentFor(SettlerState::IDLE)) {
+              Tree *candidate = m_intent.freeTree;
+              if (!candidate) {
+                scanTrees = false;
+              } else if (candidate->isActive() && !candidate->isStump() &&
+                         !candidate->isReserved()) {
+                nearest = candidate;
+                scanTrees = false;
+              }
+            }
+            for (size_t i = 0; scanTrees && i < trees.size(); ++i) {
+              const auto &t = trees[i];
               if (t->isActive() && !t->isStump() && !t->isReserved()) {
                 float d = Vector3Distance(position, t->getPosition());
                 if (d < minDist) {
@@ -666,7 +812,18 @@ void Settler::Update(
             // Find Stone
             float minDist = 200.0f;
             ResourceNode *nearest = nullptr;
-            for (const auto &n : resourceNodes) {
+            bool scanNodes = true;
+            if (HasIntentFor(SettlerState::IDLE)) {
+              ResourceNode *candidate = m_intent.freeStone;
+              if (!candidate) {
+                scanNodes = false;
+              } else if (candidate->isActive() && !candidate->isReserved()) {
+                nearest = candidate;
+                scanNodes = false;
+              }
+            }
+            for (size_t i = 0; scanNodes && i < resourceNodes.size(); ++i) {
+              const auto &n = resourceNodes[i];
               if (n->isActive() && !n->isReserved() &&
                   n->getResourceType() == Resources::ResourceType::Stone) {
                 float d = Vector3Distance(position, n->getPosition());
@@ -763,11 +920,25 @@ void Settler::Update(
 
 void Settler::render() { render(false); }
 
+Vector3 Settler::getRenderPosition() const {
+  // Sterowany przez gracza porusza się co klatkę, nie co tick
+  if (m_isPlayerControlled)
+    return position;
+  return Vector3Lerp(m_prevPosition, position,
+                     m_simLod.renderAlpha(FixedTimestep::getRenderAlpha()));
+}
+
+Matrix Settler::getRenderTransform() const {
+  Vector3 drawPos = getRenderPosition();
+  return MatrixMultiply(MatrixRotateY(m_rotation * DEG2RAD),
+                        MatrixTranslate(drawPos.x, drawPos.y, drawPos.z));
+}
+
 void Settler::render(bool isFps) {
   bool usingTool =
       (m_state == SettlerState::CHOPPING || m_state == SettlerState::MINING);
   // NEW RENDERER
-  Color color = m_isSelected ? YELLOW : BLUE;
+  Color color = getRenderColor();
   Color skinColor = {255, 220, 177, 255}; // Light skin
   Color shirtColor = color;               // Profession color
   Color pantsColor = DARKBLUE;
@@ -796,15 +967,16 @@ void Settler::render(bool isFps) {
   // DEBUG: Draw line to target animal
   if (m_state == SettlerState::HUNTING && m_currentTargetAnimal) {
     Vector3 targetPos = m_currentTargetAnimal->getPosition();
-    DrawLine3D(position, targetPos, RED);
+    DrawLine3D(getRenderPosition(), targetPos, RED);
     DrawSphere(targetPos, 0.2f, RED);
 
     // Debug Text - Console only (Camera not accessible here)
   }
 
   // Matrix Transformation for proper rotation
+  Vector3 drawPos = getRenderPosition();
   rlPushMatrix();
-  rlTranslatef(position.x, position.y, position.z);
+  rlTranslatef(drawPos.x, drawPos.y, drawPos.z);
   rlRotatef(m_rotation, 0.0f, 1.0f, 0.0f);
 
   // Draw relative to pivot (Feet at 0,0,0)
@@ -1124,7 +1296,7 @@ void Settler::render(bool isFps) {
       m_currentTree->isActive()) {
     float progress = 1.0f - (m_currentTree->getWoodAmount() /
                              m_currentTree->getMaxWoodAmount());
-    DrawProgressBar3D(position, progress, YELLOW);
+    DrawProgressBar3D(drawPos, progress, YELLOW);
   } else if (m_state == SettlerState::MINING && m_currentResourceNode &&
              m_currentResourceNode->isActive()) {
     // Prevent division by zero
@@ -1132,12 +1304,12 @@ void Settler::render(bool isFps) {
     if (maxAmount > 0.0f) {
       float progress =
           1.0f - ((float)m_currentResourceNode->getCurrentAmount() / maxAmount);
-      DrawProgressBar3D(position, progress, GRAY);
+      DrawProgressBar3D(drawPos, progress, GRAY);
     }
   } else if (m_state == SettlerState::CRAFTING) {
-    DrawProgressBar3D(position, m_craftingTimer / 5.0f, GREEN);
+    DrawProgressBar3D(drawPos, m_craftingTimer / 5.0f, GREEN);
   } else if (m_state == SettlerState::SKINNING) {
-    DrawProgressBar3D(position, m_skinningTimer / 2.0f, RED);
+    DrawProgressBar3D(drawPos, m_skinningTimer / 2.0f, RED);
   }
 }
 
@@ -1145,6 +1317,7 @@ void Settler::render(bool isFps) {
 void Settler::ProcessActiveBuildTask(
     float deltaTime, const std::vector<BuildingInstance *> &buildings,
     std::vector<WorldItem> &worldItems) {
+  PROFILE_ZONE("Settler::ProcessActiveBuildTask");
   // 1. Validation
   if (!m_currentBuildTask || !m_currentBuildTask->isActive()) {
     // std::cout << "[Settler] Build task invalid or finished." << std::endl;
@@ -1322,7 +1495,7 @@ void Settler::ProcessActiveBuildTask(
         angleDiff -= 360;
       while (angleDiff < -180)
         angleDiff += 360;
-      m_rotation += angleDiff * 5.0f * deltaTime;
+      m_rotation += angleDiff * std::min(5.0f * deltaTime, 1.0f);
     }
   } // CRITICAL FIX: Missing closing brace - was causing 66 qualified-id cascade
     // errors
@@ -1794,6 +1967,7 @@ void Settler::UpdateMovement(
     float deltaTime, const std::vector<std::unique_ptr<Tree>> &trees,
     const std::vector<BuildingInstance *> &buildings,
     const std::vector<std::unique_ptr<ResourceNode>> &resourceNodes) {
+  PROFILE_ZONE("Settler::UpdateMovement");
   (void)trees;
   (void)buildings;
 // Jeśli mamy ścieżkę, poruszaj się po waypointach
@@ -1832,7 +2006,7 @@ if (false &&
     angleDiff -= 360;
   while (angleDiff < -180)
     angleDiff += 360;
-  m_rotation += angleDiff * 15.0f * deltaTime;
+  m_rotation += angleDiff * std::min(15.0f * deltaTime, 1.0f);
 
   Vector3 movement = Vector3Scale(direction, m_moveSpeed * deltaTime);
   Vector3 nextPos = Vector3Add(position, movement);
@@ -1854,7 +2028,7 @@ if (false &&
   if (!collisionDetected && g_buildingSystem) {
     auto buildingsNearby = g_buildingSystem->getBuildingsInRange(nextPos, 2.0f);
     for (auto *b : buildingsNearby) {
-      if (b->getBlueprintId() == "floor")
+      if (b->getBlueprintSid() == Ids::Floor)
         continue;
       if (b->CheckCollision(nextPos, 0.4f)) {
         collisionDetected = true;
@@ -1906,17 +2080,26 @@ return;
     angleDiff -= 360;
   while (angleDiff < -180)
     angleDiff += 360;
-  m_rotation += angleDiff * 15.0f * deltaTime;
+  m_rotation += angleDiff * std::min(15.0f * deltaTime, 1.0f);
 
-  Vector3 movement = Vector3Scale(direction, m_moveSpeed * deltaTime);
+  // Duża delta (LOD) nie może przeskoczyć celu
+  Vector3 movement =
+      Vector3Scale(direction, std::min(m_moveSpeed * deltaTime, distance));
   Vector3 nextPos = Vector3Add(position, movement);
 
+  // LOD Macro: daleko od obserwatora ruch po odcinku bez testów kolizji -
+  // i tak nikt tego nie widzi, a koszt skanowania drzew/budynków odpada
+  if (m_simLod.isMacro()) {
+    position = nextPos;
+    return;
+  }
+
   // TREE COLLISION CHECK (ALL TREES, not just stumps)
   for (const auto &tree : trees) {
     if (tree && tree->isActive()) { // Check ALL active trees
       BoundingBox treeBox = tree->getBoundingBox();
       if (CheckCollisionBoxSphere(treeBox, nextPos, 0.4f)) {
-        std::cout << "[Settler] Blocked by tree." << std::endl;
+        LOG_RATE(Debug, Settler, 1, m_name, " blocked by tree.");
         m_state = SettlerState::IDLE;
         // m_currentPath.clear(); // removed - NavComponent handles paths
         return;
@@ -1928,7 +2111,7 @@ return;
   if (g_buildingSystem) {
     auto buildingsNearby = g_buildingSystem->getBuildingsInRange(nextPos, 2.0f);
     for (auto *b : buildingsNearby) {
-      if (b->getBlueprintId() == "floor")
+      if (b->getBlueprintSid() == Ids::Floor)
         continue;
       if (b->CheckCollision(nextPos, 0.4f)) {
         // Collision detected! Try sliding or stop.
@@ -1976,6 +2159,7 @@ return;
 void Settler::UpdateGathering(
     float deltaTime, std::vector<WorldItem> &worldItems,
     const std::vector<BuildingInstance *> &buildings) {
+  PROFILE_ZONE("Settler::UpdateGathering");
   (void)worldItems;
   (void)buildings;
   m_gatherTimer += deltaTime;
@@ -1984,6 +2168,7 @@ void Settler::UpdateGathering(
   }
 }
 void Settler::UpdateBuilding(float deltaTime) {
+  PROFILE_ZONE("Settler::UpdateBuilding");
   if (!m_currentBuildTask) {
     m_state = SettlerState::IDLE;
     return;
@@ -1996,6 +2181,7 @@ void Settler::UpdateBuilding(float deltaTime) {
   }
 }
 void Settler::UpdateSleeping(float deltaTime) {
+  PROFILE_ZONE("Settler::UpdateSleeping");
   // Zmniejsz cooldown snu (jeśli aktywny)
   if (m_sleepCooldownTimer > 0.0f) {
     m_sleepCooldownTimer -= deltaTime;
@@ -2035,6 +2221,7 @@ void Settler::UpdateSleeping(float deltaTime) {
 void Settler::UpdateMovingToStorage(
     float deltaTime, const std::vector<BuildingInstance *> &buildings,
     const std::vector<std::unique_ptr<ResourceNode>> &resourceNodes) {
+  PROFILE_ZONE("Settler::UpdateMovingToStorage");
   (void)buildings;
   // Walidacja celu
   if (std::isnan(m_targetPosition.x) || std::isnan(m_targetPosition.y) ||
@@ -2131,6 +2318,7 @@ void Settler::UpdateMovingToStorage(
 }
 void Settler::UpdateDepositing(
     float deltaTime, const std::vector<BuildingInstance *> &buildings) {
+  PROFILE_ZONE("Settler::UpdateDepositing");
 
   (void)deltaTime;
 
@@ -2185,16 +2373,7 @@ void Settler::UpdateDepositing(
             dynamic_cast<ResourceItem *>(invItem->item.get());
         if (resItem) {
           typeStr = resItem->getResourceType();
-          if (typeStr == "Wood")
-            type = Resources::ResourceType::Wood;
-          else if (typeStr == "Stone")
-            type = Resources::ResourceType::Stone;
-          else if (typeStr == "Food")
-            type = Resources::ResourceType::Food;
-          else if (typeStr == "Metal")
-            type = Resources::ResourceType::Metal;
-          else if (typeStr == "Gold")
-            type = Resources::ResourceType::Gold;
+          type = Resources::resourceTypeFromId(resItem->getResourceSid());
         }
       } else if (invItem->item->getItemType() == ItemType::CONSUMABLE) {
         typeStr = invItem->item->getDisplayName();
@@ -2320,20 +2499,37 @@ void Settler::UpdateDepositing(
 void Settler::UpdatePickingUp(
     float deltaTime, std::vector<WorldItem> &worldItems,
     const std::vector<BuildingInstance *> &buildings) {
+  PROFILE_ZONE("Settler::UpdatePickingUp");
 
   float minDist = 2.0f;
-  int pickedIndex = -1;
+  bool pickedUp = false;
   int nearestItemIndex = -1;
   float nearestItemDist = 9999.0f;
 
+  // Podniesienie zlecone w poprzednim ticku - playback rozstrzygnął je
+  // (resolvePickup) i zwolnił rezerwację, gdy przedmiot został na ziemi
+  if (m_pendingPickup != 0) {
+    pickedUp = m_pickupResolved && m_pickupSucceeded;
+    m_pendingPickup = 0;
+    if (!pickedUp) {
+      LOG_DBG(Settler, m_name, " pickup failed, returning to IDLE");
+      m_state = SettlerState::IDLE;
+      return;
+    }
+    LOG_DBG(Settler, m_name, " picked up item, inventory count ",
+            m_inventory->getItemCount());
+  }
+
   // Scan for pickable items
-  for (size_t i = 0; i < worldItems.size(); ++i) {
+  for (size_t i = 0; !pickedUp && i < worldItems.size(); ++i) {
     if (worldItems[i].pendingRemoval)
       continue;
     if (!worldItems[i].item ||
         (worldItems[i].item->getItemType() != ItemType::RESOURCE &&
          worldItems[i].item->getItemType() != ItemType::CONSUMABLE))
       continue;
+    if (worldItems[i].isReserved() && worldItems[i].m_reservedBy != m_name)
+      continue; // ktoś inny już po niego idzie
 
     float d = Vector3Distance(position, worldItems[i].position);
 
@@ -2343,31 +2539,30 @@ void Settler::UpdatePickingUp(
       nearestItemIndex = (int)i;
     }
 
-    // Attempt pickup
-    if (d < minDist) {
-      if (m_inventory->addItem(std::move(worldItems[i].item))) {
-        worldItems[i].pendingRemoval = true;
-        pickedIndex = (int)i;
-        std::cout << "[Settler] SUCCESS! Picked up item. Inventory count: "
-                  << m_inventory->getItemCount() << std::endl;
-        break; // Picked up one item, stop loop
-      }
+    // Attempt pickup - przeniesienie do ekwipunku w playbacku bufora komend
+    if (d < minDist &&
+        m_inventory->canAdd(*worldItems[i].item, worldItems[i].amount)) {
+      worldItems[i].reserve(m_name);
+      m_pendingPickup = ++m_pickupSequence;
+      if (m_pendingPickup == 0) // 0 = brak zlecenia
+        m_pendingPickup = ++m_pickupSequence;
+      m_pickupResolved = false;
+      m_pickupSucceeded = false;
+      WorldCommandBuffer::moveToInventory(i, worldItems[i].item.get(), this,
+                                          false, m_pendingPickup);
+      return; // wynik w następnym ticku
     }
   }
 
   // Logic after scan
-  if (pickedIndex != -1) {
+  if (pickedUp) {
     // SUCCESS: Picked up item
-    // Note: item unique_ptr is moved, so we rely on context or generic log
-    std::cout << "[Settler] Picked up item. Returning to IDLE logic."
-              << std::endl;
 
     // FAILSAFE: If we are crafting, immediately update crafting logic to
     // prevent stalling
     if (m_currentCraftTaskId != -1) {
-      std::cout << "[Settler] Picked up item while crafting. Re-evaluating "
-                   "crafting needs..."
-                << std::endl;
+      LOG_DBG(Settler, m_name,
+              " picked up item while crafting, re-evaluating needs");
       // Don't just go IDLE, check needs immediately in next frame logic.
       // Setting IDLE is correct because Update() will call UpdateIdle() or
       // UpdateCrafting(). But we want to ensure we don't pick up something else
@@ -2481,8 +2676,9 @@ void Settler::UpdatePickingUp(
 
       if (dist > 0.1f) {
         direction = Vector3Normalize(direction);
-        position = Vector3Add(position,
-                              Vector3Scale(direction, m_moveSpeed * deltaTime));
+        position = Vector3Add(
+            position,
+            Vector3Scale(direction, std::min(m_moveSpeed * deltaTime, dist)));
 
         // Rotation
         float targetAngle = atan2(direction.x, direction.z) * RAD2DEG;
@@ -2491,7 +2687,7 @@ void Settler::UpdatePickingUp(
           angleDiff -= 360;
         while (angleDiff < -180)
           angleDiff += 360;
-        m_rotation += angleDiff * 5.0f * deltaTime;
+        m_rotation += angleDiff * std::min(5.0f * deltaTime, 1.0f);
       }
     } else {
       // LOGGING: No item found
@@ -2524,8 +2720,9 @@ void Settler::UpdatePickingUp(
         // Continue moving to target (maybe item is there)
         Vector3 direction = Vector3Subtract(m_targetPosition, position);
         direction = Vector3Normalize(direction);
-        position = Vector3Add(position,
-                              Vector3Scale(direction, m_moveSpeed * deltaTime));
+        position = Vector3Add(
+            position, Vector3Scale(direction, std::min(m_moveSpeed * deltaTime,
+                                                       distToTarget)));
       }
     }
   }
@@ -2533,10 +2730,17 @@ void Settler::UpdatePickingUp(
 
 void Settler::UpdateSearchingForFood(float deltaTime,
                                      const std::vector<Bush *> &bushes) {
+  PROFILE_ZONE("Settler::UpdateSearchingForFood");
 
   (void)deltaTime;
 
-  Bush *nearestFood = FindNearestFood(bushes);
+  Bush *nearestFood = nullptr;
+  if (HasIntentFor(SettlerState::SEARCHING_FOR_FOOD) &&
+      (!m_intent.nearestFood || m_intent.nearestFood->hasFruit)) {
+    nearestFood = m_intent.nearestFood;
+  } else {
+    nearestFood = FindNearestFood(bushes);
+  }
 
   if (nearestFood) {
 
@@ -2556,6 +2760,7 @@ void Settler::UpdateSearchingForFood(float deltaTime,
   }
 }
 void Settler::UpdateMovingToFood(float deltaTime) {
+  PROFILE_ZONE("Settler::UpdateMovingToFood");
 
   Vector3 direction = Vector3Subtract(m_targetPosition, position);
 
@@ -2572,11 +2777,13 @@ void Settler::UpdateMovingToFood(float deltaTime) {
 
   direction = Vector3Normalize(direction);
 
-  Vector3 movement = Vector3Scale(direction, m_moveSpeed * deltaTime);
+  Vector3 movement =
+      Vector3Scale(direction, std::min(m_moveSpeed * deltaTime, distance));
 
   position = Vector3Add(position, movement);
 }
 void Settler::UpdateEating(float deltaTime) {
+  PROFILE_ZONE("Settler::UpdateEating");
 
   m_eatingTimer += deltaTime;
 
@@ -2590,6 +2797,7 @@ void Settler::UpdateEating(float deltaTime) {
   }
 }
 void Settler::UpdateCrafting(float deltaTime) {
+  PROFILE_ZONE("Settler::UpdateCrafting");
   if (m_currentCraftTaskId == -1) {
     m_state = SettlerState::IDLE;
     return;
@@ -2669,15 +2877,8 @@ BuildingInstance *Settler::FindNearestStorageWithResource(
   if (!storageSys)
     return nullptr;
 
-  Resources::ResourceType rType = Resources::ResourceType::None;
-  if (resourceType == "Wood")
-    rType = Resources::ResourceType::Wood;
-  else if (resourceType == "Stone")
-    rType = Resources::ResourceType::Stone;
-  else if (resourceType == "Food")
-    rType = Resources::ResourceType::Food;
-  else if (resourceType == "Metal")
-    rType = Resources::ResourceType::Metal; // Added Metal support
+  Resources::ResourceType rType =
+      Resources::resourceTypeFromString(resourceType);
 
   if (rType == Resources::ResourceType::None)
     return nullptr;
@@ -2686,7 +2887,7 @@ BuildingInstance *Settler::FindNearestStorageWithResource(
     if (!b || !b->isBuilt())
       continue;
 
-    std::string storageId = b->getStorageId();
+    const std::string &storageId = b->getStorageId();
     if (storageId.empty())
       continue;
 
@@ -2694,7 +2895,7 @@ BuildingInstance *Settler::FindNearestStorageWithResource(
       continue;
 
     // Check if storage has the resource
-    int amount = storageSys->getResourceAmount(storageId, rType);
+    int amount = storageSys->getResourceAmount(b->getStorageSid(), rType);
     if (amount > 0) {
       float dst = Vector3Distance(position, b->getPosition());
       if (dst < minDst) {
@@ -2729,11 +2930,11 @@ Settler::FindNearestStorage(const std::vector<BuildingInstance *> &buildings) {
   for (auto *b : buildings) {
     if (!b)
       continue;
-    std::string storageId = b->getStorageId();
-    std::string blueprintId = b->getBlueprintId();
+    const std::string &storageId = b->getStorageId();
+    const std::string &blueprintId = b->getBlueprintId();
 
-    // Sprawdź czy zbudowany (z wyjątkiem stockpile) - użyj substring
-    bool isStockpile = (blueprintId.find("stockpile") != std::string::npos);
+    // Sprawdź czy zbudowany (z wyjątkiem stockpile)
+    bool isStockpile = (b->getBlueprintSid() == Ids::Stockpile);
     if (!b->isBuilt() && !isStockpile) {
       //   if (shouldLog) {
       //     std::cout << "[Settler] DEBUG: Odrzucono " << storageId << " ("
@@ -2787,18 +2988,9 @@ Settler::FindNearestStorage(const std::vector<BuildingInstance *> &buildings) {
       ResourceItem *resItem = dynamic_cast<ResourceItem *>(invItem->item.get());
       if (!resItem)
         continue;
-      std::string typeStr = resItem->getResourceType();
-      Resources::ResourceType type = Resources::ResourceType::None;
-      if (typeStr == "Wood")
-        type = Resources::ResourceType::Wood;
-      else if (typeStr == "Stone")
-        type = Resources::ResourceType::Stone;
-      else if (typeStr == "Food")
-        type = Resources::ResourceType::Food;
-      else if (typeStr == "Metal")
-        type = Resources::ResourceType::Metal;
-      else if (typeStr == "Gold")
-        type = Resources::ResourceType::Gold;
+      const std::string &typeStr = resItem->getResourceType();
+      Resources::ResourceType type =
+          Resources::resourceTypeFromId(resItem->getResourceSid());
 
       if (type != Resources::ResourceType::None) {
         // Log parametrów canAddResource
@@ -2899,9 +3091,9 @@ Settler::FindNearestStorage(const std::vector<BuildingInstance *> &buildings) {
       }
       continue;
     }
-    std::string storageId = b->getStorageId();
-    std::string blueprintId = b->getBlueprintId();
-    bool isStockpile = (blueprintId == "stockpile");
+    const std::string &storageId = b->getStorageId();
+    const std::string &blueprintId = b->getBlueprintId();
+    bool isStockpile = (b->getBlueprintSid() == Ids::Stockpile);
 
     // Dla stockpile ignorujemy isBuilt() - użyj substring
     if (!b->isBuilt() && !isStockpile) {
@@ -2951,18 +3143,8 @@ Settler::FindNearestStorage(const std::vector<BuildingInstance *> &buildings) {
             dynamic_cast<ResourceItem *>(invItem->item.get());
         if (!resItem)
           continue;
-        std::string typeStr = resItem->getResourceType();
-        Resources::ResourceType type = Resources::ResourceType::None;
-        if (typeStr == "Wood")
-          type = Resources::ResourceType::Wood;
-        else if (typeStr == "Stone")
-          type = Resources::ResourceType::Stone;
-        else if (typeStr == "Food")
-          type = Resources::ResourceType::Food;
-        else if (typeStr == "Metal")
-          type = Resources::ResourceType::Metal;
-        else if (typeStr == "Gold")
-          type = Resources::ResourceType::Gold;
+        Resources::ResourceType type =
+            Resources::resourceTypeFromId(resItem->getResourceSid());
 
         if (type != Resources::ResourceType::None) {
           if (storageSys->canAddResource(storageId, type, invItem->quantity)) {
@@ -3117,7 +3299,7 @@ Settler::FindNearestWorkshop(const std::vector<BuildingInstance *> &buildings) {
     // Dla testu: szukamy 'simple_storage' też jako workshopu (multitool)
 
     bool isWorkshop =
-        (b->getBlueprintId() == "simple_storage"); // HACK for testing
+        (b->getBlueprintSid() == Ids::SimpleStorage); // HACK for testing
 
     if (isWorkshop) {
       float d = Vector3Distance(position, b->getPosition());
@@ -3153,6 +3335,7 @@ Bush *Settler::FindNearestFood(const std::vector<Bush *> &bushes) {
   return nearest;
 }
 void Settler::UpdateChopping(float deltaTime) {
+  PROFILE_ZONE("Settler::UpdateChopping");
 
   if (!m_currentTree ||
       (!m_currentTree->isActive() && !m_currentTree->isFalling())) {
@@ -3187,14 +3370,15 @@ void Settler::UpdateChopping(float deltaTime) {
       angleDiff -= 360;
     while (angleDiff < -180)
       angleDiff += 360;
-    m_rotation += angleDiff * 15.0f * deltaTime; // Smooth rotation
+    m_rotation += angleDiff * std::min(15.0f * deltaTime, 1.0f); // Smooth rotation
   }
 
   m_gatherTimer += deltaTime;
 
   if (m_gatherTimer >= 1.0f) {
 
-    m_gatherTimer = 0.0f;
+    // Reszta przechodzi dalej - duża delta (LOD) nie gubi postępu pracy
+    m_gatherTimer -= 1.0f;
 
     if (CheckForJobFlagActivation()) {
 
@@ -3252,6 +3436,7 @@ void Settler::UpdateChopping(float deltaTime) {
 }
 
 void Settler::UpdateMining(float deltaTime) {
+  PROFILE_ZONE("Settler::UpdateMining");
   if (!m_currentResourceNode || !m_currentResourceNode->isActive()) {
     m_state = SettlerState::IDLE;
     return;
@@ -3277,12 +3462,12 @@ void Settler::UpdateMining(float deltaTime) {
       angleDiff -= 360;
     while (angleDiff < -180)
       angleDiff += 360;
-    m_rotation += angleDiff * 15.0f * deltaTime; // Smooth rotation
+    m_rotation += angleDiff * std::min(15.0f * deltaTime, 1.0f); // Smooth rotation
   }
 
   m_gatherTimer += deltaTime;
   if (m_gatherTimer >= 1.0f) {
-    m_gatherTimer = 0.0f;
+    m_gatherTimer -= 1.0f;
 
     if (CheckForJobFlagActivation()) {
       if (m_currentResourceNode) {
@@ -3330,6 +3515,7 @@ void Settler::UpdateMining(float deltaTime) {
   }
 }
 void Settler::UpdateMovingToBed(float deltaTime) {
+  PROFILE_ZONE("Settler::UpdateMovingToBed");
   // Jeśli mamy ścieżkę, poruszaj się po waypointach
   // Jeśli mamy ścieżkę do łóżka
   /*
@@ -3352,7 +3538,8 @@ void Settler::UpdateMovingToBed(float deltaTime) {
     return;
   }
   direction = Vector3Normalize(direction);
-  Vector3 movement = Vector3Scale(direction, m_moveSpeed * deltaTime);
+  Vector3 movement =
+      Vector3Scale(direction, std::min(m_moveSpeed * deltaTime, distance));
   position = Vector3Add(position, movement);
 }
 void Settler::CraftTool(const std::string &toolName) { (void)toolName; }
@@ -3519,7 +3706,16 @@ void Settler::InterruptCurrentAction() {
 
   m_state = SettlerState::IDLE;
 }
+bool Settler::NeedsFood() const {
+  return m_stats->getCurrentHunger() <= m_hungerEnterThreshold;
+}
+
+bool Settler::NeedsSleep() const {
+  return m_stats->getCurrentEnergy() <= m_sleepEnterThreshold;
+}
+
 void Settler::OnJobConfigurationChanged() {
+  RequestReevaluation();
 
   m_prevGatherWood = gatherWood;
 
@@ -3556,6 +3752,7 @@ void Settler::OnJobConfigurationChanged() {
 void Settler::UpdateHauling(float deltaTime,
                             const std::vector<BuildingInstance *> &buildings,
                             std::vector<WorldItem> &worldItems) {
+  PROFILE_ZONE("Settler::UpdateHauling");
   (void)deltaTime;
   (void)buildings;
 
@@ -3593,6 +3790,7 @@ void Settler::UpdateHunting(
     float deltaTime, const std::vector<std::unique_ptr<Animal>> &animals,
     const std::vector<BuildingInstance *> &buildings,
     const std::vector<std::unique_ptr<ResourceNode>> &resourceNodes) {
+  PROFILE_ZONE("Settler::UpdateHunting");
   (void)buildings; // Może być użyte później dla pathfinding
 
   // Sprawdź czy przerwano zadanie (job flag deactivated)
@@ -3609,9 +3807,21 @@ void Settler::UpdateHunting(
   if (!m_currentTargetAnimal) {
     Animal *nearest = nullptr;
     float minDist = 50.0f; // Promień wyszukiwania
+    bool scanAnimals = true;
+
+    if (HasIntentFor(SettlerState::HUNTING)) {
+      Animal *candidate = m_intent.nearestPrey;
+      if (!candidate) {
+        scanAnimals = false;
+      } else if (candidate->isActive() && !candidate->isDead()) {
+        nearest = candidate;
+        minDist = m_intent.preyDistance;
+        scanAnimals = false;
+      }
+    }
 
-    for (const auto &animalPtr : animals) {
-      Animal *animal = animalPtr.get();
+    for (size_t i = 0; scanAnimals && i < animals.size(); ++i) {
+      Animal *animal = animals[i].get();
       if (!animal || !animal->isActive() || animal->isDead())
         continue;
 
@@ -3711,7 +3921,7 @@ void Settler::UpdateHunting(
       angleDiff -= 360;
     while (angleDiff < -180)
       angleDiff += 360;
-    m_rotation += angleDiff * 15.0f * deltaTime; // Smooth rotation
+    m_rotation += angleDiff * std::min(15.0f * deltaTime, 1.0f); // Smooth rotation
   }
 
   // ZAWSZE inkrementuj timer (ładuj atak podczas biegu)
@@ -3862,6 +4072,7 @@ void Settler::UpdateHunting(
 void Settler::UpdateMovingToSkin(
     float deltaTime, const std::vector<BuildingInstance *> &buildings,
     const std::vector<std::unique_ptr<ResourceNode>> &resourceNodes) {
+  PROFILE_ZONE("Settler::UpdateMovingToSkin");
   if (!m_currentTargetAnimal) {
     m_state = SettlerState::IDLE;
     return;
@@ -3910,6 +4121,7 @@ void Settler::UpdateMovingToSkin(
 }
 
 void Settler::UpdateSkinning(float deltaTime) {
+  PROFILE_ZONE("Settler::UpdateSkinning");
   if (!m_currentTargetAnimal) {
     m_state = SettlerState::IDLE;
     return;
@@ -3932,7 +4144,7 @@ void Settler::UpdateSkinning(float deltaTime) {
       angleDiff -= 360;
     while (angleDiff < -180)
       angleDiff += 360;
-    m_rotation += angleDiff * 5.0f * deltaTime;
+    m_rotation += angleDiff * std::min(5.0f * deltaTime, 1.0f);
   }
 
   if (m_skinningTimer >= 2.0f) { // 2 seconds to skin
@@ -3989,6 +4201,7 @@ Vector3 Settler::getForwardVector() const {
 
 void Settler::UpdateFetchingResource(
     float deltaTime, const std::vector<BuildingInstance *> &buildings) {
+  PROFILE_ZONE("Settler::UpdateFetchingResource");
   (void)deltaTime;
   (void)buildings;
   if (!m_targetStorage || m_resourceToFetch.empty()) {
@@ -11,12 +11,16 @@
 
 #include <algorithm>
 
+#include <cstdint>
+
 #include "raylib.h"
 
 #include "raymath.h"
 
 #include "../core/GameEntity.h"
 
+#include "../core/SimulationLOD.h"
+
 #include "InteractableObject.h"
 
 #include "../components/InventoryComponent.h"
@@ -42,6 +46,54 @@ class ResourceNode;
 class BuildTask;
 class GatheringTask;
 
+/**
+ * @brief Spójny na czas klatki widok świata dla fazy Think.
+ *
+ * Faza Think działa równolegle (JobSystem) i tylko czyta - żaden osadnik
+ * nie rezerwuje ani nie modyfikuje obiektów, dopóki wszystkie nie skończą.
+ */
+struct SettlerWorldView {
+  const std::vector<std::unique_ptr<Tree>> &trees;
+  const std::vector<WorldItem> &worldItems;
+  const std::vector<Bush *> &bushes;
+  const std::vector<std::unique_ptr<Animal>> &animals;
+  const std::vector<std::unique_ptr<ResourceNode>> &resourceNodes;
+};
+
+/**
+ * @brief Cele wyliczone w fazie Think, zatwierdzane w Update.
+ *
+ * Update przed rezerwacją sprawdza, czy cel jest nadal wolny (mógł go zająć
+ * osadnik zatwierdzony wcześniej w tej klatce) - jeśli nie, wraca do
+ * zwykłego przeszukania.
+ */
+struct SettlerIntent {
+  bool valid = false;
+  SettlerState state = SettlerState::IDLE; // stan, dla którego liczono cele
+  int freeLogIndex = -1; // indeks w worldItems
+  const Item *freeLogItem = nullptr; // przedmiot pod tym indeksem w Think
+  Tree *freeTree = nullptr;
+  ResourceNode *freeStone = nullptr;
+  Bush *nearestFood = nullptr;
+  Animal *nearestPrey = nullptr;
+  float preyDistance = 0.0f;
+};
+
+/**
+ * @brief Stan osadnika w AIScheduler - kiedy ostatnio podejmował decyzję
+ * i co widział w poprzednim ticku (do wykrywania zdarzeń wymuszających
+ * natychmiastową ponowną ocenę).
+ */
+struct AIScheduleInfo {
+  float sinceDecision = 0.0f; // s od ostatniej oceny w stanie IDLE
+  bool granted = true;        // czy w tym ticku wolno podjąć decyzję
+  bool evaluating = false;    // przydział z kolejki (czas jest mierzony)
+  bool forced = false;        // ponowna ocena wymuszona zdarzeniem
+  SettlerState lastState = SettlerState::IDLE;
+  bool wasHungry = false;
+  bool wasTired = false;
+};
+
 class Settler : public GameEntity, public InteractableObject {
   friend class ActionComponent;
 
@@ -56,8 +108,22 @@ public:
               const std::vector<BuildingInstance *> &buildings,
               const std::vector<std::unique_ptr<Animal>> &animals,
               const std::vector<std::unique_ptr<ResourceNode>> &resourceNodes);
+  /**
+   * @brief Faza równoległa: wyszukuje cele bez modyfikowania świata.
+   * Wyniki trafiają do m_intent i są zatwierdzane w następnym Update.
+   */
+  void Think(const SettlerWorldView &world);
   void render() override;
   void render(bool isFps); // Overload for FPS mode
+  /**
+   * @brief Pozycja do rysowania - interpolowana między ostatnimi dwoma
+   * tickami symulacji (FixedTimestep::getRenderAlpha)
+   */
+  Vector3 getRenderPosition() const;
+  /** Pozycja rysowania + obrót Y (pivot w stopach) - proxy LOD */
+  Matrix getRenderTransform() const;
+  /** Kolor koszuli (zaznaczony - żółty) */
+  Color getRenderColor() const { return m_isSelected ? YELLOW : BLUE; }
   // renderFPS removed
   Vector3 getPosition() const override { return position; }
   void setPosition(const Vector3 &pos) override { position = pos; }
@@ -281,6 +347,7 @@ private:
   SettlerProfession m_profession;
   bool m_isSelected;
   Vector3 position;
+  Vector3 m_prevPosition; // Pozycja z poprzedniego ticku (interpolacja)
   std::shared_ptr<InventoryComponent> m_inventory;
   std::shared_ptr<StatsComponent> m_stats;
   std::shared_ptr<SkillsComponent> m_skills;
@@ -365,13 +432,39 @@ public:
   bool m_waitingToDealDamage =
       false; // Flaga opóźnienia obrażeń (czekamy na 'hit frame')
   float m_skinningTimer = 0.0f;
-  float m_aiSearchTimer = 0.0f; // AI throttling timer
+  AIScheduleInfo m_aiSchedule; // Przydział decyzji z AIScheduler
+  SimLodState m_simLod;        // Poziom LOD symulacji (Colony)
+  // Wymusza ocenę w najbliższym ticku (np. po zmianie flag pracy)
+  void RequestReevaluation() {
+    m_aiSchedule.forced = true;
+    m_aiSchedule.granted = true;
+  }
+  bool NeedsFood() const;
+  bool NeedsSleep() const;
+  bool HasQueuedActions() const { return !m_actionQueue.empty(); }
   // Przedmiot trzymany w ręce (nóż)
   std::unique_ptr<Item> m_heldItem;
   bool IsStateInterruptible() const;
   bool CheckForJobFlagActivation();
   void InterruptCurrentAction();
   Bush *FindNearestFood(const std::vector<Bush *> &bushes);
+  SettlerIntent m_intent; // Wynik Think z bieżącej klatki
+  // Przedmiot z ziemi zlecony do ekwipunku (WorldCommandBuffer). Playback
+  // rozstrzyga zlecenie o numerze m_pendingPickup (0 = brak) przez
+  // resolvePickup, wynik odczytuje następny UpdatePickingUp
+  uint32_t m_pendingPickup = 0;
+  uint32_t m_pickupSequence = 0;
+  bool m_pickupResolved = false;
+  bool m_pickupSucceeded = false;
+  void resolvePickup(uint32_t sequence, bool pickedUp) {
+    if (sequence == 0 || sequence != m_pendingPickup)
+      return; // zlecenie porzucone (zmiana stanu) albo nie od AI
+    m_pickupResolved = true;
+    m_pickupSucceeded = pickedUp;
+  }
+  bool HasIntentFor(SettlerState state) const {
+    return m_intent.valid && m_intent.state == state;
+  }
 
 private:
   // Time Constants
@@ -1,14 +1,21 @@
 #include "Terrain.h"
 #include "Tree.h"
 #include "ResourceNode.h"
+#include "InstancedRenderer.h"
+#include "RenderCulling.h"
 #include <iostream>
 #include <cmath>
 #include <cstdlib>
 #include <ctime>
+#include <random>
 #include "../core/GameEngine.h"
+#include "../core/JobSystem.h"
+#include "../core/MainThreadQueue.h"
 #include "../systems/InteractionSystem.h"
 #include "raymath.h"
 #include "../systems/BuildingSystem.h"
+#include "../core/GameSystem.h"
+#include "Colony.h"
 
 // Helper do sprawdzania kolizji z budynkami
 extern BuildingSystem* g_buildingSystem;
@@ -21,7 +28,7 @@ static bool isPositionFreeFromBuildings(Vector3 pos, float radius) {
         if (!building) continue;
         
         // Podłoga jest OK
-        if (building->getBlueprintId() == "floor") continue;
+        if (building->getBlueprintSid() == Ids::Floor) continue;
         
         // Sprawdź kolizję z BoundingBox
         if (CheckCollisionBoxSphere(building->getBoundingBox(), pos, radius)) {
@@ -31,6 +38,17 @@ static bool isPositionFreeFromBuildings(Vector3 pos, float radius) {
     return true;
 }
 
+// Dane generowane na wątku roboczym - tylko CPU, bez raylib GL i bez
+// dostępu do systemów gry. Kolizje z budynkami sprawdza finishGenerate().
+struct Terrain::GeneratedData {
+    std::atomic<int> pending{0};
+    std::vector<float> heightMap;
+    Mesh mesh = {};
+    bool hasMesh = false;
+    std::vector<Vector3> treeCandidates;
+    std::vector<Vector3> stoneCandidates;
+};
+
 Terrain::Terrain() : width(0), height(0), tileSize(0.0f) {
     mesh = {};
     model = {};
@@ -40,86 +58,171 @@ Terrain::~Terrain() {
     cleanup();
 }
 
+Mesh Terrain::buildPlaneMesh(float planeWidth, float planeLength, int resX, int resZ) {
+    // Jak GenMeshPlane, ale bez UploadMesh - można wołać poza wątkiem GL
+    resX++;
+    resZ++;
+    Mesh mesh = {};
+    int numFaces = (resX - 1) * (resZ - 1);
+    mesh.vertexCount = resX * resZ;
+    mesh.triangleCount = numFaces * 2;
+    mesh.vertices = (float*)MemAlloc(mesh.vertexCount * 3 * sizeof(float));
+    mesh.normals = (float*)MemAlloc(mesh.vertexCount * 3 * sizeof(float));
+    mesh.texcoords = (float*)MemAlloc(mesh.vertexCount * 2 * sizeof(float));
+    mesh.indices = (unsigned short*)MemAlloc(mesh.triangleCount * 3 * sizeof(unsigned short));
+
+    for (int z = 0; z < resZ; z++) {
+        float zPos = ((float)z / (resZ - 1) - 0.5f) * planeLength;
+        for (int x = 0; x < resX; x++) {
+            int v = x + z * resX;
+            mesh.vertices[3 * v] = ((float)x / (resX - 1) - 0.5f) * planeWidth;
+            mesh.vertices[3 * v + 1] = 0.0f;
+            mesh.vertices[3 * v + 2] = zPos;
+            mesh.normals[3 * v] = 0.0f;
+            mesh.normals[3 * v + 1] = 1.0f;
+            mesh.normals[3 * v + 2] = 0.0f;
+            mesh.texcoords[2 * v] = (float)x / (resX - 1);
+            mesh.texcoords[2 * v + 1] = (float)z / (resZ - 1);
+        }
+    }
+
+    int t = 0;
+    for (int face = 0; face < numFaces; face++) {
+        int i = face + face / (resX - 1);
+        mesh.indices[t++] = (unsigned short)(i + resX);
+        mesh.indices[t++] = (unsigned short)(i + 1);
+        mesh.indices[t++] = (unsigned short)i;
+        mesh.indices[t++] = (unsigned short)(i + resX);
+        mesh.indices[t++] = (unsigned short)(i + resX + 1);
+        mesh.indices[t++] = (unsigned short)(i + 1);
+    }
+    return mesh;
+}
+
+void Terrain::freeCpuMesh(Mesh& mesh) {
+    MemFree(mesh.vertices);
+    MemFree(mesh.normals);
+    MemFree(mesh.texcoords);
+    MemFree(mesh.indices);
+    mesh = {};
+}
+
 void Terrain::generate(int newWidth, int newHeight, float newTileSize) {
+    beginGenerate(newWidth, newHeight, newTileSize);
+    finishGenerate();
+}
+
+void Terrain::beginGenerate(int newWidth, int newHeight, float newTileSize) {
+    if (m_generation) {
+        finishGenerate();
+    }
+
     width = newWidth;
     height = newHeight;
     tileSize = newTileSize;
 
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
-
-    heightMap.resize(width * height);
+    unsigned int seed = m_seed != 0 ? m_seed : static_cast<unsigned int>(std::time(nullptr));
+    // Globalny rand() nadal seedujemy tutaj - korzysta z niego reszta gry
+    std::srand(seed);
 
     m_trees.clear();
     m_resourceNodes.clear();
-
-    // User feedback: "The terrain is flat, everything should be at the same height".
-    // Disabling Perlin noise to ensure flat terrain (Y=0).
-    // This resolves the issue where visual mesh and logical heightmap were desynchronized
-    // (likely due to normals not being updated or visual mesh remaining flat while logic assumed hills).
-    
-    /*
-    Image perlinImage = GenImagePerlinNoise(width, height, 0, 0, 5.0f);
-    Color* pixels = LoadImageColors(perlinImage);
-    */
-
-    for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
-            // Flatten the terrain
-            float heightVal = 0.0f; 
-            // if (pixels) heightVal = (pixels[y * width + x].r / 255.0f) * 10.0f; // Disabled
-            setHeightAt(x, y, heightVal);
+    m_uploadHandle.reset();
+
+    m_generation = std::make_unique<GeneratedData>();
+    GeneratedData* data = m_generation.get();
+    int w = width;
+    int h = height;
+    float tile = tileSize;
+    // Bez okna nie ma kontekstu GL - siatka jest potrzebna tylko do rysowania
+    bool buildMesh = !GameEngine::getInstance().isHeadless();
+
+    JobSystem::getInstance().submit([data, w, h, tile, seed, buildMesh]() {
+        // User feedback: "The terrain is flat, everything should be at the same height".
+        // Perlin noise stays disabled, so the visual mesh and the logical heightmap
+        // cannot desynchronize.
+        data->heightMap.assign(static_cast<size_t>(w) * h, 0.0f);
+
+        float mapWidth = (w - 1) * tile;
+        float mapHeight = (h - 1) * tile;
+
+        if (buildMesh) {
+            data->mesh = buildPlaneMesh(mapWidth, mapHeight, w - 1, h - 1);
+            data->hasMesh = true;
         }
-    }
 
-    /*
-    UnloadImageColors(pixels);
-    UnloadImage(perlinImage);
-    */
+        // Kandydaci na pozycje (tyle, ile było prób w pętli z ponawianiem).
+        // Własny generator - std::rand nie jest bezpieczny między wątkami.
+        const int maxAttempts = 200; // Zwiększony limit prób
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        auto candidate = [&]() {
+            float x = (unit(rng) * mapWidth) - (mapWidth / 2.0f);
+            float z = (unit(rng) * mapHeight) - (mapHeight / 2.0f);
+            return Vector3{x, 0.0f, z};
+        };
+        data->treeCandidates.reserve(maxAttempts);
+        for (int i = 0; i < maxAttempts; ++i) data->treeCandidates.push_back(candidate());
+        data->stoneCandidates.reserve(maxAttempts);
+        for (int i = 0; i < maxAttempts; ++i) data->stoneCandidates.push_back(candidate());
+    }, &data->pending);
+}
+
+bool Terrain::isGenerationReady() const {
+    return !m_generation || m_generation->pending.load() == 0;
+}
 
-    float mapWidth = (width - 1) * tileSize;
-    float mapHeight = (height - 1) * tileSize;
+void Terrain::finishGenerate() {
+    if (!m_generation) return;
+    // Wątek główny pomaga w pracy zamiast spać
+    JobSystem::getInstance().wait(m_generation->pending);
+    std::unique_ptr<GeneratedData> data = std::move(m_generation);
 
+    heightMap = std::move(data->heightMap);
     std::cout << "Generating Flat Terrain: " << width << "x" << height << " TileSize: " << tileSize << std::endl;
 
-    // GenMeshPlane creates a flat mesh at Y=0. Since we want flat terrain, we don't need to modify vertices.
-    mesh = GenMeshPlane(mapWidth, mapHeight, width - 1, height - 1);
-    
-    // We skip vertex modification to ensure visual mesh is perfectly flat 0.0f
-    /*
-    for (int i = 0; i < mesh.vertexCount; i++) {
-        // ... modification loop ...
+    if (data->hasMesh) {
+        if (model.meshCount > 0) {
+            UnloadModel(model);
+            model = {};
+        }
+        // Upload do GPU w kolejce wątku głównego (z budżetem na klatkę).
+        // Zadanie trzyma tylko weak_ptr - po cleanup()/destruktorze albo
+        // kolejnym generowaniu stary upload tylko zwalnia CPU.
+        Mesh cpuMesh = data->mesh;
+        m_uploadHandle = std::make_shared<Terrain*>(this);
+        std::weak_ptr<Terrain*> handle = m_uploadHandle;
+        MainThreadQueue::getInstance().push([handle, cpuMesh]() mutable {
+            std::shared_ptr<Terrain*> owner = handle.lock();
+            if (!owner) {
+                freeCpuMesh(cpuMesh);
+                return;
+            }
+            Terrain* terrain = *owner;
+            UploadMesh(&cpuMesh, false);
+            terrain->mesh = cpuMesh;
+            terrain->model = LoadModelFromMesh(terrain->mesh);
+        });
     }
-    */
-    
-    model = LoadModelFromMesh(mesh);
 
     // Tree Generation with collision checking
     std::cout << "--- TREE PLACEMENT (FLAT) ---" << std::endl;
     int spawnedTrees = 0;
     int attempts = 0;
-    const int maxAttempts = 200; // Zwiększony limit prób
-
-    while (spawnedTrees < 50 && attempts < maxAttempts) {
+    for (const Vector3& pos : data->treeCandidates) {
+        if (spawnedTrees >= 50) break;
         attempts++;
-        
-        float r1 = static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
-        float r2 = static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
-        
-        float x = (r1 * mapWidth) - (mapWidth / 2.0f);
-        float z = (r2 * mapHeight) - (mapHeight / 2.0f);
-        float y = 0.0f;
-        
+
         // Sprawdź kolizję (promień drzewa ~0.5f)
-        if (!isPositionFreeFromBuildings({x, y, z}, 0.5f)) {
+        if (!isPositionFreeFromBuildings(pos, 0.5f)) {
             continue; // Spróbuj innej pozycji
         }
-        
+
         if (spawnedTrees < 5) {
-            std::cout << "Tree " << spawnedTrees << " Pos: (" << x << ", " << y << ", " << z << ")" << std::endl;
+            std::cout << "Tree " << spawnedTrees << " Pos: (" << pos.x << ", " << pos.y << ", " << pos.z << ")" << std::endl;
         }
 
-        auto newTree = std::make_unique<Tree>(PositionComponent({x, y, z}), 100.0f, 50.0f);
-        addTree(std::move(newTree));
+        addTree(std::make_unique<Tree>(PositionComponent(pos), 100.0f, 50.0f));
         spawnedTrees++;
     }
     std::cout << "Spawned " << spawnedTrees << " trees (attempts: " << attempts << ")" << std::endl;
@@ -128,24 +231,16 @@ void Terrain::generate(int newWidth, int newHeight, float newTileSize) {
     // Stone Generation with collision checking
     int spawnedStones = 0;
     attempts = 0;
-
-    while (spawnedStones < 20 && attempts < maxAttempts) {
+    for (const Vector3& pos : data->stoneCandidates) {
+        if (spawnedStones >= 20) break;
         attempts++;
-        
-        float r1 = static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
-        float r2 = static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
-        
-        float x = (r1 * mapWidth) - (mapWidth / 2.0f);
-        float z = (r2 * mapHeight) - (mapHeight / 2.0f);
-        float y = 0.0f;
-        
+
         // Sprawdź kolizję (promień kamienia ~0.5f)
-        if (!isPositionFreeFromBuildings({x, y, z}, 0.5f)) {
+        if (!isPositionFreeFromBuildings(pos, 0.5f)) {
             continue;
         }
-        
-        auto newStone = std::make_unique<ResourceNode>(Resources::ResourceType::Stone, PositionComponent(Vector3{x, y, z}), 50.0f);
-        addResourceNode(std::move(newStone));
+
+        addResourceNode(std::make_unique<ResourceNode>(Resources::ResourceType::Stone, PositionComponent(pos), 50.0f));
         spawnedStones++;
     }
     std::cout << "Spawned " << spawnedStones << " stones (attempts: " << attempts << ")" << std::endl;
@@ -219,22 +314,46 @@ bool Terrain::isAccessible(Vector3 position) const {
 void Terrain::render() {
     DrawModel(model, Vector3{0, 0, 0}, 1.0f, Color{34, 139, 34, 255});
     
+    const RenderCulling& culling = RenderCulling::getInstance();
+    InstancedRenderer& instances = InstancedRenderer::getInstance();
+    if (instances.isReady()) {
+        for (const auto& tree : m_trees) {
+            if (!culling.isVisible(tree.get()))
+                continue;
+            instances.addTree(*tree);
+            tree->renderHealthBar();
+        }
+        for (const auto& node : m_resourceNodes) {
+            if (culling.isVisible(node.get()))
+                instances.addResourceNode(*node);
+        }
+        instances.flush();
+        return;
+    }
+
     for (const auto& tree : m_trees) {
-        tree->render();
+        if (culling.isVisible(tree.get()))
+            tree->render();
     }
     
     for (const auto& node : m_resourceNodes) {
-        node->render();
+        if (culling.isVisible(node.get()))
+            node->render();
     }
 }
 
 void Terrain::update(float deltaTime) {
+    Colony* colony = GameSystem::getColony();
     auto it = m_trees.begin();
     while (it != m_trees.end()) {
         Tree* tree = it->get();
         
-        // Update physics/animation
-        tree->update(deltaTime);
+        // Update physics/animation - tylko padające drzewa mają co liczyć.
+        // Poza zasięgiem LOD (Macro) upadek kończy się w jednym kroku.
+        if (tree->isFalling()) {
+            bool far = colony && colony->getSimulationLOD().tierFor(tree->getPosition()) == SimLodTier::Macro;
+            tree->update(far ? 1.0f : deltaTime);
+        }
         
         if (tree->shouldBeRemoved()) {
              if (auto interactionSystem = GameEngine::getInstance().getSystem<InteractionSystem>()) {
@@ -263,6 +382,20 @@ void Terrain::update(float deltaTime) {
 }
 
 void Terrain::cleanup() {
+    if (m_generation) {
+        // Wołane też z destruktora - wyjątek z generowania tylko logujemy
+        try {
+            JobSystem::getInstance().wait(m_generation->pending);
+        } catch (const std::exception& e) {
+            std::cerr << "[Terrain] Generation job failed: " << e.what() << std::endl;
+        } catch (...) {
+            std::cerr << "[Terrain] Generation job failed" << std::endl;
+        }
+        if (m_generation->hasMesh) freeCpuMesh(m_generation->mesh);
+        m_generation.reset();
+    }
+    m_uploadHandle.reset();
+
     if (model.meshCount > 0) {
         UnloadModel(model);
         model = {};
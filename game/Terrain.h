@@ -13,6 +13,18 @@ public:
     ~Terrain();
 
     void generate(int width, int height, float tileSize);
+    // Generowanie w tle: heightmapa, siatka (CPU) i kandydaci na drzewa/kamienie
+    // liczą się na wątku roboczym, upload siatki idzie przez MainThreadQueue.
+    // generate() = beginGenerate() + finishGenerate().
+    void beginGenerate(int width, int height, float tileSize);
+    bool isGenerationReady() const;
+    void finishGenerate();
+
+    // Płaska siatka jak GenMeshPlane, ale bez uploadu (bezpieczne poza wątkiem GL)
+    static Mesh buildPlaneMesh(float width, float length, int resX, int resZ);
+    static void freeCpuMesh(Mesh& mesh);
+    // Stałe ziarno generatora (0 = losowe z zegara) - powtarzalne scenariusze
+    void setSeed(unsigned int seed) { m_seed = seed; }
     void render();
     void update(float deltaTime);
     void cleanup();
@@ -42,6 +54,7 @@ private:
     int width;
     int height;
     float tileSize;
+    unsigned int m_seed = 0;
     std::vector<float> heightMap;
     
     Mesh mesh;
@@ -49,4 +62,10 @@ private:
     
     std::vector<std::unique_ptr<Tree>> m_trees;
     std::vector<std::unique_ptr<ResourceNode>> m_resourceNodes;
+
+    struct GeneratedData;
+    std::unique_ptr<GeneratedData> m_generation;
+    // Uchwyt dla uploadu w MainThreadQueue: reset w cleanup()/beginGenerate(),
+    // więc zadanie z kolejki nie sięga do zniszczonego lub nowego terenu
+    std::shared_ptr<Terrain*> m_uploadHandle;
 };
\ No newline at end of file
@@ -155,16 +155,34 @@ void Tree::render() {
 
     rlPopMatrix(); // Restore matrix
 
-    // HP Bar
-    auto stats = getComponent<StatsComponent>();
-    if (stats && stats->getCurrentHealth() < stats->getMaxHealth()) {
-      Vector3 barPos = pos;
-      barPos.y += 5.5f;
+    renderHealthBar();
+  }
+}
 
-      float healthPct = stats->getCurrentHealth() / stats->getMaxHealth();
+void Tree::renderHealthBar() const {
+  if (m_isStump)
+    return;
+  auto stats = getComponent<StatsComponent>();
+  if (stats && stats->getCurrentHealth() < stats->getMaxHealth()) {
+    Vector3 barPos = getPosition();
+    barPos.y += 5.5f;
 
-      DrawCube(barPos, 1.0f, 0.1f, 0.1f, RED);
-      DrawCube(barPos, 1.0f * healthPct, 0.12f, 0.12f, GREEN);
-    }
+    float healthPct = stats->getCurrentHealth() / stats->getMaxHealth();
+
+    DrawCube(barPos, 1.0f, 0.1f, 0.1f, RED);
+    DrawCube(barPos, 1.0f * healthPct, 0.12f, 0.12f, GREEN);
   }
+}
+
+Matrix Tree::getRenderTransform() const {
+  Vector3 pos = getPosition();
+  Matrix translation = MatrixTranslate(pos.x, pos.y, pos.z);
+  if (m_isStump)
+    return translation;
+  // Ta sama kolejność co rlRotatef w render(): najpierw padanie, potem Y
+  Matrix transform = MatrixRotateY(m_rotation * DEG2RAD);
+  if (m_isFalling)
+    transform = MatrixMultiply(MatrixRotate(m_fallAxis, m_fallAngle * DEG2RAD),
+                               transform);
+  return MatrixMultiply(transform, translation);
 }
\ No newline at end of file
@@ -45,6 +45,10 @@ public:
   void chopDown(bool dropItems = true); // Triggers falling animation
   void update(float deltaTime); // Updates falling animation
   void render();
+  // Pasek HP nad uszkodzonym drzewem (render i ścieżka instancjonowana)
+  void renderHealthBar() const;
+  // Podstawa drzewa: pozycja, obrót Y i przechył padania (pniak - bez obrotu)
+  Matrix getRenderTransform() const;
 
   bool isStump() const { return m_isStump; }
   bool isFalling() const { return m_isFalling; } // Getter for falling state
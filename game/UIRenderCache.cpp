@@ -0,0 +1,212 @@
+#include "UIRenderCache.h"
+#include "rlgl.h"
+#include <cmath>
+
+namespace {
+constexpr int PANEL_MARGIN = 4; // poświata DrawPremiumPanel wychodzi 3 px poza ramkę
+constexpr int DEFAULT_FONT_SIZE = 10; // jak w DrawText/MeasureText
+constexpr float DEFAULT_LINE_SPACING = 2.0f; // textLineSpacing z rtext.c
+
+bool g_panelsEnabled = true;
+CachedPanel::Stats g_panelStats;
+} // namespace
+
+void CachedPanel::setKey(uint64_t key) {
+  if (key != m_key) {
+    m_key = key;
+    m_dirty = true;
+  }
+}
+
+uint64_t CachedPanel::hashValues(std::initializer_list<int64_t> values) {
+  uint64_t hash = 1469598103934665603ull; // FNV-1a po całych wartościach
+  for (int64_t value : values) {
+    hash ^= static_cast<uint64_t>(value);
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+void CachedPanel::draw(Rectangle bounds, const std::function<void()> &redraw) {
+  g_panelStats.draws++;
+  if (!g_panelsEnabled || !IsWindowReady() || m_unavailable) {
+    redraw();
+    return;
+  }
+
+  int width = static_cast<int>(ceilf(bounds.width)) + 2 * PANEL_MARGIN;
+  int height = static_cast<int>(ceilf(bounds.height)) + 2 * PANEL_MARGIN;
+  if (m_target.id == 0 || m_target.texture.width != width ||
+      m_target.texture.height != height) {
+    unload();
+    m_target = LoadRenderTexture(width, height);
+    if (m_target.id == 0) {
+      m_unavailable = true; // brak FBO (np. rlsw) - nie próbujemy co klatkę
+      redraw();
+      return;
+    }
+  }
+  if (bounds.x != m_bounds.x || bounds.y != m_bounds.y)
+    m_dirty = true;
+
+  float originX = floorf(bounds.x) - PANEL_MARGIN;
+  float originY = floorf(bounds.y) - PANEL_MARGIN;
+  if (m_dirty) {
+    g_panelStats.redraws++;
+    BeginTextureMode(m_target);
+    ClearBackground(BLANK);
+    // RGB przemnożone przez alfę, alfa składana jak "over" - bez podwójnego
+    // mnożenia przy późniejszym rysowaniu na ekran
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE,
+                              RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+    rlPushMatrix();
+    rlTranslatef(-originX, -originY, 0.0f);
+    redraw();
+    rlPopMatrix();
+    EndBlendMode();
+    EndTextureMode();
+    m_bounds = bounds;
+    m_dirty = false;
+  }
+
+  // Tekstura RenderTexture jest odwrócona w pionie
+  Rectangle source = {0.0f, 0.0f, static_cast<float>(width),
+                      -static_cast<float>(height)};
+  BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+  DrawTextureRec(m_target.texture, source, {originX, originY}, WHITE);
+  EndBlendMode();
+}
+
+void CachedPanel::unload() {
+  if (m_target.id != 0 && IsWindowReady())
+    UnloadRenderTexture(m_target);
+  m_target = RenderTexture2D{};
+  m_dirty = true;
+}
+
+void CachedPanel::setEnabled(bool enabled) { g_panelsEnabled = enabled; }
+
+bool CachedPanel::isEnabled() { return g_panelsEnabled; }
+
+void CachedPanel::beginFrame() { g_panelStats = Stats(); }
+
+const CachedPanel::Stats &CachedPanel::getStats() { return g_panelStats; }
+
+const GlyphRunCache::Run &GlyphRunCache::get(const std::string &text,
+                                             int fontSize) {
+  unsigned int fontTexture = GetFontDefault().texture.id;
+  if (fontTexture != m_fontTexture) {
+    clear(); // nowy kontekst okna - stare UV nieaktualne
+    m_fontTexture = fontTexture;
+  }
+
+  m_lookup.text = text;
+  m_lookup.fontSize = fontSize;
+  auto it = m_runs.find(m_lookup);
+  if (it != m_runs.end()) {
+    m_stats.hits++;
+    return it->second;
+  }
+  m_stats.misses++;
+  if (m_runs.size() >= MAX_RUNS)
+    m_runs.clear();
+  return m_runs.emplace(m_lookup, build(text, fontSize)).first->second;
+}
+
+int GlyphRunCache::measure(const std::string &text, int fontSize) {
+  if (!m_enabled)
+    return MeasureText(text.c_str(), fontSize);
+  return get(text, fontSize).width;
+}
+
+void GlyphRunCache::draw(const std::string &text, int x, int y, int fontSize,
+                         Color color) {
+  if (!m_enabled) {
+    DrawText(text.c_str(), x, y, fontSize, color);
+    return;
+  }
+  draw(get(text, fontSize), x, y, color);
+}
+
+void GlyphRunCache::draw(const Run &run, int x, int y, Color color) const {
+  if (run.quads.empty() || m_fontTexture == 0)
+    return;
+
+  float originX = static_cast<float>(x);
+  float originY = static_cast<float>(y);
+  rlCheckRenderBatchLimit(4 * static_cast<int>(run.quads.size()));
+  rlSetTexture(m_fontTexture);
+  rlBegin(RL_QUADS);
+  rlColor4ub(color.r, color.g, color.b, color.a);
+  rlNormal3f(0.0f, 0.0f, 1.0f);
+  // Kolejność wierzchołków jak w DrawTexturePro
+  for (const Quad &quad : run.quads) {
+    rlTexCoord2f(quad.u0, quad.v0);
+    rlVertex2f(originX + quad.x0, originY + quad.y0);
+    rlTexCoord2f(quad.u0, quad.v1);
+    rlVertex2f(originX + quad.x0, originY + quad.y1);
+    rlTexCoord2f(quad.u1, quad.v1);
+    rlVertex2f(originX + quad.x1, originY + quad.y1);
+    rlTexCoord2f(quad.u1, quad.v0);
+    rlVertex2f(originX + quad.x1, originY + quad.y0);
+  }
+  rlEnd();
+  rlSetTexture(0);
+}
+
+void GlyphRunCache::clear() { m_runs.clear(); }
+
+GlyphRunCache::Run GlyphRunCache::build(const std::string &text,
+                                        int fontSize) const {
+  Run run;
+  Font font = GetFontDefault();
+  if (font.texture.id == 0 || font.glyphs == nullptr)
+    return run;
+  run.width = MeasureText(text.c_str(), fontSize);
+
+  // Ten sam układ co DrawText -> DrawTextEx -> DrawTextCodepoint
+  if (fontSize < DEFAULT_FONT_SIZE)
+    fontSize = DEFAULT_FONT_SIZE;
+  float size = static_cast<float>(fontSize);
+  float spacing = static_cast<float>(fontSize / DEFAULT_FONT_SIZE);
+  float scale = size / font.baseSize;
+  float padding = static_cast<float>(font.glyphPadding);
+  float texWidth = static_cast<float>(font.texture.width);
+  float texHeight = static_cast<float>(font.texture.height);
+
+  run.quads.reserve(text.size());
+  float offsetX = 0.0f;
+  float offsetY = 0.0f;
+  for (size_t i = 0; i < text.size();) {
+    int bytes = 0;
+    int codepoint = GetCodepointNext(text.c_str() + i, &bytes);
+    i += bytes > 0 ? static_cast<size_t>(bytes) : 1;
+    if (codepoint == '\n') {
+      offsetY += size + DEFAULT_LINE_SPACING;
+      offsetX = 0.0f;
+      continue;
+    }
+
+    int index = GetGlyphIndex(font, codepoint);
+    const Rectangle &rec = font.recs[index];
+    const GlyphInfo &glyph = font.glyphs[index];
+    if (codepoint != ' ' && codepoint != '\t') {
+      Quad quad;
+      quad.x0 = offsetX + glyph.offsetX * scale - padding * scale;
+      quad.y0 = offsetY + glyph.offsetY * scale - padding * scale;
+      quad.x1 = quad.x0 + (rec.width + 2.0f * padding) * scale;
+      quad.y1 = quad.y0 + (rec.height + 2.0f * padding) * scale;
+      quad.u0 = (rec.x - padding) / texWidth;
+      quad.v0 = (rec.y - padding) / texHeight;
+      quad.u1 = (rec.x + rec.width + padding) / texWidth;
+      quad.v1 = (rec.y + rec.height + padding) / texHeight;
+      run.quads.push_back(quad);
+    }
+    if (glyph.advanceX == 0)
+      offsetX += rec.width * scale + spacing;
+    else
+      offsetX += glyph.advanceX * scale + spacing;
+  }
+  return run;
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <raylib.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Panel UI rysowany do własnej RenderTexture i odświeżany tylko po
+ * zmianie danych.
+ *
+ * Klucz panelu to skrót wartości, które pokazuje (setKey), a markDirty()
+ * wymusza odświeżenie z zewnątrz. draw() przy czystym panelu rysuje jeden
+ * prostokąt z teksturą; przy brudnym woła redraw() wewnątrz
+ * BeginTextureMode z przesunięciem, więc kod panelu rysuje w swoich
+ * zwykłych współrzędnych ekranu. Tekstura ma margines na poświatę ramki.
+ *
+ * Tekstura trzyma kolory przemnożone przez alfę (osobne czynniki blendu
+ * dla alfy), stąd rysowanie z BLEND_ALPHA_PREMULTIPLY - półprzezroczyste
+ * szkło wygląda tak samo jak rysowane bezpośrednio. Wyłączony cache
+ * (setEnabled(false)), brak okna albo FBO - redraw() co klatkę na ekran.
+ */
+class CachedPanel {
+public:
+  struct Stats {
+    size_t draws = 0;   // panele narysowane w tej klatce
+    size_t redraws = 0; // z tego odświeżone do tekstury
+  };
+
+  CachedPanel() = default;
+  ~CachedPanel() { unload(); }
+  CachedPanel(const CachedPanel &) = delete;
+  CachedPanel &operator=(const CachedPanel &) = delete;
+
+  void markDirty() { m_dirty = true; }
+  /** Zmiana klucza = odświeżenie przy najbliższym draw() */
+  void setKey(uint64_t key);
+  static uint64_t hashValues(std::initializer_list<int64_t> values);
+
+  /** Rysuje panel o granicach bounds (współrzędne ekranu) */
+  void draw(Rectangle bounds, const std::function<void()> &redraw);
+  void unload();
+
+  static void setEnabled(bool enabled);
+  static bool isEnabled();
+  static void beginFrame();
+  static const Stats &getStats();
+
+private:
+  RenderTexture2D m_target{};
+  Rectangle m_bounds{};
+  uint64_t m_key = 0;
+  bool m_dirty = true;
+  bool m_unavailable = false;
+};
+
+/**
+ * @brief Cache przebiegów glifów domyślnej czcionki, kluczowany napisem.
+ *
+ * DrawText/MeasureText za każdym razem dekodują UTF-8, szukają glifów i
+ * rysują każdy znak osobnym DrawTexturePro. Tu układ napisu (prostokąty
+ * ekranu względem początku i UV atlasu) liczy się raz, a rysowanie to
+ * jedna pętla wierzchołków z jednym rlSetTexture. Szerokość pochodzi z
+ * MeasureText, więc wyrównanie jest identyczne jak dotąd.
+ *
+ * Przy MAX_RUNS napisów cache jest czyszczony w całości (napisy
+ * zmieniające się co klatkę nie rosną bez końca).
+ */
+class GlyphRunCache {
+public:
+  static constexpr size_t MAX_RUNS = 2048;
+
+  struct Quad {
+    float x0, y0, x1, y1; // względem pozycji napisu
+    float u0, v0, u1, v1;
+  };
+
+  struct Run {
+    std::vector<Quad> quads;
+    int width = 0;
+  };
+
+  struct Stats {
+    size_t hits = 0;
+    size_t misses = 0;
+  };
+
+  static GlyphRunCache &getInstance() {
+    static GlyphRunCache instance;
+    return instance;
+  }
+
+  const Run &get(const std::string &text, int fontSize);
+  /** Odpowiednik MeasureText(text, fontSize) */
+  int measure(const std::string &text, int fontSize);
+  /** Odpowiednik DrawText(text, x, y, fontSize, color) */
+  void draw(const std::string &text, int x, int y, int fontSize, Color color);
+  void draw(const Run &run, int x, int y, Color color) const;
+
+  void setEnabled(bool enabled) { m_enabled = enabled; }
+  bool isEnabled() const { return m_enabled; }
+  void clear();
+  size_t size() const { return m_runs.size(); }
+  void beginFrame() { m_stats = Stats(); }
+  const Stats &getStats() const { return m_stats; }
+
+private:
+  GlyphRunCache() = default;
+
+  struct Key {
+    std::string text;
+    int fontSize = 0;
+    bool operator==(const Key &other) const {
+      return fontSize == other.fontSize && text == other.text;
+    }
+  };
+  struct KeyHash {
+    size_t operator()(const Key &key) const {
+      return std::hash<std::string>()(key.text) ^
+             (static_cast<size_t>(key.fontSize) * 0x9E3779B97F4A7C15ull);
+    }
+  };
+
+  Run build(const std::string &text, int fontSize) const;
+
+  std::unordered_map<Key, Run, KeyHash> m_runs;
+  Key m_lookup; // bufor klucza - bez alokacji przy trafieniu
+  unsigned int m_fontTexture = 0;
+  bool m_enabled = true;
+  Stats m_stats;
+};
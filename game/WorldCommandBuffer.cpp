@@ -0,0 +1,251 @@
+#include "WorldCommandBuffer.h"
+#include "../core/GameSystem.h"
+#include "../core/Logger.h"
+#include "Colony.h"
+#include "Settler.h"
+#include "Terrain.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+namespace {
+// Bufor jednego wątku - zapis bez synchronizacji, odczyt w playback
+struct ThreadBuffer {
+  std::vector<WorldCommand> commands;
+  uint64_t nextSequence = 0;
+  uint32_t entity = 0;
+
+  ThreadBuffer();
+  ~ThreadBuffer();
+};
+
+std::mutex g_registryMutex;
+std::vector<ThreadBuffer *> g_registry;
+std::atomic<uint64_t> g_batch{0};
+
+// Scalone komendy ze wszystkich wątków (pojemność reużywana)
+std::vector<WorldCommand> g_merged;
+WorldCommandBuffer::Stats g_stats;
+std::atomic<size_t> g_recorded{0};
+
+ThreadBuffer::ThreadBuffer() {
+  std::lock_guard<std::mutex> lock(g_registryMutex);
+  g_registry.push_back(this);
+}
+
+ThreadBuffer::~ThreadBuffer() {
+  std::lock_guard<std::mutex> lock(g_registryMutex);
+  g_registry.erase(std::remove(g_registry.begin(), g_registry.end(), this),
+                   g_registry.end());
+}
+
+ThreadBuffer &forThread() {
+  thread_local ThreadBuffer buffer;
+  return buffer;
+}
+} // namespace
+
+void WorldCommandBuffer::record(WorldCommand &&command) {
+  ThreadBuffer &buffer = forThread();
+  command.batch = g_batch.load(std::memory_order_relaxed);
+  command.entity = buffer.entity;
+  command.sequence = buffer.nextSequence++;
+  buffer.commands.push_back(std::move(command));
+  g_recorded.fetch_add(1, std::memory_order_relaxed);
+}
+
+void WorldCommandBuffer::spawnProjectile(
+    std::unique_ptr<Projectile> projectile) {
+  if (!projectile)
+    return;
+  WorldCommand command;
+  command.type = WorldCommandType::SpawnProjectile;
+  command.projectile = std::move(projectile);
+  record(std::move(command));
+}
+
+void WorldCommandBuffer::spawnTree(std::unique_ptr<Tree> tree) {
+  if (!tree)
+    return;
+  WorldCommand command;
+  command.type = WorldCommandType::SpawnTree;
+  command.tree = std::move(tree);
+  record(std::move(command));
+}
+
+void WorldCommandBuffer::dropItem(Vector3 position, std::unique_ptr<Item> item,
+                                  int amount) {
+  if (!item)
+    return;
+  WorldCommand command;
+  command.type = WorldCommandType::DropItem;
+  command.position = position;
+  command.amount = amount;
+  command.item = std::move(item);
+  record(std::move(command));
+}
+
+void WorldCommandBuffer::destroyDroppedItem(size_t droppedIndex,
+                                            const Item *expected) {
+  WorldCommand command;
+  command.type = WorldCommandType::DestroyDroppedItem;
+  command.droppedIndex = droppedIndex;
+  command.expectedItem = expected;
+  record(std::move(command));
+}
+
+void WorldCommandBuffer::moveToInventory(size_t droppedIndex,
+                                         const Item *expected,
+                                         Settler *settler,
+                                         bool equipIfHandsEmpty,
+                                         uint32_t pickupSequence) {
+  if (!settler)
+    return;
+  WorldCommand command;
+  command.type = WorldCommandType::MoveToInventory;
+  command.droppedIndex = droppedIndex;
+  command.expectedItem = expected;
+  command.settler = settler;
+  command.equipIfHandsEmpty = equipIfHandsEmpty;
+  command.pickupSequence = pickupSequence;
+  record(std::move(command));
+}
+
+WorldCommandBuffer::Batch::Batch() {
+  g_batch.fetch_add(1, std::memory_order_relaxed);
+}
+
+WorldCommandBuffer::Batch::~Batch() {
+  g_batch.fetch_add(1, std::memory_order_relaxed);
+}
+
+WorldCommandBuffer::EntityScope::EntityScope(uint32_t entity) {
+  ThreadBuffer &buffer = forThread();
+  m_previous = buffer.entity;
+  buffer.entity = entity;
+}
+
+WorldCommandBuffer::EntityScope::~EntityScope() {
+  forThread().entity = m_previous;
+}
+
+size_t WorldCommandBuffer::playback(Colony &colony) {
+  {
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    for (ThreadBuffer *buffer : g_registry) {
+      std::move(buffer->commands.begin(), buffer->commands.end(),
+                std::back_inserter(g_merged));
+      buffer->commands.clear();
+    }
+  }
+  if (g_merged.empty()) {
+    g_stats.lastPlayback = 0;
+    return 0;
+  }
+
+  // Ten sam porządek co przy wykonaniu szeregowym, niezależnie od wątków
+  std::sort(g_merged.begin(), g_merged.end(),
+            [](const WorldCommand &a, const WorldCommand &b) {
+              if (a.batch != b.batch)
+                return a.batch < b.batch;
+              if (a.entity != b.entity)
+                return a.entity < b.entity;
+              return a.sequence < b.sequence;
+            });
+
+  size_t applied = 0;
+  for (WorldCommand &command : g_merged) {
+    if (apply(command, colony))
+      ++applied;
+    else
+      ++g_stats.failed;
+  }
+  g_stats.applied += applied;
+  g_stats.lastPlayback = g_merged.size();
+  g_stats.peakPlayback = std::max(g_stats.peakPlayback, g_merged.size());
+  g_merged.clear();
+  return applied;
+}
+
+bool WorldCommandBuffer::apply(WorldCommand &command, Colony &colony) {
+  switch (command.type) {
+  case WorldCommandType::SpawnProjectile:
+    colony.addProjectile(std::move(command.projectile));
+    return true;
+
+  case WorldCommandType::SpawnTree: {
+    Terrain *terrain = GameSystem::getTerrain();
+    if (!terrain)
+      return false;
+    terrain->addTree(std::move(command.tree));
+    return true;
+  }
+
+  case WorldCommandType::DropItem:
+    colony.addDroppedItem(std::move(command.item), command.position,
+                          command.amount);
+    return true;
+
+  case WorldCommandType::DestroyDroppedItem:
+  case WorldCommandType::MoveToInventory: {
+    Settler *settler = command.settler;
+    std::vector<WorldItem> &dropped = colony.getDroppedItems();
+    if (command.droppedIndex >= dropped.size() ||
+        !dropped[command.droppedIndex].item ||
+        dropped[command.droppedIndex].item.get() != command.expectedItem) {
+      // zabrany przez wcześniejszą komendę
+      if (settler)
+        settler->resolvePickup(command.pickupSequence, false);
+      return false;
+    }
+    WorldItem &worldItem = dropped[command.droppedIndex];
+    int amount = worldItem.amount;
+
+    bool equip = command.type == WorldCommandType::MoveToInventory &&
+                 command.equipIfHandsEmpty &&
+                 settler->getHeldItem() == nullptr;
+    // addItem niszczy przedmiot, którego nie przyjmie - zostaje na ziemi
+    if (command.type == WorldCommandType::MoveToInventory && !equip &&
+        !settler->getInventory().canAdd(*worldItem.item, amount)) {
+      if (command.pickupSequence != 0)
+        worldItem.releaseReservation();
+      settler->resolvePickup(command.pickupSequence, false);
+      return false;
+    }
+
+    std::unique_ptr<Item> item = colony.takeDroppedItem(command.droppedIndex);
+    if (command.type == WorldCommandType::DestroyDroppedItem)
+      return true;
+
+    LOG_DBG(Settler, settler->getName(), equip ? " equipped " : " picked up ",
+            item->getDisplayName(), " x", amount);
+    if (equip) {
+      settler->setHeldItem(std::move(item));
+    } else {
+      settler->getInventory().addItem(std::move(item), amount);
+    }
+    settler->resolvePickup(command.pickupSequence, true);
+    return true;
+  }
+  }
+  return false;
+}
+
+WorldCommandBuffer::Stats WorldCommandBuffer::getStats() {
+  Stats stats = g_stats;
+  stats.recorded = g_recorded.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void WorldCommandBuffer::resetStats() {
+  g_stats = Stats();
+  g_recorded.store(0, std::memory_order_relaxed);
+}
+
+size_t WorldCommandBuffer::getPendingCount() {
+  std::lock_guard<std::mutex> lock(g_registryMutex);
+  size_t pending = 0;
+  for (const ThreadBuffer *buffer : g_registry)
+    pending += buffer->commands.size();
+  return pending;
+}
@@ -0,0 +1,121 @@
+#ifndef WORLD_COMMAND_BUFFER_H
+#define WORLD_COMMAND_BUFFER_H
+
+#include "Item.h"
+#include "Projectile.h"
+#include "Tree.h"
+#include "raylib.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class Colony;
+class Settler;
+
+enum class WorldCommandType : uint8_t {
+  SpawnProjectile,    // create
+  SpawnTree,          // create
+  DropItem,           // drop na ziemię
+  DestroyDroppedItem, // destroy
+  MoveToInventory     // przedmiot z ziemi do ekwipunku osadnika
+};
+
+struct WorldCommand {
+  WorldCommandType type = WorldCommandType::DropItem;
+
+  // Klucz sortowania: (batch, entity, sequence) - patrz WorldCommandBuffer
+  uint64_t batch = 0;
+  uint32_t entity = 0;
+  uint64_t sequence = 0;
+
+  Vector3 position{0.0f, 0.0f, 0.0f};
+  int amount = 1;
+  size_t droppedIndex = 0;
+  const Item *expectedItem = nullptr; // kontrola, że indeks nadal wskazuje ten przedmiot
+  Settler *settler = nullptr;
+  bool equipIfHandsEmpty = false;
+  uint32_t pickupSequence = 0; // Settler::resolvePickup, 0 = bez zwrotki
+
+  std::unique_ptr<Item> item;
+  std::unique_ptr<Tree> tree;
+  std::unique_ptr<Projectile> projectile;
+};
+
+/**
+ * @brief Odroczone zmiany struktury świata (spawn/destroy/drop/pickup).
+ *
+ * Kod osadników i kolonii nie dodaje niczego do wektorów świata w trakcie
+ * ich iteracji - zapisuje komendę do bufora swojego wątku. Colony::update
+ * odtwarza komendy w punktach synchronizacji (playback), gdy żaden wątek
+ * nie trzyma referencji do kontenerów.
+ *
+ * Kolejność odtworzenia jest deterministyczna i równa kolejności
+ * wykonania szeregowego: komendy są sortowane po (batch, entity, sequence).
+ * Batch zmienia wątek główny przy wejściu/wyjściu z fazy (Batch), entity
+ * ustawia EntityScope (indeks osadnika), sequence rośnie w obrębie wątku.
+ * Poza EntityScope komendy powinien zapisywać tylko wątek główny.
+ */
+class WorldCommandBuffer {
+public:
+  static void spawnProjectile(std::unique_ptr<Projectile> projectile);
+  static void spawnTree(std::unique_ptr<Tree> tree);
+  static void dropItem(Vector3 position, std::unique_ptr<Item> item,
+                       int amount = 1);
+  static void destroyDroppedItem(size_t droppedIndex, const Item *expected);
+  // pickupSequence != 0: wynik trafia do settler->resolvePickup, a przy
+  // porażce playback zwalnia rezerwację przedmiotu na ziemi
+  static void moveToInventory(size_t droppedIndex, const Item *expected,
+                              Settler *settler, bool equipIfHandsEmpty,
+                              uint32_t pickupSequence = 0);
+
+  /**
+   * @brief Faza przetwarzania encji (np. Think/Update osadników).
+   * Tylko wątek główny.
+   */
+  class Batch {
+  public:
+    Batch();
+    ~Batch();
+    Batch(const Batch &) = delete;
+    Batch &operator=(const Batch &) = delete;
+  };
+
+  /**
+   * @brief Komendy zapisane w zakresie są przypisane encji o danym
+   * indeksie (sortowanie jak w pętli szeregowej). Indeksy od 1.
+   */
+  class EntityScope {
+  public:
+    explicit EntityScope(uint32_t entity);
+    ~EntityScope();
+    EntityScope(const EntityScope &) = delete;
+    EntityScope &operator=(const EntityScope &) = delete;
+
+  private:
+    uint32_t m_previous;
+  };
+
+  /**
+   * @brief Odtwarza wszystkie zapisane komendy. Wątki robocze muszą być
+   * bezczynne. Zwraca liczbę zastosowanych komend.
+   */
+  static size_t playback(Colony &colony);
+
+  struct Stats {
+    size_t recorded = 0;     // od ostatniego resetStats
+    size_t applied = 0;
+    size_t failed = 0;       // np. przedmiot zabrany wcześniej
+    size_t lastPlayback = 0; // komendy w ostatnim playbacku
+    size_t peakPlayback = 0;
+  };
+  static Stats getStats();
+  static void resetStats();
+  static size_t getPendingCount();
+
+private:
+  static void record(WorldCommand &&command);
+  static bool apply(WorldCommand &command, Colony &colony);
+};
+
+#endif // WORLD_COMMAND_BUFFER_H
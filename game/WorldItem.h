@@ -21,6 +21,9 @@ public:
     WorldItem(Vector3 pos, std::unique_ptr<Item> it, float time, bool pending, int amt)
         : position(pos), item(std::move(it)), dropTime(time), pendingRemoval(pending), amount(amt) {}
 
+    // Id współdzielonej definicji (porównania/stackowanie bez stringów)
+    ItemDefId getDefinitionId() const { return item ? item->getDefinitionId() : INVALID_ITEM_DEF; }
+
     bool isReserved() const { return m_isReserved; }
     void reserve(const std::string& name) { m_isReserved = true; m_reservedBy = name; }
     void releaseReservation() { m_isReserved = false; m_reservedBy = ""; }
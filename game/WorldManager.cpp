@@ -2,7 +2,10 @@
 #include "Faction.h"
 #include "Region.h"
 #include "Settlement.h"
+#include "../core/JobSystem.h"
+#include "../core/Profiler.h"
 #include "raymath.h"
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
@@ -40,12 +43,17 @@ void WorldManager::Initialize() {
   std::cout << "[WorldManager] Created " << regions.size() << " initial regions"
             << std::endl;
 
-  // Activate center region by default
+  // Generate the starting area on workers; only the center region is needed
+  // before the first frame, the rest finishes in the background
   GridCoord centerCoord = {0, 0};
+  RequestRegionContent(centerCoord, true);
+  PrefetchAround(centerCoord);
+  WaitForRegionContent(centerCoord);
+
+  // Activate center region by default
   Region *centerRegion = GetRegionByGrid(centerCoord);
   if (centerRegion) {
-    centerRegion->ActivateFullSimulation();
-    activeRegions.push_back(centerRegion);
+    ActivateRegion(centerRegion);
     std::cout << "[WorldManager] Activated center region (0,0)" << std::endl;
   }
 
@@ -65,7 +73,9 @@ void WorldManager::Initialize() {
 }
 
 void WorldManager::Update(float deltaTime, Vector3 playerPosition) {
-  lastPlayerPosition = playerPosition;
+  PROFILE_ZONE("WorldManager::Update");
+  // Finished generation jobs -> attach content, run deferred activations
+  PumpStreamJobs();
 
   // Check if player changed grid cell
   GridCoord newPlayerGrid = WorldPosToGrid(playerPosition);
@@ -74,6 +84,16 @@ void WorldManager::Update(float deltaTime, Vector3 playerPosition) {
     UpdateRegionActivation(playerPosition);
   }
 
+  // Prefetch where the player is and where they will be in a few seconds
+  PrefetchAround(currentPlayerGrid);
+  Vector3 predicted = Vector3Add(
+      playerPosition,
+      Vector3Scale(playerVelocity, streamingConfig.lookaheadSeconds));
+  GridCoord predictedGrid = WorldPosToGrid(predicted);
+  if (!(predictedGrid == currentPlayerGrid)) {
+    PrefetchAround(predictedGrid);
+  }
+
   // Update all active regions
   for (Region *region : activeRegions) {
     if (region) {
@@ -114,6 +134,21 @@ void WorldManager::Render() {
 void WorldManager::Shutdown() {
   std::cout << "[WorldManager] Shutting down..." << std::endl;
 
+  // Workers write into StreamJob - wait before the jobs are destroyed
+  for (auto &pair : streamJobs) {
+    try {
+      JobSystem::getInstance().wait(pair.second->pending);
+    } catch (const std::exception &e) {
+      std::cerr << "[WorldManager] Region generation failed: " << e.what()
+                << std::endl;
+    } catch (...) {
+      std::cerr << "[WorldManager] Region generation failed" << std::endl;
+    }
+  }
+  streamJobs.clear();
+  pendingActivation.clear();
+  streamingStats.inFlight = 0;
+
   // Deactivate all regions
   for (Region *region : activeRegions) {
     if (region) {
@@ -202,9 +237,11 @@ void WorldManager::DrawDebugInfo() {
   // Stats
   char statsText[256];
   snprintf(statsText, sizeof(statsText),
-           "Active Regions: %zu | Total Regions: %zu | Player Grid: (%d, %d)",
+           "Active Regions: %zu | Total Regions: %zu | Player Grid: (%d, %d) "
+           "| Streaming: %zu in flight, %zu hits, %zu misses",
            activeRegions.size(), regions.size(), currentPlayerGrid.x,
-           currentPlayerGrid.z);
+           currentPlayerGrid.z, streamingStats.inFlight,
+           streamingStats.prefetchHits, streamingStats.prefetchMisses);
   DrawText(statsText, offsetX, offsetY + 30 + gridSize * cellSize + 10, 12,
            WHITE);
 
@@ -240,10 +277,7 @@ void WorldManager::UpdateRegionActivation(Vector3 playerPos) {
     float dist = Vector3Distance(playerPos, regionCenter);
 
     if (dist <= DIST_ACTIVE) {
-      if (region->GetState() != RegionState::ACTIVE) {
-        region->SetState(RegionState::ACTIVE);
-      }
-      activeRegions.push_back(region);
+      RequestActivation(region);
     } else if (dist <= DIST_PASSIVE) {
       if (region->GetState() != RegionState::PASSIVE) {
         region->SetState(RegionState::PASSIVE);
@@ -251,29 +285,170 @@ void WorldManager::UpdateRegionActivation(Vector3 playerPos) {
     } else {
       if (region->GetState() != RegionState::BACKGROUND) {
         region->SetState(RegionState::BACKGROUND);
+        // Far away - drop generated data, it is regenerated on return
+        region->ReleaseContent();
       }
     }
   }
 
   // Ensure immediate neighbors are created if they don't exist (Lazy loading)
-  // ... (Keep existing neighbor creation logic if needed, but simplified loop
-  // above covers state) Actually, the previous logic created new regions. We
-  // should keep that.
-
   GridCoord playerGrid = WorldPosToGrid(playerPos);
   for (int dx = -1; dx <= 1; ++dx) {
     for (int dz = -1; dz <= 1; ++dz) {
       GridCoord coord = {playerGrid.x + dx, playerGrid.z + dz};
       EnsureRegionExists(coord);
-      // They will be picked up by the next update loop or forced active here
       Region *r = GetRegionByGrid(coord);
-      if (r && r->GetState() != RegionState::ACTIVE) {
-        r->SetState(RegionState::ACTIVE);
-        // Add to active list if not already there (std::find check or just
-        // ensure unique) Simple way: just run the loop above.
+      if (r) {
+        RequestActivation(r);
+      }
+    }
+  }
+}
+
+void WorldManager::ActivateRegion(Region *region) {
+  if (!region->IsActive()) {
+    region->SetState(RegionState::ACTIVE);
+  }
+  if (std::find(activeRegions.begin(), activeRegions.end(), region) ==
+      activeRegions.end()) {
+    activeRegions.push_back(region);
+  }
+}
+
+void WorldManager::RequestActivation(Region *region) {
+  if (region->IsActive()) {
+    ActivateRegion(region);
+    return;
+  }
+  if (region->HasContent()) {
+    ++streamingStats.prefetchHits;
+    ActivateRegion(region);
+    return;
+  }
+
+  // Content not ready: never generate on the main thread - activate when the
+  // job finishes (PumpStreamJobs)
+  ++streamingStats.prefetchMisses;
+  GridCoord coord = region->GetGridCoord();
+  RequestRegionContent(coord, true);
+  if (std::find(pendingActivation.begin(), pendingActivation.end(), coord) ==
+      pendingActivation.end()) {
+    pendingActivation.push_back(coord);
+    ++streamingStats.deferredActivations;
+  }
+}
+
+void WorldManager::UpdatePlayerVelocity(float deltaTime,
+                                        Vector3 playerPosition) {
+  if (!hasLastPosition || deltaTime <= 0.0f) {
+    hasLastPosition = true;
+    lastPlayerPosition = playerPosition;
+    return;
+  }
+
+  Vector3 sample = Vector3Scale(
+      Vector3Subtract(playerPosition, lastPlayerPosition), 1.0f / deltaTime);
+  sample.y = 0.0f;
+  lastPlayerPosition = playerPosition;
+  // Teleport / camera switch - do not predict from the jump
+  if (Vector3Length(sample) > REGION_SIZE) {
+    playerVelocity = {0.0f, 0.0f, 0.0f};
+    return;
+  }
+  playerVelocity =
+      Vector3Lerp(playerVelocity, sample, streamingConfig.velocitySmoothing);
+}
+
+void WorldManager::RequestRegionContent(GridCoord coord, bool urgent) {
+  EnsureRegionExists(coord);
+  Region *region = GetRegionByGrid(coord);
+  if (!region || region->HasContent() ||
+      streamJobs.find(coord) != streamJobs.end()) {
+    return;
+  }
+  // Prefetch respects the cap, a region the player already entered does not
+  if (!urgent &&
+      static_cast<int>(streamJobs.size()) >= streamingConfig.maxJobsInFlight) {
+    return;
+  }
+
+  auto job = std::make_unique<StreamJob>();
+  StreamJob *target = job.get();
+  Vector3 center = region->GetCenter();
+  unsigned int seed = worldSeed;
+  streamJobs[coord] = std::move(job);
+
+  JobSystem::getInstance().submit(
+      [target, coord, center, seed]() {
+        target->result = RegionContent::Generate(coord, center, seed);
+      },
+      &target->pending);
+
+  ++streamingStats.requested;
+  streamingStats.inFlight = streamJobs.size();
+}
+
+void WorldManager::PrefetchAround(GridCoord center) {
+  // Closest first, so the cap drops the least urgent requests
+  RequestRegionContent(center, false);
+  for (int dx = -1; dx <= 1; ++dx) {
+    for (int dz = -1; dz <= 1; ++dz) {
+      if (dx == 0 && dz == 0)
+        continue;
+      RequestRegionContent({center.x + dx, center.z + dz}, false);
+    }
+  }
+}
+
+void WorldManager::PumpStreamJobs() {
+  for (auto it = streamJobs.begin(); it != streamJobs.end();) {
+    if (it->second->pending.load(std::memory_order_acquire) != 0) {
+      ++it;
+      continue;
+    }
+    // Polled, not waited on - collect a failed job's exception here
+    if (std::exception_ptr error =
+            JobSystem::getInstance().takeFailure(it->second->pending)) {
+      try {
+        std::rethrow_exception(error);
+      } catch (const std::exception &e) {
+        std::cerr << "[WorldManager] Region generation failed: " << e.what()
+                  << std::endl;
+      } catch (...) {
+        std::cerr << "[WorldManager] Region generation failed" << std::endl;
       }
     }
+    Region *region = GetRegionByGrid(it->first);
+    if (region && it->second->result) {
+      region->AttachContent(std::move(it->second->result));
+      ++streamingStats.completed;
+    }
+    it = streamJobs.erase(it);
+  }
+  streamingStats.inFlight = streamJobs.size();
+
+  // Deferred activations - only those still next to the player
+  for (auto it = pendingActivation.begin(); it != pendingActivation.end();) {
+    Region *region = GetRegionByGrid(*it);
+    bool stillNear = std::abs(it->x - currentPlayerGrid.x) <= ACTIVATION_RADIUS &&
+                     std::abs(it->z - currentPlayerGrid.z) <= ACTIVATION_RADIUS;
+    if (!region || !stillNear) {
+      it = pendingActivation.erase(it);
+    } else if (region->HasContent()) {
+      ActivateRegion(region);
+      it = pendingActivation.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void WorldManager::WaitForRegionContent(GridCoord coord) {
+  auto it = streamJobs.find(coord);
+  if (it != streamJobs.end()) {
+    JobSystem::getInstance().wait(it->second->pending);
   }
+  PumpStreamJobs();
 }
 
 void WorldManager::EnsureRegionExists(GridCoord coord) {
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "raylib.h"
+#include <atomic>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <vector>
@@ -9,6 +11,7 @@
 // Forward declarations
 class Region;
 class Faction;
+struct RegionContent;
 
 // Grid coordinate for regions
 struct GridCoord {
@@ -35,8 +38,11 @@ struct GridCoord {
  * - Manage global time and world state
  * - Coordinate AI factions
  *
- * Phase 0: Basic 3x3 static grid, simple activation
- * Future: Dynamic loading, infinite procedural world
+ * Streaming: region content (spawn points, CPU data only) is generated on
+ * JobSystem workers and attached on the main thread. Regions
+ * around the player and around the position predicted from player velocity
+ * are requested ahead of time, so crossing a region border only swaps in
+ * ready data. If content is late, activation is deferred - never blocks.
  */
 class WorldManager {
 private:
@@ -49,6 +55,36 @@ private:
   // Player tracking
   Vector3 lastPlayerPosition;
   GridCoord currentPlayerGrid;
+  Vector3 playerVelocity = {0.0f, 0.0f, 0.0f}; // smoothed, m/s
+  bool hasLastPosition = false;
+
+public:
+  struct StreamingConfig {
+    float lookaheadSeconds = 4.0f; // prefetch around pos + velocity * this
+    int maxJobsInFlight = 4;
+    float velocitySmoothing = 0.2f; // 0..1, weight of the newest sample
+  };
+
+  struct StreamingStats {
+    size_t requested = 0;      // generation jobs submitted
+    size_t completed = 0;      // content attached to regions
+    size_t prefetchHits = 0;   // activation found content ready
+    size_t prefetchMisses = 0; // activation had to wait for a job
+    size_t deferredActivations = 0;
+    size_t inFlight = 0;
+  };
+
+private:
+  // Content generation in progress (result written by the worker)
+  struct StreamJob {
+    std::atomic<int> pending{0};
+    std::shared_ptr<RegionContent> result;
+  };
+  std::map<GridCoord, std::unique_ptr<StreamJob>> streamJobs;
+  std::vector<GridCoord> pendingActivation;
+  StreamingConfig streamingConfig;
+  StreamingStats streamingStats;
+  unsigned int worldSeed = 1337;
 
   // Factions
   std::vector<std::unique_ptr<Faction>> factions;
@@ -81,6 +117,17 @@ public:
   GridCoord WorldPosToGrid(Vector3 pos);
   Vector3 GridToWorldPos(GridCoord coord);
 
+  // Streaming
+  void SetWorldSeed(unsigned int seed) { worldSeed = seed; }
+  StreamingConfig &GetStreamingConfig() { return streamingConfig; }
+  const StreamingStats &GetStreamingStats() const { return streamingStats; }
+  Vector3 GetPlayerVelocity() const { return playerVelocity; }
+  // Sample the player position once per step of the code that moves the
+  // player (rendered frame for FPS/RTS camera), with that step's time.
+  // Update() only reads the smoothed velocity - at 4x/10x time scale it
+  // runs several ticks per frame and would see the motion in one of them.
+  void UpdatePlayerVelocity(float deltaTime, Vector3 playerPosition);
+
   // Faction management (Phase 0: stubs)
   void RegisterFaction(std::unique_ptr<Faction> faction);
 
@@ -90,4 +137,12 @@ public:
 private:
   void UpdateRegionActivation(Vector3 playerPos);
   void EnsureRegionExists(GridCoord coord);
+  void ActivateRegion(Region *region);
+
+  // Streaming helpers
+  void RequestRegionContent(GridCoord coord, bool urgent);
+  void RequestActivation(Region *region);
+  void PrefetchAround(GridCoord center);
+  void PumpStreamJobs();
+  void WaitForRegionContent(GridCoord coord);
 };
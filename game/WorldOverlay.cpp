@@ -0,0 +1,214 @@
+#include "WorldOverlay.h"
+#include "UIRenderCache.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include <cmath>
+
+WorldOverlay::Anchor WorldOverlay::anchor(Vector3 world, float margin,
+                                          bool snap) {
+  m_x.push_back(world.x);
+  m_y.push_back(world.y);
+  m_z.push_back(world.z);
+  m_margin.push_back(margin);
+  m_snap.push_back(snap ? 1.0f : 0.0f);
+  return static_cast<Anchor>(m_x.size() - 1);
+}
+
+void WorldOverlay::pushRect(Anchor anchor, Rectangle offset, Color color) {
+  Texture2D texture = GetShapesTexture();
+  Rectangle source = GetShapesTextureRectangle();
+  float width = texture.width > 0 ? static_cast<float>(texture.width) : 1.0f;
+  float height = texture.height > 0 ? static_cast<float>(texture.height) : 1.0f;
+
+  Quad quad;
+  quad.x0 = offset.x;
+  quad.y0 = offset.y;
+  quad.x1 = offset.x + offset.width;
+  quad.y1 = offset.y + offset.height;
+  quad.u0 = source.x / width;
+  quad.v0 = source.y / height;
+  quad.u1 = (source.x + source.width) / width;
+  quad.v1 = (source.y + source.height) / height;
+  quad.color = color;
+  quad.texture = texture.id;
+  m_quads.push_back(quad);
+  m_quadAnchors.push_back(anchor);
+}
+
+void WorldOverlay::rect(Anchor anchor, Rectangle offset, Color color) {
+  m_items++;
+  pushRect(anchor, offset, color);
+}
+
+void WorldOverlay::rectLines(Anchor anchor, Rectangle offset, float thickness,
+                             Color color) {
+  m_items++;
+  // Te same cztery pasy co DrawRectangleLinesEx
+  if (thickness > offset.width || thickness > offset.height) {
+    thickness = fminf(offset.width, offset.height) / 2.0f;
+  }
+  float x = offset.x, y = offset.y, w = offset.width, h = offset.height;
+  pushRect(anchor, {x, y, w, thickness}, color);
+  pushRect(anchor, {x, y + h - thickness, w, thickness}, color);
+  pushRect(anchor, {x, y + thickness, thickness, h - thickness * 2.0f}, color);
+  pushRect(anchor, {x + w - thickness, y + thickness, thickness,
+                    h - thickness * 2.0f},
+           color);
+}
+
+void WorldOverlay::text(Anchor anchor, const std::string &text, float x,
+                        float y, int fontSize, Color color) {
+  m_items++;
+  GlyphRunCache &glyphs = GlyphRunCache::getInstance();
+  const GlyphRunCache::Run &run = glyphs.get(text, fontSize);
+  unsigned int texture = GetFontDefault().texture.id;
+  for (const GlyphRunCache::Quad &glyph : run.quads) {
+    Quad quad;
+    quad.x0 = x + glyph.x0;
+    quad.y0 = y + glyph.y0;
+    quad.x1 = x + glyph.x1;
+    quad.y1 = y + glyph.y1;
+    quad.u0 = glyph.u0;
+    quad.v0 = glyph.v0;
+    quad.u1 = glyph.u1;
+    quad.v1 = glyph.v1;
+    quad.color = color;
+    quad.texture = texture;
+    m_quads.push_back(quad);
+    m_quadAnchors.push_back(anchor);
+  }
+}
+
+void WorldOverlay::bar(Vector3 world, float progress, Color color) {
+  const float width = 40.0f;
+  const float height = 6.0f;
+  Anchor at = anchor(world);
+  Rectangle bg = {-width / 2, -height / 2, width, height};
+  rect(at, bg, BLACK);
+  rect(at, {bg.x, bg.y, width * progress, height}, color);
+  rectLines(at, bg, 1.0f, DARKGRAY);
+}
+
+void WorldOverlay::project(const Camera3D &camera, int screenWidth,
+                           int screenHeight) {
+  // Ten sam rzut co GetWorldToScreenEx, złożony w jedną macierz
+  double aspect = static_cast<double>(screenWidth) / screenHeight;
+  Matrix projection;
+  if (camera.projection == CAMERA_ORTHOGRAPHIC) {
+    double top = camera.fovy / 2.0;
+    double right = top * aspect;
+    projection = MatrixOrtho(-right, right, -top, top, rlGetCullDistanceNear(),
+                             rlGetCullDistanceFar());
+  } else {
+    projection = MatrixPerspective(camera.fovy * DEG2RAD, aspect,
+                                   rlGetCullDistanceNear(),
+                                   rlGetCullDistanceFar());
+  }
+  Matrix view = MatrixLookAt(camera.position, camera.target, camera.up);
+  const Matrix m = MatrixMultiply(view, projection);
+
+  size_t count = m_x.size();
+  m_screenX.resize(count);
+  m_screenY.resize(count);
+  m_visible.resize(count);
+
+  const float halfWidth = 0.5f * static_cast<float>(screenWidth);
+  const float halfHeight = 0.5f * static_cast<float>(screenHeight);
+  const float maxX = static_cast<float>(screenWidth);
+  const float maxY = static_cast<float>(screenHeight);
+  const float *xs = m_x.data();
+  const float *ys = m_y.data();
+  const float *zs = m_z.data();
+  const float *margins = m_margin.data();
+  const float *snaps = m_snap.data();
+  float *outX = m_screenX.data();
+  float *outY = m_screenY.data();
+  uint8_t *visible = m_visible.data();
+
+  // Jedna pętla bez rozgałęzień po tablicach SoA - kompilator ją
+  // wektoryzuje; punkt za kamerą (w <= 0) odpada w masce widoczności
+  for (size_t i = 0; i < count; ++i) {
+    float x = xs[i], y = ys[i], z = zs[i];
+    float clipX = m.m0 * x + m.m4 * y + m.m8 * z + m.m12;
+    float clipY = m.m1 * x + m.m5 * y + m.m9 * z + m.m13;
+    float clipW = m.m3 * x + m.m7 * y + m.m11 * z + m.m15;
+    float invW = 1.0f / (clipW > 1e-6f ? clipW : 1e-6f);
+    float sx = (clipX * invW + 1.0f) * halfWidth;
+    float sy = (1.0f - clipY * invW) * halfHeight;
+    float margin = margins[i];
+    float snap = snaps[i];
+    outX[i] = sx + snap * (floorf(sx) - sx);
+    outY[i] = sy + snap * (floorf(sy) - sy);
+    visible[i] = static_cast<uint8_t>((clipW > 1e-6f) & (sx >= -margin) &
+                                      (sx <= maxX + margin) &
+                                      (sy >= -margin) & (sy <= maxY + margin));
+  }
+}
+
+void WorldOverlay::flush(const Camera3D &camera, int screenWidth,
+                         int screenHeight) {
+  m_stats = Stats();
+  m_stats.anchors = m_x.size();
+  m_stats.items = m_items;
+  if (m_quads.empty() || screenWidth <= 0 || screenHeight <= 0) {
+    clear();
+    return;
+  }
+
+  project(camera, screenWidth, screenHeight);
+  for (uint8_t visible : m_visible) {
+    if (!visible)
+      m_stats.culled++;
+  }
+
+  // Jeden rlBegin dla całej nakładki - tekstura zmienia się tylko, gdy
+  // kształty nie korzystają z atlasu czcionki
+  unsigned int texture = 0;
+  bool open = false;
+  for (size_t i = 0; i < m_quads.size(); ++i) {
+    Anchor at = m_quadAnchors[i];
+    if (!m_visible[at])
+      continue;
+    const Quad &quad = m_quads[i];
+    if (!open || quad.texture != texture) {
+      if (open)
+        rlEnd();
+      texture = quad.texture;
+      rlSetTexture(texture);
+      rlBegin(RL_QUADS);
+      rlNormal3f(0.0f, 0.0f, 1.0f);
+      open = true;
+    }
+    // Przepełnienie batcha rlgl: opróżnia go i kontynuuje ten sam tryb
+    rlCheckRenderBatchLimit(4);
+
+    float x = m_screenX[at];
+    float y = m_screenY[at];
+    rlColor4ub(quad.color.r, quad.color.g, quad.color.b, quad.color.a);
+    rlTexCoord2f(quad.u0, quad.v0);
+    rlVertex2f(x + quad.x0, y + quad.y0);
+    rlTexCoord2f(quad.u0, quad.v1);
+    rlVertex2f(x + quad.x0, y + quad.y1);
+    rlTexCoord2f(quad.u1, quad.v1);
+    rlVertex2f(x + quad.x1, y + quad.y1);
+    rlTexCoord2f(quad.u1, quad.v0);
+    rlVertex2f(x + quad.x1, y + quad.y0);
+    m_stats.quads++;
+  }
+  if (open) {
+    rlEnd();
+    rlSetTexture(0);
+  }
+  clear();
+}
+
+void WorldOverlay::clear() {
+  m_x.clear();
+  m_y.clear();
+  m_z.clear();
+  m_margin.clear();
+  m_snap.clear();
+  m_quads.clear();
+  m_quadAnchors.clear();
+  m_items = 0;
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <raylib.h>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Wsadowa nakładka 2D nad obiektami świata: paski zdrowia/postępu,
+ * prostokąty i napisy zaczepione w punktach 3D.
+ *
+ * Zamiast GetWorldToScreen i kilku DrawRectangle na obiekt, wołający
+ * dodaje punkty zaczepienia (anchor) i elementy z przesunięciem w
+ * pikselach względem rzutu punktu. flush() rzutuje wszystkie punkty
+ * jedną pętlą po tablicach współrzędnych (SoA, bez rozgałęzień - pętla
+ * wektoryzowana przez kompilator), odrzuca te za kamerą i poza ekranem
+ * z marginesem, a resztę wysyła jako czworokąty jednego rlBegin z jedną
+ * teksturą: atlas domyślnej czcionki, w którym raylib trzyma też biały
+ * prostokąt do kształtów. Cała nakładka to zwykle jedno wywołanie
+ * rysowania.
+ *
+ * Napisy biorą układ glifów z GlyphRunCache. Kolejność rysowania =
+ * kolejność dodawania. Wołać po EndMode3D.
+ */
+class WorldOverlay {
+public:
+  using Anchor = uint32_t;
+
+  struct Stats {
+    size_t anchors = 0;
+    size_t culled = 0;
+    size_t items = 0;
+    size_t quads = 0;
+  };
+
+  static WorldOverlay &getInstance() {
+    static WorldOverlay instance;
+    return instance;
+  }
+
+  /**
+   * Punkt zaczepienia; margin - o ile pikseli rzut może wyjść poza ekran,
+   * zanim elementy zostaną odrzucone; snap - rzut do całych pikseli (jak
+   * (int) przy DrawText), potrzebny pod napisami, żeby nie były rozmyte
+   */
+  Anchor anchor(Vector3 world, float margin = 0.0f, bool snap = false);
+
+  /** Prostokąt względem rzutu punktu (piksele) */
+  void rect(Anchor anchor, Rectangle offset, Color color);
+  /** Ramka jak DrawRectangleLinesEx */
+  void rectLines(Anchor anchor, Rectangle offset, float thickness,
+                 Color color);
+  /** Napis domyślnej czcionki (x, y - lewy górny róg względem rzutu) */
+  void text(Anchor anchor, const std::string &text, float x, float y,
+            int fontSize, Color color);
+  /** Pasek 40x6 wyśrodkowany na punkcie (dawny DrawHealthBar2D) */
+  void bar(Vector3 world, float progress, Color color);
+
+  /** Rzutuje punkty kamerą, rysuje widoczne elementy i czyści nakładkę */
+  void flush(const Camera3D &camera, int screenWidth, int screenHeight);
+  void clear();
+
+  const Stats &getStats() const { return m_stats; }
+
+private:
+  WorldOverlay() = default;
+
+  // Czworokąt względem rzutu punktu, UV znormalizowane
+  struct Quad {
+    float x0, y0, x1, y1;
+    float u0, v0, u1, v1;
+    Color color;
+    unsigned int texture; // atlas czcionki albo tekstura kształtów
+  };
+
+  void project(const Camera3D &camera, int screenWidth, int screenHeight);
+  void pushRect(Anchor anchor, Rectangle offset, Color color);
+
+  // Punkty zaczepienia w układzie SoA - wejście i wyjście rzutowania
+  std::vector<float> m_x, m_y, m_z, m_margin, m_snap;
+  std::vector<float> m_screenX, m_screenY;
+  std::vector<uint8_t> m_visible;
+
+  std::vector<Quad> m_quads;
+  std::vector<Anchor> m_quadAnchors;
+  size_t m_items = 0;
+  Stats m_stats; // ostatni flush()
+};
@@ -0,0 +1,764 @@
+// Symulacja bez okna: N ticków ze stałym krokiem, ziarno + plik scenariusza.
+// Raport: ticki/s oraz czas poszczególnych faz i systemów.
+//
+//   Simple3DGameHeadless --ticks 3600 --seed 42 --scenario resources/scenarios/default.txt
+//
+// Z RENDER_BENCH (cel Simple3DGameRenderBench, opcja CMake o tej samej
+// nazwie) po symulacji kolonia jest rysowana programowo (rlsw, bez GPU)
+// wzdłuż skryptowanych przelotów kamery: czasy klatek, statystyki rysowania
+// i zrzuty PNG co bench_dump_every klatek do --frames-dir.
+//
+//   Simple3DGameRenderBench --scenario resources/scenarios/default.txt --frames-dir frames
+//
+#include "../core/FixedTimestep.h"
+#include "../core/FrameArena.h"
+#include "../core/GameEngine.h"
+#include "../core/GameSystem.h"
+#include "../core/JobSystem.h"
+#include "../core/Logger.h"
+#include "../core/MainThreadQueue.h"
+#include "../core/Profiler.h"
+#include "../game/NavigationGrid.h"
+#include "../game/Player.h"
+#include "../game/CharacterLod.h"
+#include "../game/InstancedRenderer.h"
+#include "../game/RenderCulling.h"
+#include "../game/WorldManager.h"
+#include "../systems/BuildingSystem.h"
+#include "../systems/CraftingSystem.h"
+#include "../systems/InteractionSystem.h"
+#include "../systems/InventorySystem.h"
+#include "../systems/NeedsSystem.h"
+#include "../systems/StorageSystem.h"
+#include "../systems/TimeCycleSystem.h"
+#include "Colony.h"
+#include "Settler.h"
+#include "Terrain.h"
+#include "Tree.h"
+#include "WorldCommandBuffer.h"
+#include "raylib.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Globalne obiekty, do których odwołują się moduły gry (extern) - w wersji
+// okienkowej definiuje je src/main.cpp
+BuildingSystem *g_buildingSystem = nullptr;
+Colony *g_colony = nullptr;
+Camera3D sceneCamera = {};
+Settler *controlledSettler = nullptr;
+std::unique_ptr<Player> g_player;
+float globalTimeScale = 1.0f;
+Terrain terrain;
+Colony colony;
+
+namespace {
+
+/**
+ * @brief Parametry scenariusza (plik "klucz = wartość", # komentarz)
+ */
+struct Scenario {
+  int ticks = 3600;
+  unsigned int seed = 1;
+  int terrainSize = 100;
+  int settlers = 0; // dodatkowi osadnicy poza startowymi z Colony::initialize
+  int rabbits = 0;
+  int deer = 0;
+  int bushes = 0;
+  float spawnRadius = 40.0f;
+  float timeScale = 1.0f; // ticki na "klatkę" (aktualizacja siatki nawigacji)
+  int threads = 0;        // 0 = liczba rdzeni - 1
+  bool simLod = true;     // LOD symulacji wg odległości od (0, 0, 0)
+  bool parallelSystems = true; // systemy bez konfliktów równolegle
+  float worldWalkSpeed = 0.0f;  // m/s wzdłuż +x - test strumieniowania regionów
+  bool renderCull = false;      // krok cullingu z kamery gry, bez rysowania
+  std::vector<std::string> jobs = {"wood", "stone", "food", "build", "haul"};
+  // Przeloty kamery w Simple3DGameRenderBench
+  std::vector<std::string> benchPaths = {"orbit", "flyover", "street"};
+  int benchFrames = 120; // klatek na przelot
+  int benchWidth = 1280;
+  int benchHeight = 720;
+  int benchDumpEvery = 30; // co ile klatek zrzut PNG (0 = bez zrzutów)
+};
+
+std::string trim(const std::string &s) {
+  size_t b = s.find_first_not_of(" \t\r");
+  size_t e = s.find_last_not_of(" \t\r");
+  return b == std::string::npos ? std::string() : s.substr(b, e - b + 1);
+}
+
+bool applySetting(Scenario &scenario, const std::string &key,
+                  const std::string &value) {
+  if (key == "ticks")
+    scenario.ticks = std::atoi(value.c_str());
+  else if (key == "seed")
+    scenario.seed = static_cast<unsigned int>(std::strtoul(value.c_str(), nullptr, 10));
+  else if (key == "terrain_size")
+    scenario.terrainSize = std::atoi(value.c_str());
+  else if (key == "settlers")
+    scenario.settlers = std::atoi(value.c_str());
+  else if (key == "rabbits")
+    scenario.rabbits = std::atoi(value.c_str());
+  else if (key == "deer")
+    scenario.deer = std::atoi(value.c_str());
+  else if (key == "bushes")
+    scenario.bushes = std::atoi(value.c_str());
+  else if (key == "spawn_radius")
+    scenario.spawnRadius = static_cast<float>(std::atof(value.c_str()));
+  else if (key == "time_scale")
+    scenario.timeScale = static_cast<float>(std::atof(value.c_str()));
+  else if (key == "threads")
+    scenario.threads = std::atoi(value.c_str());
+  else if (key == "sim_lod")
+    scenario.simLod = std::atoi(value.c_str()) != 0;
+  else if (key == "parallel_systems")
+    scenario.parallelSystems = std::atoi(value.c_str()) != 0;
+  else if (key == "world_walk_speed")
+    scenario.worldWalkSpeed = static_cast<float>(std::atof(value.c_str()));
+  else if (key == "render_cull")
+    scenario.renderCull = std::atoi(value.c_str()) != 0;
+  else if (key == "bench_frames")
+    scenario.benchFrames = std::atoi(value.c_str());
+  else if (key == "bench_width")
+    scenario.benchWidth = std::atoi(value.c_str());
+  else if (key == "bench_height")
+    scenario.benchHeight = std::atoi(value.c_str());
+  else if (key == "bench_dump_every")
+    scenario.benchDumpEvery = std::atoi(value.c_str());
+  else if (key == "jobs" || key == "bench_paths") {
+    std::vector<std::string> &list =
+        key == "jobs" ? scenario.jobs : scenario.benchPaths;
+    list.clear();
+    std::stringstream ss(value);
+    std::string item;
+    while (std::getline(ss, item, ','))
+      list.push_back(trim(item));
+  } else
+    return false;
+  return true;
+}
+
+bool loadScenario(const std::string &path, Scenario &scenario) {
+  std::ifstream file(path);
+  if (!file.is_open()) {
+    std::cerr << "[Headless] Cannot open scenario: " << path << std::endl;
+    return false;
+  }
+
+  std::string line;
+  int lineNumber = 0;
+  while (std::getline(file, line)) {
+    ++lineNumber;
+    line = trim(line.substr(0, line.find('#')));
+    if (line.empty())
+      continue;
+
+    size_t eq = line.find('=');
+    if (eq == std::string::npos ||
+        !applySetting(scenario, trim(line.substr(0, eq)),
+                      trim(line.substr(eq + 1)))) {
+      std::cerr << "[Headless] " << path << ":" << lineNumber
+                << ": unknown setting '" << line << "'" << std::endl;
+    }
+  }
+  return true;
+}
+
+void printUsage() {
+#if defined(RENDER_BENCH)
+  std::cerr << "Usage: Simple3DGameRenderBench [--scenario file] [--ticks N] "
+               "[--seed S] [--threads N] [--check-access] [--verbose] "
+               "[--profile trace.json] [--frames-dir dir]"
+            << std::endl;
+#else
+  std::cerr << "Usage: Simple3DGameHeadless [--scenario file] [--ticks N] "
+               "[--seed S] [--threads N] [--check-access] [--verbose] "
+               "[--profile trace.json]"
+            << std::endl;
+#endif
+}
+
+bool hasJob(const Scenario &scenario, const char *job) {
+  return std::find(scenario.jobs.begin(), scenario.jobs.end(), job) !=
+         scenario.jobs.end();
+}
+
+void populate(const Scenario &scenario) {
+  auto randomPos = [&]() {
+    float angle = (float)GetRandomValue(0, 359) * DEG2RAD;
+    float dist = (float)GetRandomValue(0, (int)(scenario.spawnRadius * 10)) / 10.0f;
+    return Vector3{cosf(angle) * dist, 0.0f, sinf(angle) * dist};
+  };
+
+  for (int i = 0; i < scenario.settlers; ++i) {
+    size_t before = colony.getSettlers().size();
+    colony.addSettler(randomPos(), "Sim" + std::to_string(i),
+                      SettlerProfession::NONE);
+    if (colony.getSettlers().size() == before)
+      continue;
+    Settler *settler = colony.getSettlers().back();
+    settler->gatherWood = hasJob(scenario, "wood");
+    settler->gatherStone = hasJob(scenario, "stone");
+    settler->gatherFood = hasJob(scenario, "food");
+    settler->performBuilding = hasJob(scenario, "build");
+    settler->huntAnimals = hasJob(scenario, "hunt");
+    settler->haulToStorage = hasJob(scenario, "haul");
+  }
+  for (int i = 0; i < scenario.rabbits; ++i)
+    colony.addAnimal(randomPos(), AnimalType::RABBIT);
+  for (int i = 0; i < scenario.deer; ++i)
+    colony.addAnimal(randomPos(), AnimalType::DEER);
+  for (int i = 0; i < scenario.bushes; ++i)
+    colony.addBush(randomPos());
+}
+
+// Pochłania wyjście (std::cout bez --verbose)
+class NullBuffer : public std::streambuf {
+protected:
+  int overflow(int c) override { return c; }
+};
+
+using Clock = std::chrono::steady_clock;
+
+double elapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+struct PhaseTiming {
+  const char *name;
+  double totalMs = 0.0;
+  double maxMs = 0.0;
+
+  void add(double ms) {
+    totalMs += ms;
+    maxMs = std::max(maxMs, ms);
+  }
+};
+
+#if defined(RENDER_BENCH)
+/**
+ * @brief Kamera przelotu w chwili t (0..1). Ścieżki są funkcją numeru
+ * klatki, nie czasu - zrzuty z kolejnych przebiegów można porównywać.
+ */
+bool benchCamera(const std::string &path, float t, float worldRadius,
+                 Camera3D &camera) {
+  camera = {};
+  camera.up = Vector3{0.0f, 1.0f, 0.0f};
+  camera.fovy = 45.0f;
+  camera.projection = CAMERA_PERSPECTIVE;
+  if (path == "orbit") {
+    // Widok RTS krążący wokół środka kolonii
+    float angle = t * 2.0f * PI;
+    camera.position = Vector3{cosf(angle) * worldRadius, worldRadius * 0.6f,
+                              sinf(angle) * worldRadius};
+    camera.target = Vector3{0.0f, 0.0f, 0.0f};
+  } else if (path == "flyover") {
+    // Wysoki przelot nad całą mapą - dużo obiektów, postacie jako znaczniki
+    float x = -worldRadius + 2.0f * worldRadius * t;
+    camera.position = Vector3{x, 60.0f, -worldRadius * 0.5f};
+    camera.target = Vector3{x + 20.0f, 0.0f, 0.0f};
+  } else if (path == "street") {
+    // Na wysokości oczu przez środek - pełne modele postaci i budynków
+    float x = -worldRadius * 0.5f + worldRadius * t;
+    camera.position = Vector3{x, 1.7f, 2.0f};
+    camera.target = Vector3{x + 10.0f, 1.5f, 0.0f};
+  } else {
+    return false;
+  }
+  return true;
+}
+
+// Scena 3D jak w renderScene() z src/main.cpp (bez UI i edytora)
+void renderBenchFrame(const Camera3D &camera) {
+  float aspect = (float)GetScreenWidth() / (float)GetScreenHeight();
+  {
+    PROFILE_ZONE("Culling");
+    CharacterLod::getInstance().beginFrame(camera, (float)GetScreenHeight());
+    RenderCulling &culling = RenderCulling::getInstance();
+    culling.gather(colony, terrain, g_buildingSystem);
+    culling.cull(Frustum::FromCamera(camera, aspect,
+                                     (float)rlGetCullDistanceNear(),
+                                     (float)rlGetCullDistanceFar()));
+  }
+  BeginDrawing();
+  ClearBackground(RAYWHITE);
+  BeginMode3D(camera);
+  {
+    PROFILE_ZONE("Terrain::render");
+    terrain.render();
+  }
+  {
+    PROFILE_ZONE("Colony::render");
+    colony.render();
+  }
+  {
+    PROFILE_ZONE("BuildingSystem::render");
+    g_buildingSystem->render();
+  }
+  EndMode3D();
+  PROFILE_ZONE("EndDrawing");
+  EndDrawing();
+}
+
+void runRenderBench(const Scenario &scenario, const std::string &framesDir) {
+  // Siatka terenu i inne uploady czekają w kolejce wątku głównego
+  MainThreadQueue::getInstance().flush();
+  if (!framesDir.empty() && !DirectoryExists(framesDir.c_str()) &&
+      MakeDirectory(framesDir.c_str()) != 0) {
+    std::fprintf(stderr, "[RenderBench] Cannot create %s\n", framesDir.c_str());
+  }
+
+  const float worldRadius = scenario.terrainSize * 0.45f;
+  const int frames = std::max(scenario.benchFrames, 1);
+  RenderCulling &culling = RenderCulling::getInstance();
+  CharacterLod &characterLod = CharacterLod::getInstance();
+  BuildingChunkMeshes &chunks = g_buildingSystem->getChunkMeshes();
+
+  std::printf("[RenderBench] rlsw %dx%d, %d frames per path\n", GetScreenWidth(),
+              GetScreenHeight(), frames);
+  std::printf("[RenderBench] %-10s %9s %9s %9s %9s %10s %8s %20s %7s\n", "Path",
+              "avg ms", "p50 ms", "p95 ms", "max ms", "drawn/fr", "chunks",
+              "full/proxy/marker", "dumps");
+  for (const std::string &path : scenario.benchPaths) {
+    Camera3D camera;
+    if (!benchCamera(path, 0.0f, worldRadius, camera)) {
+      std::fprintf(stderr, "[RenderBench] Unknown path '%s' (orbit, flyover, street)\n",
+                   path.c_str());
+      continue;
+    }
+
+    std::vector<double> frameMs;
+    frameMs.reserve(frames);
+    size_t drawn = 0, chunksDrawn = 0, dumps = 0;
+    CharacterLod::Stats lodTotals;
+    for (int frame = 0; frame < frames; ++frame) {
+      float t = frames > 1 ? (float)frame / (float)(frames - 1) : 0.0f;
+      benchCamera(path, t, worldRadius, camera);
+
+      Profiler::beginFrame();
+      auto start = Clock::now();
+      renderBenchFrame(camera);
+      frameMs.push_back(elapsedMs(start));
+      Profiler::endFrame();
+
+      drawn += culling.getStats().drawn;
+      chunksDrawn += chunks.getStats().chunksDrawn;
+      lodTotals.full += characterLod.getStats().full;
+      lodTotals.proxy += characterLod.getStats().proxy;
+      lodTotals.marker += characterLod.getStats().marker;
+
+      // Zrzut poza pomiarem czasu klatki
+      if (!framesDir.empty() && scenario.benchDumpEvery > 0 &&
+          frame % scenario.benchDumpEvery == 0) {
+        Image image = LoadImageFromScreen();
+        // rlReadScreenPixels odwraca wiersze jak dla GL, a rlsw zwraca je od góry
+        ImageFlipVertical(&image);
+        std::string file = framesDir + "/" + path + "_" +
+                           std::to_string(frame) + ".png";
+        if (ExportImage(image, file.c_str()))
+          dumps++;
+        UnloadImage(image);
+      }
+      FrameArena::resetAll();
+    }
+
+    std::vector<double> sorted = frameMs;
+    std::sort(sorted.begin(), sorted.end());
+    double total = 0.0;
+    for (double ms : sorted)
+      total += ms;
+    auto percentile = [&](double p) {
+      return sorted[std::min(sorted.size() - 1, (size_t)(p * sorted.size()))];
+    };
+    double n = (double)frames;
+    char lod[32];
+    std::snprintf(lod, sizeof(lod), "%.0f/%.0f/%.0f", lodTotals.full / n,
+                  lodTotals.proxy / n, lodTotals.marker / n);
+    std::printf("[RenderBench] %-10s %9.3f %9.3f %9.3f %9.3f %10.1f %8.1f %20s %7zu\n",
+                path.c_str(), total / n, percentile(0.5), percentile(0.95),
+                sorted.back(), drawn / n, chunksDrawn / n, lod, dumps);
+  }
+}
+#endif
+
+} // namespace
+
+int main(int argc, char **argv) {
+  Scenario scenario;
+  bool verbose = false;
+  bool checkAccess = false;
+  int ticksOverride = -1;
+  long long seedOverride = -1;
+  int threadsOverride = -1;
+  std::string profilePath;
+#if defined(RENDER_BENCH)
+  std::string framesDir;
+#endif
+
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (arg == "--scenario" && hasValue) {
+      if (!loadScenario(argv[++i], scenario))
+        return 1;
+    } else if (arg == "--ticks" && hasValue) {
+      ticksOverride = std::atoi(argv[++i]);
+    } else if (arg == "--seed" && hasValue) {
+      seedOverride = std::atoll(argv[++i]);
+    } else if (arg == "--threads" && hasValue) {
+      threadsOverride = std::atoi(argv[++i]);
+    } else if (arg == "--check-access") {
+      checkAccess = true;
+    } else if (arg == "--verbose") {
+      verbose = true;
+    } else if (arg == "--profile" && hasValue) {
+      profilePath = argv[++i];
+#if defined(RENDER_BENCH)
+    } else if (arg == "--frames-dir" && hasValue) {
+      framesDir = argv[++i];
+#endif
+    } else {
+      printUsage();
+      return 1;
+    }
+  }
+  // Argumenty linii poleceń mają pierwszeństwo przed plikiem scenariusza
+  if (ticksOverride >= 0)
+    scenario.ticks = ticksOverride;
+  if (seedOverride >= 0)
+    scenario.seed = static_cast<unsigned int>(seedOverride);
+  if (threadsOverride >= 0)
+    scenario.threads = threadsOverride;
+
+  // Logi gry są bardzo gęste - bez --verbose nie mierzymy czasu konsoli
+  NullBuffer discarded;
+  std::streambuf *coutBuffer = std::cout.rdbuf();
+  if (!verbose) {
+    std::cout.rdbuf(&discarded);
+    SetTraceLogLevel(LOG_NONE);
+    Logger::setConsoleOutput(false);
+  }
+
+#if defined(RENDER_BENCH)
+  // Bufor rlsw przed światem (upload siatek) i przed ziarnem - InitWindow
+  // losuje własne ziarno
+  InitWindow(scenario.benchWidth, scenario.benchHeight, "Simple3DGameRenderBench");
+#endif
+
+  std::srand(scenario.seed);
+  SetRandomSeed(scenario.seed);
+
+  GameEngine &engine = GameEngine::getInstance();
+  // Bufor rlsw (RENDER_BENCH) to pełny kontekst - siatki terenu i modele
+  engine.setHeadless(!IsWindowReady());
+  Profiler::setThreadName("Main");
+
+  // Te same systemy co w grze, bez UISystem (tylko rysowanie)
+  auto buildingSystem = std::make_unique<BuildingSystem>();
+  auto interactionSystem = std::make_unique<InteractionSystem>();
+  auto timeSystem = std::make_unique<TimeCycleSystem>();
+  auto craftingSystem = std::make_unique<CraftingSystem>();
+  g_buildingSystem = buildingSystem.get();
+  InteractionSystem *interaction = interactionSystem.get();
+  TimeCycleSystem *timeCycle = timeSystem.get();
+  engine.registerSystem(std::move(buildingSystem));
+  engine.registerSystem(std::move(interactionSystem));
+  engine.registerSystem(std::move(timeSystem));
+  engine.registerSystem(std::make_unique<InventorySystem>());
+  engine.registerSystem(std::make_unique<StorageSystem>());
+  engine.registerSystem(std::make_unique<NeedsSystem>());
+  engine.registerSystem(std::move(craftingSystem));
+
+  NavigationGrid navigationGrid(scenario.terrainSize, scenario.terrainSize, 1.0f);
+  engine.registerTerrain(&terrain);
+  terrain.setSeed(scenario.seed);
+  terrain.generate(scenario.terrainSize, scenario.terrainSize, 1.0f);
+  GameSystem::setNavigationGrid(&navigationGrid);
+  GameSystem::setColony(&colony);
+  GameSystem::setTerrain(&terrain);
+  colony.initialize();
+  g_colony = &colony;
+  GameEngine::dropItemCallback = [](Vector3 position, Item *item, int quantity) {
+    WorldCommandBuffer::dropItem(position, std::unique_ptr<Item>(item),
+                                 quantity);
+  };
+  interaction->setColony(&colony);
+
+  engine.initialize();
+  JobSystem::getInstance().initialize(
+      static_cast<unsigned>(std::max(scenario.threads, 0)));
+  WorldManager::GetInstance()->SetWorldSeed(scenario.seed);
+  WorldManager::GetInstance()->Initialize();
+  populate(scenario);
+
+  engine.setSystemTimingEnabled(true);
+  engine.resetSystemTimings();
+  engine.setParallelSystemsEnabled(scenario.parallelSystems);
+  engine.setAccessCheckEnabled(checkAccess);
+
+  PhaseTiming colonyTiming{"Colony"};
+  PhaseTiming worldTiming{"WorldManager"};
+  PhaseTiming navigationTiming{"NavigationGrid"};
+  PhaseTiming engineTiming{"GameEngine (all systems)"};
+
+  FixedTimestep simClock;
+  const float step = simClock.getStep();
+  const int ticksPerFrame = std::max(1, (int)(scenario.timeScale + 0.5f));
+
+  // Obserwator w miejscu, które dostaje też WorldManager
+  colony.getSimulationLOD().getConfig().enabled = scenario.simLod;
+  colony.getSimulationLOD().setViewer(Vector3{0.0f, 0.0f, 0.0f});
+  SimulationLOD::Stats lodTotals;
+
+  // Kamera jak w grze (widok z góry za obserwatorem), 16:9
+  RenderCulling &culling = RenderCulling::getInstance();
+  culling.getConfig().enabled = scenario.renderCull;
+  RenderCulling::Stats cullTotals;
+  CharacterLod::Stats characterLodTotals;
+  size_t cullFrames = 0;
+  double cullMs = 0.0;
+
+  size_t aiGranted = 0;
+  size_t aiDeferred = 0;
+  size_t aiMaxWaiting = 0;
+
+  // Profil ostatnich klatek ("klatka" = ticksPerFrame ticków, jak w grze)
+  const size_t profileFrames = 600;
+  if (!profilePath.empty()) {
+    Profiler::setFrameCapacity(profileFrames);
+    Profiler::setEnabled(true);
+  }
+
+  auto runStart = Clock::now();
+  for (int tick = 0; tick < scenario.ticks; ++tick) {
+    if (tick % ticksPerFrame == 0)
+      Profiler::beginFrame();
+    auto phaseStart = Clock::now();
+    float gameTime = timeCycle->getCurrentTime();
+    colony.update(step, gameTime, terrain.getTrees(),
+                  g_buildingSystem->getAllBuildings());
+    colonyTiming.add(elapsedMs(phaseStart));
+
+    const AIScheduler::Stats &aiStats = colony.getAIScheduler().getStats();
+    aiGranted += aiStats.granted;
+    aiDeferred += aiStats.deferred;
+    aiMaxWaiting = std::max(aiMaxWaiting, aiStats.candidates);
+
+    const SimulationLOD::Stats &lodStats = colony.getSimulationLOD().getStats();
+    lodTotals.full += lodStats.full;
+    lodTotals.reduced += lodStats.reduced;
+    lodTotals.macro += lodStats.macro;
+    lodTotals.updated += lodStats.updated;
+
+    phaseStart = Clock::now();
+    Vector3 walker{scenario.worldWalkSpeed * step * (tick + 1), 0.0f, 0.0f};
+    // Obserwator porusza się co tick, więc i prędkość próbkowana co tick
+    WorldManager::GetInstance()->UpdatePlayerVelocity(step, walker);
+    WorldManager::GetInstance()->Update(step, walker);
+    worldTiming.add(elapsedMs(phaseStart));
+
+    phaseStart = Clock::now();
+    engine.update(step);
+    engineTiming.add(elapsedMs(phaseStart));
+
+    // Jak w grze: siatka nawigacji i arena raz na "klatkę"
+    if ((tick + 1) % ticksPerFrame == 0 || tick + 1 == scenario.ticks) {
+      phaseStart = Clock::now();
+      auto buildings = g_buildingSystem->getAllBuildings();
+      FrameVector<Tree *> treePtrs;
+      const auto &treesRef = terrain.getTrees();
+      treePtrs.reserve(treesRef.size());
+      for (const auto &treePtr : treesRef) {
+        treePtrs.push_back(treePtr.get());
+      }
+      navigationGrid.UpdateGrid(buildings, treePtrs, terrain.getResourceNodes());
+      navigationTiming.add(elapsedMs(phaseStart));
+
+      if (scenario.renderCull) {
+        phaseStart = Clock::now();
+        Camera3D camera = {};
+        camera.target = walker;
+        camera.position = Vector3Add(walker, Vector3{0.0f, 25.0f, 30.0f});
+        camera.up = Vector3{0.0f, 1.0f, 0.0f};
+        camera.fovy = 45.0f;
+        camera.projection = CAMERA_PERSPECTIVE;
+        culling.gather(colony, terrain, g_buildingSystem);
+        culling.cull(Frustum::FromCamera(camera, 16.0f / 9.0f, 0.05f, 4000.0f));
+        cullMs += elapsedMs(phaseStart);
+        const RenderCulling::Stats &cullStats = culling.getStats();
+        cullTotals.tested += cullStats.tested;
+        cullTotals.culled += cullStats.culled;
+        cullTotals.drawn += cullStats.drawn;
+        cullTotals.boxTests += cullStats.boxTests;
+        cullTotals.cells += cullStats.cells;
+        cullTotals.cellsCulled += cullStats.cellsCulled;
+        cullTotals.boundsRebuilt += cullStats.boundsRebuilt;
+
+        // Poziomy LOD postaci jak w Colony::render (ekran 1080 px)
+        CharacterLod &characterLod = CharacterLod::getInstance();
+        characterLod.beginFrame(camera, 1080.0f);
+        for (Settler *settler : colony.getSettlers()) {
+          if (culling.isVisible(settler))
+            characterLod.choose(settler->getRenderPosition(),
+                                CharacterLod::settlerHeight());
+        }
+        for (const auto &animal : colony.getAnimals()) {
+          if (animal->isActive() && culling.isVisible(animal.get()))
+            characterLod.choose(animal->getRenderPosition(),
+                                CharacterLod::animalHeight(*animal));
+        }
+        characterLodTotals.full += characterLod.getStats().full;
+        characterLodTotals.proxy += characterLod.getStats().proxy;
+        characterLodTotals.marker += characterLod.getStats().marker;
+        cullFrames++;
+      }
+
+      FrameArena::resetAll();
+      Profiler::endFrame();
+    }
+  }
+  double totalMs = elapsedMs(runStart);
+
+  std::cout.rdbuf(coutBuffer);
+
+  int ticks = std::max(scenario.ticks, 1);
+  double seconds = totalMs / 1000.0;
+  double simSeconds = scenario.ticks * step;
+  std::printf("[Headless] seed=%u settlers=%zu animals=%zu trees=%zu threads=%zu\n",
+              scenario.seed, colony.getSettlers().size(),
+              colony.getAnimals().size(), terrain.getTrees().size(),
+              JobSystem::getInstance().getWorkerCount());
+  std::printf("[Headless] %d ticks in %.3f s -> %.1f ticks/s (%.1f sim-s, %.1fx realtime)\n",
+              scenario.ticks, seconds, seconds > 0.0 ? scenario.ticks / seconds : 0.0,
+              simSeconds, seconds > 0.0 ? simSeconds / seconds : 0.0);
+
+  std::printf("[Headless] %-28s %12s %12s %10s\n", "Phase / system", "avg ms/tick",
+              "max ms", "share");
+  auto printRow = [&](const std::string &name, double total, double max) {
+    std::printf("[Headless] %-28s %12.4f %12.4f %9.1f%%\n", name.c_str(),
+                total / ticks, max, totalMs > 0.0 ? 100.0 * total / totalMs : 0.0);
+  };
+  for (const PhaseTiming *phase :
+       {&colonyTiming, &worldTiming, &navigationTiming, &engineTiming}) {
+    printRow(phase->name, phase->totalMs, phase->maxMs);
+  }
+  for (const auto &timing : engine.getSystemTimings()) {
+    printRow("  " + timing.name, timing.totalMs, timing.maxMs);
+  }
+  std::printf("[Headless] AI decisions: %.2f granted/tick, %.2f deferred/tick, "
+              "max waiting %zu, avg %.4f ms\n",
+              (double)aiGranted / ticks, (double)aiDeferred / ticks,
+              aiMaxWaiting, colony.getAIScheduler().getStats().avgDecisionMs);
+  std::printf("[Headless] Sim LOD %s: %.1f full, %.1f reduced, %.1f macro, "
+              "%.1f updated per tick\n",
+              scenario.simLod ? "on" : "off", (double)lodTotals.full / ticks,
+              (double)lodTotals.reduced / ticks, (double)lodTotals.macro / ticks,
+              (double)lodTotals.updated / ticks);
+
+  std::printf("[Headless] Systems %s:\n",
+              scenario.parallelSystems ? "parallel" : "serial");
+  for (const std::string &line : engine.describeSchedule()) {
+    std::printf("[Headless]   %s\n", line.c_str());
+  }
+  if (checkAccess) {
+    std::printf("[Headless] Undeclared system accesses: %zu\n",
+                SystemAccess::getViolationCount());
+  }
+  WorldCommandBuffer::Stats commandStats = WorldCommandBuffer::getStats();
+  std::printf("[Headless] World commands: %zu recorded, %zu applied, %zu failed, "
+              "peak %zu per playback\n",
+              commandStats.recorded, commandStats.applied, commandStats.failed,
+              commandStats.peakPlayback);
+  const WorldManager::StreamingStats &streaming =
+      WorldManager::GetInstance()->GetStreamingStats();
+  std::printf("[Headless] Region streaming: %zu generated, %zu prefetch hits, "
+              "%zu misses, %zu deferred activations, %zu regions active\n",
+              streaming.completed, streaming.prefetchHits,
+              streaming.prefetchMisses, streaming.deferredActivations,
+              WorldManager::GetInstance()->GetActiveRegions().size());
+  if (cullFrames > 0) {
+    double frames = (double)cullFrames;
+    std::printf("[Headless] Render culling: %.1f tested, %.1f culled, %.1f drawn "
+                "per frame (%.1f/%.1f cells culled, %.1f box tests, %.1f AABB "
+                "rebuilds), avg %.4f ms\n",
+                cullTotals.tested / frames, cullTotals.culled / frames,
+                cullTotals.drawn / frames, cullTotals.cellsCulled / frames,
+                cullTotals.cells / frames, cullTotals.boxTests / frames,
+                cullTotals.boundsRebuilt / frames, cullMs / frames);
+    std::printf("[Headless] Character LOD: %.1f full, %.1f proxy, %.1f marker "
+                "per frame\n",
+                characterLodTotals.full / frames,
+                characterLodTotals.proxy / frames,
+                characterLodTotals.marker / frames);
+  }
+  if (!profilePath.empty()) {
+    Profiler::setEnabled(false);
+    std::printf("[Headless] Profile (avg ms per frame, last %zu frames):\n",
+                Profiler::getFrameCount());
+    for (const Profiler::ZoneSummary &zone : Profiler::summarize(profileFrames)) {
+      if (zone.depth > 3)
+        continue;
+      std::printf("[Headless]   T%-2u %*s%-*s %9.4f ms x%.1f (max %.3f)\n",
+                  zone.thread, zone.depth * 2, "", 40 - zone.depth * 2,
+                  zone.name, zone.totalMs, zone.calls, zone.maxMs);
+    }
+    if (Profiler::exportChromeTrace(profilePath))
+      std::printf("[Headless] Chrome trace written to %s\n", profilePath.c_str());
+    else
+      std::fprintf(stderr, "[Headless] Cannot write %s\n", profilePath.c_str());
+  }
+  Logger::flush();
+  Logger::Stats logStats = Logger::getStats();
+  std::printf("[Headless] Logger: %llu queued, %llu written, %llu rate-limited, "
+              "%llu dropped\n",
+              (unsigned long long)logStats.queued,
+              (unsigned long long)logStats.written,
+              (unsigned long long)logStats.suppressed,
+              (unsigned long long)logStats.dropped);
+  EventBus::QueueStats eventStats = EventBus::getQueueStats();
+  std::printf("[Headless] Events: %llu queued, %llu dispatched, peak %zu, "
+              "overflow %llu, carried over %llu\n",
+              (unsigned long long)eventStats.enqueued,
+              (unsigned long long)eventStats.dispatched, eventStats.peakDepth,
+              (unsigned long long)eventStats.overflowed,
+              (unsigned long long)eventStats.carriedOver);
+
+#if defined(RENDER_BENCH)
+  if (!verbose)
+    std::cout.rdbuf(&discarded);
+  if (!profilePath.empty()) {
+    Profiler::clear(); // drugi trace tylko z klatkami przelotów
+    Profiler::setEnabled(true);
+  }
+  runRenderBench(scenario, framesDir);
+  std::cout.rdbuf(coutBuffer);
+  if (!profilePath.empty()) {
+    Profiler::setEnabled(false);
+    std::string renderTrace = profilePath + ".render.json";
+    if (Profiler::exportChromeTrace(renderTrace))
+      std::printf("[RenderBench] Chrome trace written to %s\n", renderTrace.c_str());
+  }
+#endif
+
+  if (!verbose)
+    std::cout.rdbuf(&discarded);
+  WorldManager::GetInstance()->Shutdown();
+  engine.shutdown();
+  JobSystem::getInstance().shutdown();
+#if defined(RENDER_BENCH)
+  InstancedRenderer::getInstance().unload();
+  CloseWindow();
+#endif
+  Logger::shutdown();
+  std::cout.rdbuf(coutBuffer);
+  return 0;
+}
@@ -1,12 +1,23 @@
 #include "../components/StatsComponent.h"
+#include "../core/FixedTimestep.h"
+#include "../core/FrameArena.h"
 #include "../core/GameEngine.h"
 #include "../core/GameSystem.h"
 #include "../core/IGameSystem.h"
+#include "../core/JobSystem.h"
+#include "../core/Logger.h"
+#include "../core/MainThreadQueue.h"
+#include "../core/Profiler.h"
+#include "../core/RenderStats.h"
 #include "../game/BuildingBlueprint.h"
 #include "../game/DebugConsole.h"
+#include "../game/CharacterLod.h"
+#include "../game/InstancedRenderer.h"
 #include "../game/Item.h"
 #include "../game/NavigationGrid.h"
 #include "../game/Player.h"
+#include "../game/RenderCulling.h"
+#include "../game/WorldOverlay.h"
 #include "../game/WorldManager.h"
 #include "../systems/BuildingSystem.h"
 #include "../systems/CraftingSystem.h"
@@ -21,6 +32,7 @@
 #include "EventBusValidator.h" // VALIDATION INCLUDE
 #include "Terrain.h"
 #include "Tree.h"
+#include "WorldCommandBuffer.h"
 #include "raylib.h"
 #include "raymath.h"
 #include <algorithm>
@@ -310,24 +322,6 @@ Vector3 GetMouseWorldPosition(Camera3D camera) {
   return ray.position;
 }
 
-// 2D Health Bar Helper
-static void DrawHealthBar2D(Vector3 worldPos, float progress, Color color) {
-  Vector2 screenPos = GetWorldToScreen(worldPos, sceneCamera);
-  if (screenPos.x < 0 || screenPos.x > GetScreenWidth() || screenPos.y < 0 ||
-      screenPos.y > GetScreenHeight())
-    return;
-
-  float width = 40.0f;
-  float height = 6.0f;
-  Rectangle bg = {screenPos.x - width / 2, screenPos.y - height / 2, width,
-                  height};
-  Rectangle fg = {screenPos.x - width / 2, screenPos.y - height / 2,
-                  width * progress, height};
-
-  DrawRectangleRec(bg, BLACK);
-  DrawRectangleRec(fg, color);
-  DrawRectangleLinesEx(bg, 1.0f, DARKGRAY);
-}
 void renderScene() {
   Camera3D currentCam = sceneCamera;
 
@@ -343,7 +337,7 @@ void renderScene() {
   float top = 0.01f * tanf(fovy * 0.5f * DEG2RAD); // Near=0.01
   float right = top * aspect;
 
-  rlDrawRenderBatchActive(); // Flush previous batch
+  RenderStats::flushBatch(); // Flush previous batch
   rlMatrixMode(RL_PROJECTION);
   rlPushMatrix();
   rlLoadIdentity();
@@ -351,12 +345,34 @@ void renderScene() {
   rlMatrixMode(RL_MODELVIEW);
   rlLoadIdentity();
 
+  // Zbiór widocznych obiektów - ten sam rzut co w BeginMode3D
+  {
+    PROFILE_ZONE("Culling");
+    InstancedRenderer::getInstance().beginFrame();
+    CharacterLod::getInstance().beginFrame(currentCam,
+                                           (float)GetScreenHeight());
+    RenderCulling &culling = RenderCulling::getInstance();
+    culling.gather(colony, terrain, g_buildingSystem);
+    culling.cull(Frustum::FromCamera(currentCam, aspect,
+                                     (float)rlGetCullDistanceNear(),
+                                     (float)rlGetCullDistanceFar()));
+  }
+
   BeginMode3D(currentCam);
-  terrain.render();
-  colony.render(currentCameraMode == CameraViewMode::FPS, controlledSettler);
+  RenderStats::setPass(RenderPass::Scene);
+  {
+    RenderPassScope pass(RenderPass::Terrain);
+    terrain.render();
+  }
+  {
+    RenderPassScope pass(RenderPass::Colony);
+    colony.render(currentCameraMode == CameraViewMode::FPS, controlledSettler);
+  }
   const std::vector<WorldItem> &droppedItems = colony.getDroppedItems();
+  const RenderCulling &culling = RenderCulling::getInstance();
   for (const auto &wItem : droppedItems) {
-    if (wItem.item && !wItem.pendingRemoval) {
+    if (wItem.item && !wItem.pendingRemoval &&
+        culling.isVisible(wItem.item.get())) {
       Vector3 itemPos = wItem.position;
       itemPos.y += 0.25f; // Lift from ground
 
@@ -399,14 +415,15 @@ void renderScene() {
     }
   }
 
-  if (isBuildingMode && g_buildingSystem) {
-    Vector3 mousePos = GetMouseWorldPosition(currentCam);
-    g_buildingSystem->renderPreview(selectedBlueprintId, mousePos,
-                                    currentBuildingRotation);
-  }
-
-  if (g_buildingSystem)
+  if (g_buildingSystem) {
+    RenderPassScope pass(RenderPass::Buildings);
+    if (isBuildingMode) {
+      Vector3 mousePos = GetMouseWorldPosition(currentCam);
+      g_buildingSystem->renderPreview(selectedBlueprintId, mousePos,
+                                      currentBuildingRotation);
+    }
     g_buildingSystem->render();
+  }
   if (g_interactionSystem)
     g_interactionSystem->render();
   if (hasCommandTarget)
@@ -422,34 +439,40 @@ void renderScene() {
   g_editorSystem.Render3D(sceneCamera);
 
   EndMode3D();
+  // Od tu do EndDrawing wszystko jest 2D (paski, UI, konsola)
+  RenderStats::setPass(RenderPass::UI);
 
-  // Health Bars 2D for World Objects
+  // Health Bars 2D for World Objects - zbierane do WorldOverlay i
+  // rysowane jednym wsadem
+  WorldOverlay &overlay = WorldOverlay::getInstance();
   // 1. Trees
   const auto &trees = terrain.getTrees();
   for (const auto &tree : trees) {
-    if (tree->isActive() && !tree->isStump()) {
+    if (tree->isActive() && !tree->isStump() &&
+        culling.isVisible(tree.get())) {
       auto stats = tree->getComponent<StatsComponent>();
       if (stats && stats->getCurrentHealth() < stats->getMaxHealth()) {
         Vector3 barPos = tree->getPosition();
         barPos.y += 4.5f; // Above foliage
-        DrawHealthBar2D(
-            barPos, stats->getCurrentHealth() / stats->getMaxHealth(), GREEN);
+        overlay.bar(barPos, stats->getCurrentHealth() / stats->getMaxHealth(),
+                    GREEN);
       }
     }
   }
   // 2. Resource Nodes
   const auto &nodes = terrain.getResourceNodes();
   for (const auto &node : nodes) {
-    if (node->isActive()) {
+    if (node->isActive() && culling.isVisible(node.get())) {
       float progress =
           (float)node->getCurrentAmount() / (float)node->getMaxAmount();
       if (progress < 1.0f) {
         Vector3 barPos = node->getPosition();
         barPos.y += 1.5f;
-        DrawHealthBar2D(barPos, progress, ORANGE);
+        overlay.bar(barPos, progress, ORANGE);
       }
     }
   }
+  overlay.flush(sceneCamera, GetScreenWidth(), GetScreenHeight());
 
   // 3. Building Tasks Labels - REMOVED to avoid clutter with modular buildings
   /*
@@ -668,6 +691,12 @@ void processInput() {
       std::cout << "[TIME] Global time scale set to " << globalTimeScale
                 << " (4x speed)" << std::endl;
     }
+    if (IsKeyPressed(KEY_FOUR)) {
+      globalTimeScale = 10.0f;
+      g_timeSystem->setTimeScale(globalTimeScale * 100.0f);
+      std::cout << "[TIME] Global time scale set to " << globalTimeScale
+                << " (10x speed)" << std::endl;
+    }
   }
 
   // [EDITOR] Update Editor System
@@ -897,6 +926,8 @@ void processInput() {
         float minDist = 2.0f; // Pickup range
 
         for (size_t i = 0; i < dropped.size(); ++i) {
+          if (!dropped[i].item || dropped[i].pendingRemoval)
+            continue;
           float d = Vector3Distance(controlledSettler->getPosition(),
                                     dropped[i].position);
           if (d < minDist) {
@@ -906,24 +937,11 @@ void processInput() {
         }
 
         if (bestIdx != -1) {
-          // Pickup!
-          int amount =
-              dropped[bestIdx].amount; // Capture quantity before taking
-          std::unique_ptr<Item> item = colony.takeDroppedItem(bestIdx);
-          if (item) {
-            std::cout << "[Player] Picked up: " << item->getDisplayName()
-                      << " x" << amount << std::endl;
-
-            // Auto-equip if hands empty
-            if (controlledSettler->getHeldItem() == nullptr) {
-              std::cout << "[Player] Auto-equipped: " << item->getDisplayName()
-                        << std::endl;
-              controlledSettler->setHeldItem(std::move(item));
-            } else {
-              controlledSettler->getInventory().addItem(std::move(item),
-                                                        amount);
-            }
-          }
+          // Pickup! Przeniesienie do ekwipunku (auto-equip przy pustych
+          // rękach) wykona Colony w punkcie synchronizacji ticka
+          WorldCommandBuffer::moveToInventory(
+              (size_t)bestIdx, dropped[bestIdx].item.get(), controlledSettler,
+              true);
         }
       }
 
@@ -971,7 +989,7 @@ void processInput() {
             auto buildings =
                 g_buildingSystem->getBuildingsInRange(testPos, 10.0f);
             for (auto *b : buildings) {
-              if (b->getBlueprintId() == "floor")
+              if (b->getBlueprintSid() == Ids::Floor)
                 continue;
               if (b->CheckCollision(testPos, 0.4f)) {
                 return false;
@@ -1022,6 +1040,7 @@ int main() {
 
   InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Simple 3D Game");
   SetTargetFPS(60);
+  RenderStats::install();
   // Initialize cameras
   sceneCamera = {};
   sceneCamera.position = Vector3{10.0f, 10.0f, 10.0f};
@@ -1038,6 +1057,12 @@ int main() {
   // Create camera controllers
   freeCameraController = new CameraController(&sceneCamera);
   settlerCameraController = new CameraController(&settlerCamera);
+  // Wątek główny = wątek 0 w profilerze i w Chrome trace
+  Profiler::setThreadName("Main");
+  // Wątki robocze przed generowaniem świata - teren liczy się w tle,
+  // a w tym czasie rejestrujemy systemy
+  JobSystem::getInstance().initialize();
+  terrain.beginGenerate(100, 100, 1.0f);
   // Initialize GameEngine
   GameEngine &engine = GameEngine::getInstance();
   // Create and register systems
@@ -1066,7 +1091,7 @@ int main() {
   engine.registerSystem(std::move(craftingSystem));
   // Terrain & colony
   engine.registerTerrain(&terrain);
-  terrain.generate(100, 100, 1.0f);
+  terrain.finishGenerate();
   // Set static references for GameSystem
   GameSystem::setNavigationGrid(&navigationGrid);
   GameSystem::setColony(&colony);
@@ -1076,7 +1101,8 @@ int main() {
   // Set drop item callback for trees
   GameEngine::dropItemCallback = [](Vector3 position, Item *item,
                                     int quantity) {
-    colony.addDroppedItem(std::unique_ptr<Item>(item), position, quantity);
+    WorldCommandBuffer::dropItem(position, std::unique_ptr<Item>(item),
+                                 quantity);
     std::cout << "[GameEngine] Dropped item at (" << position.x << ", "
               << position.y << ", " << position.z << ") x" << quantity
               << std::endl;
@@ -1097,16 +1123,26 @@ int main() {
   // [WORLD MANAGER] Initialize
   WorldManager::GetInstance()->Initialize();
 
+  // Uploady z ładowania (teren, region startowy) przed pierwszą klatką
+  MainThreadQueue::getInstance().flush();
+
   // [EVENT BUS] Validation
   EventBusValidator eventValidator;
   eventValidator.Initialize();
   eventValidator.TriggerTest();
 
-  // Main loop
+  // Stały krok symulacji - przyspieszenie czasu = więcej ticków na klatkę
+  FixedTimestep simClock;
+
   // Main loop
   while (!WindowShouldClose()) {
+    Profiler::beginFrame();
+    RenderStats::beginFrame();
     deltaTime = GetFrameTime();
-    processInput();
+    {
+      PROFILE_ZONE("Input");
+      processInput();
+    }
 
     // [ANTIGRAVITY FIX] Update Player Logic
     if (g_player && currentCameraMode == CameraViewMode::FPS) {
@@ -1117,17 +1153,40 @@ int main() {
 
     UpdateCameraSystem(deltaTime);
     terrain.update(deltaTime);
-    float scaledDeltaTime = deltaTime * globalTimeScale;
-    float gameTime = g_timeSystem ? g_timeSystem->getCurrentTime() : 0.0f;
-    colony.update(scaledDeltaTime, gameTime, terrain.getTrees(),
-                  g_buildingSystem->getAllBuildings());
+    int simTicks = simClock.advance(deltaTime, globalTimeScale);
+    float simStep = simClock.getStep();
+    // Gracz i kamera ruszają się raz na klatkę - prędkość dla streamingu
+    // regionów liczona z czasu klatki, nie z kroku symulacji
+    Vector3 streamingViewer = controlledSettler
+                                  ? controlledSettler->getPosition()
+                                  : sceneCamera.position;
+    WorldManager::GetInstance()->UpdatePlayerVelocity(deltaTime,
+                                                      streamingViewer);
+    // LOD symulacji liczony od sterowanego osadnika albo punktu, na który
+    // patrzy kamera (pozycja kamery RTS wisi wysoko nad mapą)
+    colony.getSimulationLOD().setViewer(controlledSettler
+                                            ? controlledSettler->getPosition()
+                                            : sceneCamera.target);
+    for (int tick = 0; tick < simTicks; ++tick) {
+      PROFILE_ZONE("Simulation tick");
+      float gameTime = g_timeSystem ? g_timeSystem->getCurrentTime() : 0.0f;
+      colony.update(simStep, gameTime, terrain.getTrees(),
+                    g_buildingSystem->getAllBuildings());
+
+      // [WORLD MANAGER] Update
+      // Pass 0.0f for player y, assuming flat grid for now or use full
+      // Vector3
+      WorldManager::GetInstance()->Update(simStep, streamingViewer);
+
+      engine.update(simStep);
+    }
 
-    // Update navigation grid with current obstacles
+    // Update navigation grid with current obstacles (raz na klatkę)
     {
       auto buildings = g_buildingSystem->getAllBuildings();
 
       // Convert unique_ptr<Tree> to Tree*
-      std::vector<Tree *> treePtrs;
+      FrameVector<Tree *> treePtrs;
       const auto &treesRef = terrain.getTrees();
       treePtrs.reserve(treesRef.size());
       for (const auto &treePtr : treesRef) {
@@ -1140,56 +1199,74 @@ int main() {
       navigationGrid.UpdateGrid(buildings, treePtrs, resources);
     }
 
-    // [WORLD MANAGER] Update
-    // Pass 0.0f for player y, assuming flat grid for now or use full
-    // Vector3
-    WorldManager::GetInstance()->Update(
-        scaledDeltaTime, controlledSettler ? controlledSettler->getPosition()
-                                           : sceneCamera.position);
-
-    engine.update(scaledDeltaTime);
-    BeginDrawing();
-    ClearBackground(RAYWHITE);
-    renderScene();
-    engine.render();
-    // Note: All UI is now handled by UISystem::render() called from
-    // engine.render() above
-    if (freeCameraController && freeCameraController->isDebugEnabled()) {
-      freeCameraController->renderDebug();
+    // Uploady GPU przygotowane przez wątki robocze - z budżetem, żeby
+    // wejście do nowego regionu nie robiło przycięcia
+    {
+      PROFILE_ZONE("MainThreadQueue");
+      MainThreadQueue::getInstance().process(2.0);
     }
 
-    // Draw Debug Console Overlay
-    DebugConsole::getInstance().render();
+    {
+      PROFILE_ZONE("Render");
+      BeginDrawing();
+      ClearBackground(RAYWHITE);
+      {
+        PROFILE_ZONE("renderScene");
+        renderScene();
+      }
+      engine.render();
+      // Note: All UI is now handled by UISystem::render() called from
+      // engine.render() above
+      if (freeCameraController && freeCameraController->isDebugEnabled()) {
+        freeCameraController->renderDebug();
+      }
 
-    // --- FORCE CURSOR LOCK ---
-    if (wantCursorHidden) {
-      if (!IsCursorHidden())
-        DisableCursor();
-      if (IsWindowFocused()) {
-        SetMousePosition(SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2);
+      // Draw Debug Console Overlay
+      DebugConsole::getInstance().render();
+      Profiler::renderOverlay(GetScreenWidth() - 430, 10);
+
+      // --- FORCE CURSOR LOCK ---
+      if (wantCursorHidden) {
+        if (!IsCursorHidden())
+          DisableCursor();
+        if (IsWindowFocused()) {
+          SetMousePosition(SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2);
+        }
       }
-    }
 
-    // [UI] Draw Camera Mode Indicator
-    const char *modeText = "MODE: RTS (Isometric)";
-    Color modeColor = SKYBLUE;
-    if (currentCameraMode == CameraViewMode::TPS) {
-      modeText = "MODE: TPS (Third Person)";
-      modeColor = GREEN;
-    } else if (currentCameraMode == CameraViewMode::FPS) {
-      modeText = "MODE: FPS (First Person)";
-      modeColor = ORANGE;
-    }
+      // [UI] Draw Camera Mode Indicator
+      const char *modeText = "MODE: RTS (Isometric)";
+      Color modeColor = SKYBLUE;
+      if (currentCameraMode == CameraViewMode::TPS) {
+        modeText = "MODE: TPS (Third Person)";
+        modeColor = GREEN;
+      } else if (currentCameraMode == CameraViewMode::FPS) {
+        modeText = "MODE: FPS (First Person)";
+        modeColor = ORANGE;
+      }
+
+      DrawText(modeText, 20, SCREEN_HEIGHT - 40, 20, modeColor);
+      DrawText("[V] Switch View   [TAB] Cycle Units", 20, SCREEN_HEIGHT - 20,
+               10, LIGHTGRAY);
 
-    DrawText(modeText, 20, SCREEN_HEIGHT - 40, 20, modeColor);
-    DrawText("[V] Switch View   [TAB] Cycle Units", 20, SCREEN_HEIGHT - 20, 10,
-             LIGHTGRAY);
+      {
+        PROFILE_ZONE("EndDrawing");
+        EndDrawing();
+      }
+    }
 
-    EndDrawing();
+    // Koniec klatki - wszystkie tymczasowe alokacje z FrameArena wracają naraz
+    FrameArena::resetAll();
+    RenderStats::endFrame();
+    Profiler::endFrame();
   }
 
   // [WORLD MANAGER] Shutdown
   WorldManager::GetInstance()->Shutdown();
+  InstancedRenderer::getInstance().unload();
+  RenderStats::uninstall();
 
   engine.shutdown();
+  JobSystem::getInstance().shutdown();
+  Logger::shutdown();
 }
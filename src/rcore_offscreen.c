@@ -0,0 +1,164 @@
+// Platforma rcore bez okna dla rlsw (GRAPHICS_API_OPENGL_11_SOFTWARE).
+// Cały rcore.c kompiluje się tutaj, a poniżej są funkcje platformy - jak
+// w vendor/raylib/platforms/rcore_template.c, tylko bez urządzenia:
+// InitWindow ustawia rozmiar bufora, rlglInit() -> swInit() rasteryzuje do
+// pamięci, SwapScreenBuffer nic nie robi. Obraz: LoadImageFromScreen().
+//
+#include "rcore.c"
+
+//----------------------------------------------------------------------------------
+// Okno i urządzenie graficzne (bufor w pamięci)
+//----------------------------------------------------------------------------------
+
+bool WindowShouldClose(void)
+{
+    if (CORE.Window.ready) return CORE.Window.shouldClose;
+    else return true;
+}
+
+void ToggleFullscreen(void) { }
+void ToggleBorderlessWindowed(void) { }
+void MaximizeWindow(void) { }
+void MinimizeWindow(void) { }
+void RestoreWindow(void) { }
+
+void SetWindowState(unsigned int flags) { FLAG_SET(CORE.Window.flags, flags); }
+void ClearWindowState(unsigned int flags) { FLAG_CLEAR(CORE.Window.flags, flags); }
+
+void SetWindowIcon(Image image) { (void)image; }
+void SetWindowIcons(Image *images, int count) { (void)images; (void)count; }
+void SetWindowTitle(const char *title) { CORE.Window.title = title; }
+void SetWindowPosition(int x, int y) { (void)x; (void)y; }
+void SetWindowMonitor(int monitor) { (void)monitor; }
+
+void SetWindowMinSize(int width, int height)
+{
+    CORE.Window.screenMin.width = width;
+    CORE.Window.screenMin.height = height;
+}
+
+void SetWindowMaxSize(int width, int height)
+{
+    CORE.Window.screenMax.width = width;
+    CORE.Window.screenMax.height = height;
+}
+
+// Zmiana rozmiaru = nowy bufor rlsw
+void SetWindowSize(int width, int height)
+{
+    CORE.Window.screen.width = width;
+    CORE.Window.screen.height = height;
+    CORE.Window.render.width = width;
+    CORE.Window.render.height = height;
+    CORE.Window.currentFbo.width = width;
+    CORE.Window.currentFbo.height = height;
+    rlResizeFramebuffer(width, height);
+    SetupViewport(width, height);
+}
+
+void SetWindowOpacity(float opacity) { (void)opacity; }
+void SetWindowFocused(void) { }
+void *GetWindowHandle(void) { return NULL; }
+
+int GetMonitorCount(void) { return 1; }
+int GetCurrentMonitor(void) { return 0; }
+Vector2 GetMonitorPosition(int monitor) { (void)monitor; return (Vector2){ 0, 0 }; }
+int GetMonitorWidth(int monitor) { (void)monitor; return CORE.Window.screen.width; }
+int GetMonitorHeight(int monitor) { (void)monitor; return CORE.Window.screen.height; }
+int GetMonitorPhysicalWidth(int monitor) { (void)monitor; return 0; }
+int GetMonitorPhysicalHeight(int monitor) { (void)monitor; return 0; }
+int GetMonitorRefreshRate(int monitor) { (void)monitor; return 0; }
+const char *GetMonitorName(int monitor) { (void)monitor; return "offscreen"; }
+Vector2 GetWindowPosition(void) { return (Vector2){ 0, 0 }; }
+Vector2 GetWindowScaleDPI(void) { return (Vector2){ 1.0f, 1.0f }; }
+
+void SetClipboardText(const char *text) { (void)text; }
+const char *GetClipboardText(void) { return NULL; }
+
+Image GetClipboardImage(void)
+{
+    Image image = { 0 };
+    return image;
+}
+
+void ShowCursor(void) { CORE.Input.Mouse.cursorHidden = false; }
+void HideCursor(void) { CORE.Input.Mouse.cursorHidden = true; }
+void EnableCursor(void) { CORE.Input.Mouse.cursorHidden = false; }
+void DisableCursor(void) { CORE.Input.Mouse.cursorHidden = true; }
+
+// Klatka zostaje w buforze rlsw - nie ma czego prezentować
+void SwapScreenBuffer(void) { }
+
+//----------------------------------------------------------------------------------
+// Czas i wejście
+//----------------------------------------------------------------------------------
+
+double GetTime(void)
+{
+    struct timespec ts = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    unsigned long long int nanoSeconds = (unsigned long long int)ts.tv_sec*1000000000LLU + (unsigned long long int)ts.tv_nsec;
+
+    return (double)(nanoSeconds - CORE.Time.base)*1e-9;  // Od InitTimer()
+}
+
+void OpenURL(const char *url) { (void)url; }
+
+int SetGamepadMappings(const char *mappings) { (void)mappings; return 0; }
+
+void SetGamepadVibration(int gamepad, float leftMotor, float rightMotor, float duration)
+{
+    (void)gamepad; (void)leftMotor; (void)rightMotor; (void)duration;
+}
+
+void SetMousePosition(int x, int y)
+{
+    CORE.Input.Mouse.currentPosition = (Vector2){ (float)x, (float)y };
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+}
+
+void SetMouseCursor(int cursor) { (void)cursor; }
+const char *GetKeyName(int key) { (void)key; return ""; }
+
+// Brak urządzeń wejścia - tylko przesunięcie stanów poprzedniej klatki
+void PollInputEvents(void)
+{
+    CORE.Input.Keyboard.keyPressedQueueCount = 0;
+    CORE.Input.Keyboard.charPressedQueueCount = 0;
+    for (int i = 0; i < MAX_KEYBOARD_KEYS; i++)
+    {
+        CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+        CORE.Input.Keyboard.keyRepeatInFrame[i] = 0;
+    }
+    for (int i = 0; i < MAX_MOUSE_BUTTONS; i++) CORE.Input.Mouse.previousButtonState[i] = CORE.Input.Mouse.currentButtonState[i];
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+    CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
+    CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, 0.0f };
+}
+
+//----------------------------------------------------------------------------------
+// Start i zamknięcie platformy
+//----------------------------------------------------------------------------------
+
+int InitPlatform(void)
+{
+    // Bufor ma dokładnie rozmiar z InitWindow - bez skalowania DPI
+    CORE.Window.display.width = CORE.Window.screen.width;
+    CORE.Window.display.height = CORE.Window.screen.height;
+    CORE.Window.render.width = CORE.Window.screen.width;
+    CORE.Window.render.height = CORE.Window.screen.height;
+    CORE.Window.currentFbo.width = CORE.Window.render.width;
+    CORE.Window.currentFbo.height = CORE.Window.render.height;
+    CORE.Window.ready = true;
+
+    InitTimer();
+    CORE.Storage.basePath = GetWorkingDirectory();
+
+    TRACELOG(LOG_INFO, "PLATFORM: OFFSCREEN: %i x %i software framebuffer (rlsw)", CORE.Window.render.width, CORE.Window.render.height);
+    return 0;
+}
+
+void ClosePlatform(void)
+{
+    // Bufor rlsw zwalnia rlglClose()
+}
@@ -1,11 +1,15 @@
 #include "BuildingSystem.h"
 #include "../core/GameEngine.h" // Include GameEngine to access systems
 #include "../core/GameSystem.h" // Include GameSystem for getTerrain()
+#include "../core/EventBus.h"
 #include "../game/Bed.h"
+#include "../game/BuildingChunkMeshes.h"
 #include "../game/BuildingBlueprint.h"
 #include "../game/BuildingInstance.h" // Ensure BuildingInstance is fully defined
 #include "../game/Colony.h"
 #include "../game/Door.h"
+#include "../game/RenderCulling.h"
+#include "../game/InstancedRenderer.h"
 #include "../game/InteractableObject.h"
 #include "../game/Settler.h" // Include Settler
 #include "../game/Terrain.h" // Include Terrain to access height
@@ -17,6 +21,7 @@
 #include <algorithm>
 #include <cmath>
 #include <iostream>
+#include "../game/BuildingTask.h"
 
 // Helper to check if a blueprint is a floor
 bool isFloor(const std::string &id) {
@@ -47,6 +52,7 @@ void BuildingSystem::EnsureStorageForBuildingInstance(
     std::string storageId =
         m_storageSystem->createStorage(StorageType::WAREHOUSE, "Colony");
     building->setStorageId(storageId);
+    markStorageVisualDirty(building->getStorageSid());
     std::cout << "[BuildingSystem] DEBUG: Assigned storageId=" << storageId
               << " to building blueprint=" << building->getBlueprintId()
               << std::endl;
@@ -195,12 +201,27 @@ void BuildingSystem::initialize() {
   m_storageSystem = GameEngine::getInstance().getSystem<StorageSystem>();
   if (m_storageSystem) {
     std::cout << "BuildingSystem: Connected to StorageSystem." << std::endl;
+    // Wizualizacja magazynu tylko po zmianie zawartości (przebudowa w render)
+    if (m_storageEventHandlers.empty()) {
+      m_storageEventHandlers.push_back(
+          EventBus::registerHandler<ItemAddedToStorageEvent>(
+              [this](const ItemAddedToStorageEvent &event) {
+                markStorageVisualDirty(event.storageId);
+              },
+              "BuildingSystem_StorageVisuals"));
+      m_storageEventHandlers.push_back(
+          EventBus::registerHandler<ItemRemovedFromStorageEvent>(
+              [this](const ItemRemovedFromStorageEvent &event) {
+                markStorageVisualDirty(event.storageId);
+              },
+              "BuildingSystem_StorageVisuals"));
+    }
   } else {
     std::cerr << "BuildingSystem: Failed to connect to StorageSystem!"
               << std::endl;
   }
 
-  if (!cubeModelLoaded) {
+  if (!cubeModelLoaded && !GameEngine::getInstance().isHeadless()) {
     Mesh mesh = GenMeshCube(1.0f, 1.0f, 1.0f);
     cubeModel = LoadModelFromMesh(mesh);
     cubeModelLoaded = true;
@@ -211,6 +232,12 @@ void BuildingSystem::initialize() {
 void BuildingSystem::shutdown() {
   m_buildTasks.clear();
   m_buildings.clear();
+  m_chunkMeshes.clear();
+  m_storageBatches.clear();
+  m_storageBuildings.clear();
+  for (EventBus::HandlerId id : m_storageEventHandlers)
+    EventBus::unregisterHandler(id);
+  m_storageEventHandlers.clear();
   m_blueprints.clear();
   if (cubeModelLoaded) {
     UnloadModel(cubeModel);
@@ -392,7 +419,9 @@ void BuildingSystem::registerBlueprint(
   // Try loading model, but don't fail if missing (will use fallback)
   // Better error handling in loadModel would be ideal, but here we assume
   // loadModel handles its own errors/defaults
-  blueprint->loadModel();
+  if (!GameEngine::getInstance().isHeadless()) {
+    blueprint->loadModel();
+  }
   m_blueprints[blueprint->getId()] = std::move(blueprint);
 }
 
@@ -502,12 +531,14 @@ BuildTask *BuildingSystem::startBuilding(const std::string &blueprintId,
         std::string storageId =
             m_storageSystem->createStorage(StorageType::WAREHOUSE, "Colony");
         building->setStorageId(storageId);
+        markStorageVisualDirty(building->getStorageSid());
         std::cout << "  Storage (Warehouse) created for instant building ("
                   << blueprintId << "): " << storageId << std::endl;
       } else if (bp->getCategory() == BuildingCategory::RESIDENTIAL) {
         std::string storageId =
             m_storageSystem->createStorage(StorageType::CHEST, "Colony");
         building->setStorageId(storageId);
+        markStorageVisualDirty(building->getStorageSid());
         std::cout << "  Storage (Chest) created for instant house: "
                   << storageId << std::endl;
       }
@@ -560,6 +591,7 @@ BuildTask *BuildingSystem::startBuilding(const std::string &blueprintId,
     // stores unique_ptr<BuildingInstance>. Ensure storage for the building
     EnsureStorageForBuildingInstance(building.get());
 
+    m_chunkMeshes.markDirty(building->getPosition());
     m_buildings.push_back(std::move(building));
 
     std::cout << "BuildingSystem: Building added to list. Total buildings: "
@@ -580,6 +612,7 @@ BuildTask *BuildingSystem::startBuilding(const std::string &blueprintId,
   }
 
   m_buildTasks.push_back(std::move(task));
+  m_buildTaskGeneration++;
 
   if (outSuccess)
     *outSuccess = true;
@@ -587,68 +620,6 @@ BuildTask *BuildingSystem::startBuilding(const std::string &blueprintId,
 }
 
 void BuildingSystem::update(float dt) {
-  // Update visualizations for storage buildings periodically
-  static float timer = 0.0f;
-  timer += dt;
-  if (timer > 1.0f) {
-    timer = 0.0f;
-    if (m_storageSystem) {
-      // Ensure storage for all buildings (for pre-placed or loaded buildings)
-      for (const auto &building : m_buildings) {
-        EnsureStorageForBuildingInstance(building.get());
-      }
-
-      // Update visualizations for storage buildings
-      for (const auto &building : m_buildings) {
-        // Check if it's a storage
-        std::string bpId = building->getBlueprintId();
-        std::string bpName =
-            building->getBlueprint() ? building->getBlueprint()->getName() : "";
-
-        // Jeśli budynek jest magazynem (nawet jeśli w trakcie budowy, jeśli ma
-        // już przypisane ID magazynu) Sprawdzamy szerzej, czy to magazyn, na
-        // podstawie blueprintu lub kategorii
-        bool isStorage = (bpId == "simple_storage" || bpId == "stockpile" ||
-                          bpName == "storehouse" || bpName == "Stockpile" ||
-                          bpName == "Simple Storage");
-
-        if (!isStorage) {
-          const BuildingBlueprint *bp = building->getBlueprint();
-          if (bp && bp->getCategory() == BuildingCategory::STORAGE) {
-            isStorage = true;
-          }
-        }
-
-        // Jeśli building jest w trakcie budowy, ale ma już storageId (np.
-        // instant build lub przypisane przy starcie) to chcemy zaktualizować
-        // wizualizację. Jeśli building jest 'under construction' (progress <
-        // 100), to normalnie może nie być w pełni funkcjonalny, ale jeśli ma
-        // storageId, to znaczy że system magazynowy go obsługuje.
-
-        if (isStorage) {
-          std::string storageId = building->getStorageId();
-          // std::cout << "[DEBUG] Found storage building " <<
-          // building->getBlueprintId() << " ID=" << storageId << std::endl;
-
-          if (!storageId.empty()) {
-            auto *storage = m_storageSystem->getStorage(storageId);
-            if (storage) {
-              // Only update if content changed or periodically?
-              // For now we update always to catch animations/changes quickly
-              building->updateVisualStorage(storage->slots);
-            } else {
-              // std::cout << "[DEBUG] Storage instance not found for ID=" <<
-              // storageId << std::endl;
-            }
-          } else {
-            // std::cout << "[DEBUG] Storage building has empty storageId" <<
-            // std::endl;
-          }
-        }
-      }
-    }
-  }
-
   for (auto it = m_buildTasks.begin(); it != m_buildTasks.end();) {
     BuildTask *task = it->get();
     if (task->isCompleted()) {
@@ -669,6 +640,20 @@ void BuildingSystem::update(float dt) {
   }
 }
 
+void BuildingSystem::declareAccess(SystemAccess &access) const {
+  // completeBuilding tworzy modele (GPU) i magazyny, zwalnia budowniczych
+  access.write<BuildingInstance>()
+      .write<BuildTask>()
+      .write<Door>()
+      .write<Bed>()
+      .write<Settler>()
+      .write<StorageSystem>()
+      .write<InteractionSystem>()
+      .write<Colony>()
+      .read<Terrain>()
+      .mainThread();
+}
+
 void BuildingSystem::completeBuilding(BuildTask *task) {
   // Notify workers that task is done
   for (auto *worker : task->getWorkers()) {
@@ -697,6 +682,7 @@ void BuildingSystem::completeBuilding(BuildTask *task) {
       std::string storageId =
           m_storageSystem->createStorage(StorageType::WAREHOUSE, "Colony");
       building->setStorageId(storageId);
+      markStorageVisualDirty(building->getStorageSid());
       std::cout << "  Storage (Warehouse) created for building (" << bpId
                 << "): " << storageId << std::endl;
     } else if (task->getBlueprint()->getCategory() ==
@@ -704,6 +690,7 @@ void BuildingSystem::completeBuilding(BuildTask *task) {
       std::string storageId =
           m_storageSystem->createStorage(StorageType::CHEST, "Colony");
       building->setStorageId(storageId);
+      markStorageVisualDirty(building->getStorageSid());
       std::cout << "  Storage (Chest) created for house: " << storageId
                 << std::endl;
     }
@@ -751,6 +738,7 @@ void BuildingSystem::completeBuilding(BuildTask *task) {
     }
   }
 
+  m_chunkMeshes.markDirty(building->getPosition());
   m_buildings.push_back(std::move(building));
 }
 
@@ -762,110 +750,138 @@ void BuildingSystem::cancelBuilding(BuildTask *task) {
   }
 }
 
-void BuildingSystem::render() {
-  for (const auto &building : m_buildings) {
-    // CRITICAL: Skip invisible buildings (like composite placeholders)
-    if (!building->isVisible()) continue;
-
-    auto it = m_blueprints.find(building->getBlueprintId());
-    if (it != m_blueprints.end() && it->second) {
-      const auto &blueprint = it->second;
-      if (!blueprint->getComponents().empty()) {
-        for (const auto &comp : blueprint->getComponents()) {
-          if (comp.blueprintId == "door" || comp.blueprintId == "bed") {
-            if (comp.blueprintId == "door" && building->getDoor()) {
-              building->getDoor()->render();
-              continue;
-            }
-            if (comp.blueprintId == "bed" && building->getBed()) {
-              building->getBed()->render();
-              continue;
-            }
-          }
+void BuildingSystem::collectRenderPieces(
+    const BuildingInstance &building,
+    std::vector<BuildingRenderPiece> &out) const {
+  auto it = m_blueprints.find(building.getBlueprintId());
+  if (it == m_blueprints.end() || !it->second)
+    return;
+  const auto &blueprint = it->second;
+
+  if (blueprint->getComponents().empty()) {
+    // Simple building (no components)
+    BuildingRenderPiece piece;
+    piece.sid = blueprint->getSid();
+    piece.blueprint = blueprint.get();
+    piece.position = building.getPosition();
+    piece.rotation = building.getRotation();
+    piece.boxColor = GRAY;
+    piece.outlined = true;
+    piece.wireColor = DARKGRAY;
+    out.push_back(piece);
+    return;
+  }
 
-          auto compIt = m_blueprints.find(comp.blueprintId);
-          if (compIt != m_blueprints.end() && compIt->second) {
-            const auto &compBp = compIt->second;
-            Model *model = compBp->getModel();
-
-            Vector3 rotatedOffset =
-                Vector3RotateByAxisAngle(comp.localPosition, {0.0f, 1.0f, 0.0f},
-                                         building->getRotation() * DEG2RAD);
-            Vector3 pos = Vector3Add(building->getPosition(), rotatedOffset);
-            float rot = building->getRotation() + comp.localRotation;
-
-            Color color = WHITE;
-            if (comp.blueprintId == "wall" || isFloor(comp.blueprintId)) {
-              color = BROWN;
-            }
-
-            // Fallback rendering if model not loaded or invalid
-            if (model && model->meshCount > 0 && model->materialCount > 0) {
-              DrawModelEx(*model, pos, {0.0f, 1.0f, 0.0f}, rot,
-                          {1.0f, 1.0f, 1.0f}, color);
-            } else {
-              // Fallback rendering using CubeModel or Matrix Transforms
-              Color fallbackColor = color;
-              if (ColorEqual(color, WHITE))
-                fallbackColor = GRAY;
-
-              Vector3 fallbackPos = pos;
-              fallbackPos.y += compBp->getSize().y / 2.0f;
-
-              if (cubeModelLoaded) {
-                DrawModelEx(cubeModel, fallbackPos, {0.0f, 1.0f, 0.0f}, rot,
-                            compBp->getSize(), color);
-              } else {
-                // Use rlgl matrix transformations to draw rotated cube
-                rlPushMatrix();
-                rlTranslatef(fallbackPos.x, fallbackPos.y, fallbackPos.z);
-                rlRotatef(rot, 0.0f, 1.0f, 0.0f);
-                DrawCube(Vector3{0, 0, 0}, compBp->getSize().x,
-                         compBp->getSize().y, compBp->getSize().z,
-                         fallbackColor);
-                rlPopMatrix();
-              }
-
-              // Draw Contours (Wires)
-              if (comp.blueprintId == "wall" || isFloor(comp.blueprintId)) {
-                rlPushMatrix();
-                rlTranslatef(fallbackPos.x, fallbackPos.y, fallbackPos.z);
-                rlRotatef(rot, 0.0f, 1.0f, 0.0f);
-                DrawCubeWires(Vector3{0.0f, 0.0f, 0.0f}, compBp->getSize().x,
-                              compBp->getSize().y, compBp->getSize().z, BLACK);
-                rlPopMatrix();
-              }
-            }
-          }
-        }
-      } else {
-        // Simple building (no components)
-        Model *model = blueprint->getModel();
-        if (model && model->meshCount > 0) {
-          DrawModelEx(*model, building->getPosition(), {0.0f, 1.0f, 0.0f},
-                      building->getRotation(), {1.0f, 1.0f, 1.0f}, WHITE);
-        } else {
-          Vector3 size = blueprint->getSize();
-          Vector3 pos = building->getPosition();
-          pos.y += size.y / 2.0f;
-
-          rlPushMatrix();
-          rlTranslatef(pos.x, pos.y, pos.z);
-          rlRotatef(building->getRotation(), 0.0f, 1.0f, 0.0f);
-          DrawCube(Vector3{0, 0, 0}, size.x, size.y, size.z, GRAY);
-          DrawCubeWires(Vector3{0, 0, 0}, size.x, size.y, size.z, DARKGRAY);
-          rlPopMatrix();
-        }
-      }
+  for (const auto &comp : blueprint->getComponents()) {
+    auto compIt = m_blueprints.find(comp.blueprintId);
+    if (compIt == m_blueprints.end() || !compIt->second)
+      continue;
+
+    BuildingRenderPiece piece;
+    piece.sid = compIt->second->getSid();
+    piece.blueprint = compIt->second.get();
+    piece.component = true;
+    Vector3 rotatedOffset =
+        Vector3RotateByAxisAngle(comp.localPosition, {0.0f, 1.0f, 0.0f},
+                                 building.getRotation() * DEG2RAD);
+    piece.position = Vector3Add(building.getPosition(), rotatedOffset);
+    piece.rotation = building.getRotation() + comp.localRotation;
+
+    bool structural = piece.sid == Ids::Wall || isFloor(comp.blueprintId);
+    piece.modelColor = structural ? BROWN : WHITE;
+    // Sześcian z cubeModel dostaje kolor modelu, DrawCube - szary zamiast
+    // białego
+    piece.boxColor = piece.modelColor;
+    if (!cubeModelLoaded && ColorEqual(piece.boxColor, WHITE))
+      piece.boxColor = GRAY;
+    piece.outlined = structural;
+    piece.wireColor = BLACK;
+    out.push_back(piece);
+  }
+}
+
+void BuildingSystem::drawPiece(const BuildingRenderPiece &piece) const {
+  const Model *model = piece.blueprint->getModel();
+  if (model && model->meshCount > 0 && model->materialCount > 0) {
+    DrawModelEx(*model, piece.position, {0.0f, 1.0f, 0.0f}, piece.rotation,
+                {1.0f, 1.0f, 1.0f}, piece.modelColor);
+    return;
+  }
+
+  // Fallback rendering using CubeModel or Matrix Transforms
+  Vector3 size = piece.blueprint->getSize();
+  Vector3 fallbackPos = piece.position;
+  fallbackPos.y += size.y / 2.0f;
+  if (piece.component && cubeModelLoaded) {
+    DrawModelEx(cubeModel, fallbackPos, {0.0f, 1.0f, 0.0f}, piece.rotation,
+                size, piece.boxColor);
+  } else {
+    rlPushMatrix();
+    rlTranslatef(fallbackPos.x, fallbackPos.y, fallbackPos.z);
+    rlRotatef(piece.rotation, 0.0f, 1.0f, 0.0f);
+    DrawCube(Vector3{0, 0, 0}, size.x, size.y, size.z, piece.boxColor);
+    rlPopMatrix();
+  }
+
+  // Draw Contours (Wires)
+  if (piece.outlined) {
+    rlPushMatrix();
+    rlTranslatef(fallbackPos.x, fallbackPos.y, fallbackPos.z);
+    rlRotatef(piece.rotation, 0.0f, 1.0f, 0.0f);
+    DrawCubeWires(Vector3{0.0f, 0.0f, 0.0f}, size.x, size.y, size.z,
+                  piece.wireColor);
+    rlPopMatrix();
+  }
+}
+
+void BuildingSystem::renderBuilding(BuildingInstance *building,
+                                    bool skipMerged) {
+  m_pieceScratch.clear();
+  collectRenderPieces(*building, m_pieceScratch);
+  for (const BuildingRenderPiece &piece : m_pieceScratch) {
+    if (piece.component && piece.sid == Ids::Door && building->getDoor()) {
+      building->getDoor()->render();
+      continue;
+    }
+    if (piece.component && piece.sid == Ids::Bed && building->getBed()) {
+      building->getBed()->render();
+      continue;
     }
+    if (skipMerged && BuildingChunkMeshes::canMerge(piece))
+      continue; // już w siatce chunka
+    drawPiece(piece);
+  }
+
+  if (m_storageSystem && !building->getStorageId().empty()) {
+    renderStorageContents(building);
+  }
+}
 
-    if (m_storageSystem && !building->getStorageId().empty()) {
-      renderStorageContents(building.get());
+void BuildingSystem::render() {
+  const RenderCulling &culling = RenderCulling::getInstance();
+  // Zmiany magazynów z tej klatki - jedna przebudowa na magazyn
+  flushStorageVisuals();
+  m_storageInstancesQueued = false;
+  if (m_chunkMeshes.prepare(*this)) {
+    // Statyczne ściany/podłogi - jeden DrawModel na widoczny chunk
+    m_chunkMeshes.draw(culling);
+    for (BuildingInstance *building : m_chunkMeshes.getDynamicBuildings()) {
+      if (culling.isVisible(building))
+        renderBuilding(building, true);
+    }
+  } else {
+    for (const auto &building : m_buildings) {
+      // CRITICAL: Skip invisible buildings (like composite placeholders)
+      if (!building->isVisible()) continue;
+      if (!culling.isVisible(building.get())) continue;
+      renderBuilding(building.get(), false);
     }
   }
+  if (m_storageInstancesQueued)
+    InstancedRenderer::getInstance().flush();
 
   for (const auto &task : m_buildTasks) {
-    if (!task->isActive())
+    if (!task->isActive() || !culling.isVisible(task.get()))
       continue;
 
     const auto &blueprint = task->getBlueprint();
@@ -995,7 +1011,7 @@ void BuildingSystem::render() {
           // Solid or Ghost?
           Color renderColor = isBuilt ? WHITE : color;
           if (isBuilt &&
-              (comp.blueprintId == "wall" || isFloor(comp.blueprintId)))
+              (compBp->getSid() == Ids::Wall || isFloor(comp.blueprintId)))
             renderColor = BROWN;
 
           // FIX: Handle transparency properly for ghost parts
@@ -1062,10 +1078,87 @@ void BuildingSystem::render() {
 }
 
 // Rendering storage visualization
-void BuildingSystem::renderStorageContents(BuildingInstance *building) {
-  // Check if we have a storage ID
-  if (building->getStorageId().empty())
+namespace {
+Color storageItemColor(Resources::ResourceType type) {
+  switch (type) {
+  case Resources::ResourceType::Wood:
+    return BROWN;
+  case Resources::ResourceType::Stone:
+    return GRAY;
+  case Resources::ResourceType::Food:
+    return ORANGE;
+  case Resources::ResourceType::Metal:
+    return LIGHTGRAY;
+  case Resources::ResourceType::Gold:
+    return GOLD;
+  case Resources::ResourceType::Water:
+    return BLUE;
+  default:
+    return RED; // Fallback
+  }
+}
+
+bool isStorageBuilding(const BuildingInstance &building) {
+  // Porównania po symbolach, kategoria z blueprintu dla pozostałych
+  StringId bpId = building.getBlueprintSid();
+  if (bpId == Ids::SimpleStorage || bpId == Ids::Stockpile ||
+      bpId == Ids::Storehouse)
+    return true;
+  const BuildingBlueprint *bp = building.getBlueprint();
+  return bp && bp->getCategory() == BuildingCategory::STORAGE;
+}
+} // namespace
+
+void BuildingSystem::markStorageVisualDirty(StringId storageId) {
+  if (!storageId.isValid())
     return;
+  std::lock_guard<std::mutex> lock(m_storageVisualMutex);
+  m_pendingStorageVisuals.insert(storageId);
+}
+
+BuildingInstance *BuildingSystem::findStorageBuilding(StringId storageId) {
+  auto it = m_storageBuildings.find(storageId);
+  if (it != m_storageBuildings.end())
+    return it->second;
+
+  // Magazyn przypisany po ostatnim skanie (albo nie należy do budynku) -
+  // ponowny skan; brak nie jest zapamiętywany, bo budynek może dostać
+  // ten magazyn później
+  m_storageBuildings.clear();
+  for (const auto &building : m_buildings) {
+    if (building->getStorageSid().isValid() && isStorageBuilding(*building))
+      m_storageBuildings[building->getStorageSid()] = building.get();
+  }
+  auto found = m_storageBuildings.find(storageId);
+  return found != m_storageBuildings.end() ? found->second : nullptr;
+}
+
+void BuildingSystem::flushStorageVisuals() {
+  std::unordered_set<StringId, StringIdHash> pending;
+  {
+    std::lock_guard<std::mutex> lock(m_storageVisualMutex);
+    if (m_pendingStorageVisuals.empty())
+      return;
+    pending.swap(m_pendingStorageVisuals);
+  }
+  if (!m_storageSystem)
+    return;
+
+  for (StringId storageId : pending) {
+    BuildingInstance *building = findStorageBuilding(storageId);
+    auto *storage = building ? m_storageSystem->getStorage(storageId) : nullptr;
+    if (!storage)
+      continue;
+    building->updateVisualStorage(storage->slots);
+    rebuildStorageBatch(*building);
+  }
+}
+
+void BuildingSystem::rebuildStorageBatch(const BuildingInstance &building) {
+  StorageBatch &batch = m_storageBatches[&building];
+  batch.transforms.clear();
+  batch.colors.clear();
+  m_storageVisualRebuilds++;
 
   // Get terrain for height adjustment if needed
   Terrain *terrain = nullptr;
@@ -1073,69 +1166,61 @@ void BuildingSystem::renderStorageContents(BuildingInstance *building) {
     terrain = GameEngine::getInstance().getSystem<GameSystem>()->getTerrain();
   }
 
-  const auto &visualSlots = building->getVisualSlots();
-  // [DEBUG] Rendering storage contents disabled to reduce spam
-  // std::cout << "[DEBUG] Rendering storage for " << building->getBlueprintId()
-  //           << " (" << building->getStorageId() << ") - Visual Slots: " <<
-  //           visualSlots.size() << std::endl;
-
-  rlDisableBackfaceCulling();
-  // Render visual slots stored in the building instance
-  for (const auto &vSlot : visualSlots) {
+  Matrix rotation = MatrixRotateY(building.getRotation() * DEG2RAD);
+  for (const auto &vSlot : building.getVisualSlots()) {
     // Transform local position to world position
     Vector3 rotatedOffset =
         Vector3RotateByAxisAngle(vSlot.localPosition, {0.0f, 1.0f, 0.0f},
-                                 building->getRotation() * DEG2RAD);
-    Vector3 worldPos = Vector3Add(building->getPosition(), rotatedOffset);
+                                 building.getRotation() * DEG2RAD);
+    Vector3 worldPos = Vector3Add(building.getPosition(), rotatedOffset);
 
     // Special handling for stockpiles to follow terrain
-    if (building->getBlueprintId() == "stockpile" && terrain) {
-      // For stockpiles, we ignore local Y relative to building and snap to
-      // terrain + offset Use vSlot.localPosition.y as offset from ground
+    if (building.getBlueprintSid() == Ids::Stockpile && terrain) {
+      // Use vSlot.localPosition.y as offset from ground
       float groundH = terrain->getInterpolatedHeightAt(worldPos.x, worldPos.z);
       worldPos.y = groundH + vSlot.localPosition.y;
-    } else {
-      // For buildings with floors, use the building's Y + local Y
-      // No arbitrary +0.5f here, trust the updated VisualStorageSlot logic
-      // But ensure building is not underground
     }
 
-    Color color = RED; // Fallback
-    switch (vSlot.type) {
-    case Resources::ResourceType::Wood:
-      color = BROWN;
-      break;
-    case Resources::ResourceType::Stone:
-      color = GRAY;
-      break;
-    case Resources::ResourceType::Food:
-      color = ORANGE;
-      break;
-    case Resources::ResourceType::Metal:
-      color = LIGHTGRAY;
-      break;
-    case Resources::ResourceType::Gold:
-      color = GOLD;
-      break;
-    case Resources::ResourceType::Water:
-      color = BLUE;
-      break;
-    default:
-      break;
-    }
+    // Sześcian 1x1x1 skalowany do slotu, obrócony jak budynek
+    Matrix transform = MatrixMultiply(
+        MatrixMultiply(MatrixScale(vSlot.scale.x, vSlot.scale.y, vSlot.scale.z),
+                       rotation),
+        MatrixTranslate(worldPos.x, worldPos.y, worldPos.z));
+    Color color = storageItemColor(vSlot.type);
+    batch.transforms.push_back(InstancedRenderer::packColor(transform, color));
+    batch.colors.push_back(color);
+  }
+}
+
+void BuildingSystem::onBuildingMoved(BuildingInstance *building,
+                                     Vector3 oldPosition) {
+  m_chunkMeshes.markDirty(oldPosition);
+  m_chunkMeshes.markDirty(building->getPosition());
+  markStorageVisualDirty(building->getStorageSid());
+}
+
+void BuildingSystem::renderStorageContents(BuildingInstance *building) {
+  // Zawartość z cache przebudowanego po zdarzeniu magazynu
+  auto it = m_storageBatches.find(building);
+  if (it == m_storageBatches.end() || it->second.transforms.empty())
+    return;
+  const StorageBatch &batch = it->second;
 
+  InstancedRenderer &instances = InstancedRenderer::getInstance();
+  if (instances.isReady()) {
+    instances.addCubes(batch.transforms);
+    m_storageInstancesQueued = true;
+    return;
+  }
+
+  for (size_t i = 0; i < batch.transforms.size(); ++i) {
+    Matrix transform = batch.transforms[i];
+    transform.m3 = transform.m7 = transform.m11 = 0.0f; // bez koloru
     rlPushMatrix();
-    rlTranslatef(worldPos.x, worldPos.y, worldPos.z);
-    rlRotatef(building->getRotation(), 0.0f, 1.0f, 0.0f);
-
-    // Draw scaled cube at origin (since we translated)
-    DrawCube(Vector3{0, 0, 0}, vSlot.scale.x, vSlot.scale.y, vSlot.scale.z,
-             color);
-    // DrawCubeWires(Vector3{0,0,0}, vSlot.scale.x, vSlot.scale.y,
-    // vSlot.scale.z, YELLOW); // Less visual noise
+    rlMultMatrixf(MatrixToFloat(transform));
+    DrawCube(Vector3{0, 0, 0}, 1.0f, 1.0f, 1.0f, batch.colors[i]);
     rlPopMatrix();
   }
-  rlDisableBackfaceCulling();
 }
 
 void BuildingSystem::renderPreview(const std::string &blueprintId,
@@ -1224,9 +1309,9 @@ BuildingSystem::getAvailableBlueprints() const {
   return available;
 }
 
-std::vector<BuildingInstance *>
+FrameVector<BuildingInstance *>
 BuildingSystem::getBuildingsInRange(Vector3 center, float radius) const {
-  std::vector<BuildingInstance *> result;
+  FrameVector<BuildingInstance *> result;
   for (const auto &building : m_buildings) {
     if (Vector3Distance(building->getPosition(), center) <= radius) {
       result.push_back(building.get());
@@ -1243,6 +1328,11 @@ std::vector<BuildingInstance *> BuildingSystem::getAllBuildings() const {
   return result;
 }
 
+BuildingBlueprint *BuildingSystem::getBlueprint(const std::string &id) const {
+  auto it = m_blueprints.find(id);
+  return it != m_blueprints.end() ? it->second.get() : nullptr;
+}
+
 BuildingInstance *BuildingSystem::getBuildingAt(Vector3 position) const {
   for (const auto &building : m_buildings) {
     if (Vector3Distance(building->getPosition(), position) < 0.5f) {
@@ -1282,6 +1372,40 @@ std::vector<BuildTask *> BuildingSystem::getActiveBuildTasks() const {
   return activeTasks;
 }
 
+BoundingBox BuildingSystem::getRenderBounds(const BuildingBlueprint *blueprint,
+                                            Vector3 position,
+                                            float rotation) const {
+  BoundingBox box{position, position};
+  // Obrót wokół Y - w poziomie zapas na przekątną podstawy
+  auto grow = [&box](Vector3 base, Vector3 size) {
+    float half = 0.5f * sqrtf(size.x * size.x + size.z * size.z);
+    box.min = Vector3Min(box.min, {base.x - half, base.y, base.z - half});
+    box.max = Vector3Max(box.max,
+                         {base.x + half, base.y + size.y, base.z + half});
+  };
+
+  if (!blueprint) {
+    grow(position, {2.0f, 3.0f, 2.0f});
+  } else if (blueprint->getComponents().empty()) {
+    grow(position, blueprint->getSize());
+  } else {
+    for (const auto &comp : blueprint->getComponents()) {
+      Vector3 offset =
+          Vector3RotateByAxisAngle(comp.localPosition, {0.0f, 1.0f, 0.0f},
+                                   rotation * DEG2RAD);
+      auto compIt = m_blueprints.find(comp.blueprintId);
+      Vector3 size = (compIt != m_blueprints.end() && compIt->second)
+                         ? compIt->second->getSize()
+                         : Vector3{1.0f, 1.0f, 1.0f};
+      grow(Vector3Add(position, offset), size);
+    }
+  }
+  // Zawartość magazynu i materiały budowy leżą nad/pod obrysem
+  box.min.y -= 0.5f;
+  box.max.y += 1.0f;
+  return box;
+}
+
 void BuildingSystem::enablePlanningMode(bool enable) { m_isPlanning = enable; }
 
 void BuildingSystem::setSelectedBlueprint(const std::string &blueprintId) {
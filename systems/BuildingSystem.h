@@ -1,13 +1,17 @@
 #pragma once
 
 #include "../core/GameSystem.h"
+#include "../core/FrameArena.h"
 #include "../game/BuildingBlueprint.h"
+#include "../game/BuildingChunkMeshes.h"
 #include "../game/BuildingInstance.h"
 #include "../game/BuildingTask.h"
 #include "InteractionSystem.h"
 #include <vector>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 #include <typeindex> // Ensure type_index is included
 #include "raylib.h"
 
@@ -22,6 +26,7 @@ public:
     void initialize() override;
     void shutdown() override;
     void update(float dt) override;
+    void declareAccess(SystemAccess& access) const override;
     void render() override;
     // Removing getComponentType as it is not part of GameSystem interface and caused confusion
     // If BuildingSystem needs to identify itself, it can use typeid() directly or we can add it to IGameSystem
@@ -43,12 +48,29 @@ public:
     void completeBuilding(BuildTask* task);
 
     // Queries
-    std::vector<BuildingInstance*> getBuildingsInRange(Vector3 center, float radius) const;
+    // Wynik żyje tylko do końca klatki (FrameArena) - nie przechowywać
+    FrameVector<BuildingInstance*> getBuildingsInRange(Vector3 center, float radius) const;
     std::vector<BuildingInstance*> getAllBuildings() const;
     BuildingInstance* getBuildingAt(Vector3 position) const;
     BuildTask* getBuildTaskAt(Vector3 position, float radius = 1.0f) const;
     int getPendingBuildCount(const std::string& blueprintId) const;
     std::vector<BuildTask*> getActiveBuildTasks() const;
+    const std::vector<std::unique_ptr<BuildingInstance>>& getBuildings() const { return m_buildings; }
+    const std::vector<std::unique_ptr<BuildTask>>& getBuildTasks() const { return m_buildTasks; }
+    // Obrys tego, co rysuje render() (komponenty + obrót) - dla cullingu
+    BoundingBox getRenderBounds(const BuildingBlueprint* blueprint, Vector3 position, float rotation) const;
+    // Elementy rysowane dla budynku (komponenty z pozycją i kolorem)
+    void collectRenderPieces(const BuildingInstance& building, std::vector<BuildingRenderPiece>& out) const;
+    // Scalone siatki statycznych budynków; przesunięcie budynku -> markDirty
+    BuildingChunkMeshes& getChunkMeshes() { return m_chunkMeshes; }
+    /** Po przesunięciu/obrocie budynku (edytor) - chunk i zawartość magazynu */
+    void onBuildingMoved(BuildingInstance* building, Vector3 oldPosition);
+    /** Zawartość magazynu zmieniła się - przebudowa przy następnym render() */
+    void markStorageVisualDirty(StringId storageId);
+    size_t getStorageVisualRebuilds() const { return m_storageVisualRebuilds; }
+    size_t getStorageVisualCount() const { return m_storageBatches.size(); }
+    /** Licznik rośnie przy każdym nowym zadaniu budowy (AIScheduler) */
+    uint32_t getBuildTaskGeneration() const { return m_buildTaskGeneration; }
     
     // New methods to fix compilation errors
     void enablePlanningMode(bool enable);
@@ -67,10 +89,33 @@ public:
 
 private:
     void renderStorageContents(BuildingInstance* building);
+    void renderBuilding(BuildingInstance* building, bool skipMerged);
+    void drawPiece(const BuildingRenderPiece& piece) const;
+    void flushStorageVisuals();
+    void rebuildStorageBatch(const BuildingInstance& building);
+    BuildingInstance* findStorageBuilding(StringId storageId);
+
+    // Sześciany zawartości magazynu w świecie, kolor w macierzy (instancje)
+    struct StorageBatch {
+        std::vector<Matrix> transforms;
+        std::vector<Color> colors; // dla rysowania bez instancji
+    };
 
     std::unordered_map<std::string, std::unique_ptr<BuildingBlueprint>> m_blueprints;
     std::vector<std::unique_ptr<BuildingInstance>> m_buildings;
     std::vector<std::unique_ptr<BuildTask>> m_buildTasks;
+    uint32_t m_buildTaskGeneration = 0;
+    BuildingChunkMeshes m_chunkMeshes;
+    std::vector<BuildingRenderPiece> m_pieceScratch;
+
+    // Zdarzenia magazynu mogą przyjść z wątku roboczego - zbiór pod mutexem
+    std::mutex m_storageVisualMutex;
+    std::unordered_set<StringId, StringIdHash> m_pendingStorageVisuals;
+    std::unordered_map<StringId, BuildingInstance*, StringIdHash> m_storageBuildings;
+    std::unordered_map<const BuildingInstance*, StorageBatch> m_storageBatches;
+    std::vector<uint32_t> m_storageEventHandlers; // EventBus::HandlerId
+    size_t m_storageVisualRebuilds = 0;
+    bool m_storageInstancesQueued = false;
 
     InteractionSystem* m_interactionSystem;
     Colony* m_colony;
@@ -1,6 +1,9 @@
 #include "CraftingSystem.h"
+#include "../core/FrameArena.h"
+#include "../core/EventBus.h"
 #include "../core/GameEngine.h"
 #include "../core/GameSystem.h"
+#include "../core/Logger.h"
 #include "../game/Colony.h"
 #include "StorageSystem.h"
 #include "../systems/BuildingSystem.h"
@@ -15,12 +18,7 @@ extern BuildingSystem* g_buildingSystem;
 
 // Helper to convert string to ResourceType
 Resources::ResourceType StringToResourceType(const std::string& typeStr) {
-    if (typeStr == "Wood") return Resources::ResourceType::Wood;
-    if (typeStr == "Stone") return Resources::ResourceType::Stone;
-    if (typeStr == "Food") return Resources::ResourceType::Food;
-    if (typeStr == "Metal") return Resources::ResourceType::Metal;
-    if (typeStr == "Gold") return Resources::ResourceType::Gold;
-    return Resources::ResourceType::None;
+    return Resources::resourceTypeFromString(typeStr);
 }
 
 // Constructor is defined in header or uses default
@@ -67,9 +65,8 @@ void CraftingSystem::initialize() {
     registerRecipe(knife);
 
     // Subskrybuj event zmiany ekwipunku
-    EVENT_BUS.registerHandler<InventoryChangedEvent>(
-        [this](const std::any& eventData) {
-            const auto& event = std::any_cast<const InventoryChangedEvent&>(eventData);
+    EventBus::registerHandler<InventoryChangedEvent>(
+        [this](const InventoryChangedEvent& event) {
             this->onInventoryChanged(event);
         },
         "CraftingSystem"
@@ -92,7 +89,9 @@ void CraftingSystem::update(float deltaTime) {
         m_resumeCheckTimer = 0.f;
         if (!m_pendingCrafts.empty()) {
             // Collect unique settler IDs to avoid duplicate checks
-            std::unordered_set<std::string> settlerIds;
+            std::unordered_set<std::string, std::hash<std::string>,
+                               std::equal_to<std::string>,
+                               FrameAllocator<std::string>> settlerIds;
             for (const auto& kv : m_pendingCrafts) {
                 settlerIds.insert(kv.second.settlerId);
             }
@@ -103,6 +102,17 @@ void CraftingSystem::update(float deltaTime) {
     }
 }
 
+void CraftingSystem::declareAccess(SystemAccess& access) const {
+    // Wznawianie craftingu sprawdza ekwipunek osadnika albo magazyny
+    access.write<CraftingSystem>()
+        .read<Colony>()
+        .read<Settler>()
+        .read<InventoryComponent>()
+        .read<StorageSystem>()
+        .read<BuildingSystem>()
+        .read<BuildingInstance>();
+}
+
 void CraftingSystem::render() {
     // empty for now
 }
@@ -137,8 +147,8 @@ int CraftingSystem::queueTask(const std::string& recipeId, const std::string& ta
 CraftingTask* CraftingSystem::getAvailableTask(const std::string& settlerId) {
     // Debug log if queue not empty (once per call)
     if (!m_taskQueue.empty()) {
-        std::cout << "[CraftingSystem] getAvailableTask called for settler '" << settlerId
-                  << "', queue size=" << m_taskQueue.size() << std::endl;
+        LOG_DBG(Crafting, "getAvailableTask called for settler '", settlerId,
+                "', queue size=", m_taskQueue.size());
     }
     for (auto it = m_taskQueue.begin(); it != m_taskQueue.end(); ++it) {
         if (!it->isStarted) {
@@ -149,8 +159,8 @@ CraftingTask* CraftingSystem::getAvailableTask(const std::string& settlerId) {
             }
 
             // Remove the canCraft check - assign task even if ingredients missing
-            std::cout << "[CraftingSystem] Assigned craft taskId=" << it->taskId
-                      << " recipe=" << it->recipeId << " to settler=" << settlerId << std::endl;
+            LOG_INF(Crafting, "Assigned craft taskId=", it->taskId,
+                    " recipe=", it->recipeId, " to settler=", settlerId);
             CraftingTask task = *it;
             task.assignedSettlerId = settlerId;
             task.isStarted = true;
@@ -239,9 +249,8 @@ bool CraftingSystem::canCraft(const std::string& recipeId, const std::string& se
         int total = 0;
         for (const auto& bld : buildings) {
             if (!bld->isBuilt()) continue;
-            std::string storageId = bld->getStorageId();
-            if (storageId.empty()) continue;
-            total += storageSys->getResourceAmount(storageId, resourceType);
+            if (!bld->getStorageSid().isValid()) continue;
+            total += storageSys->getResourceAmount(bld->getStorageSid(), resourceType);
         }
         if (total < ing.amount) {
             if (!silent) std::cout << "CraftingSystem: Missing " << ing.amount - total << " " << ing.resourceType << " in storage" << std::endl;
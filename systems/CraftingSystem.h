@@ -61,6 +61,7 @@ CraftingSystem() = default;
 /* IGameSystem */
 void initialize() override;
 void update(float deltaTime) override;
+void declareAccess(SystemAccess& access) const override;
 void render() override;
 void shutdown() override;
 std::string getName() const override { return "CraftingSystem"; }
@@ -54,6 +54,7 @@ public:
 };
 
 #include "../game/BuildingTask.h" // Added
+#include "BuildingSystem.h"
 
 // ... existing code ...
 
@@ -64,10 +65,15 @@ public:
   BuildingWrapper(BuildingInstance *b) : m_building(b) {}
   Vector3 GetPosition() const override { return m_building->getPosition(); }
   void SetPosition(const Vector3 &pos) override {
+    Vector3 oldPosition = m_building->getPosition();
     m_building->setPosition(pos);
+    notifyMoved(oldPosition);
   }
   float GetRotation() const override { return m_building->getRotation(); }
-  void SetRotation(float rot) override { m_building->setRotation(rot); }
+  void SetRotation(float rot) override {
+    m_building->setRotation(rot);
+    notifyMoved(m_building->getPosition());
+  }
   std::string GetName() const override {
     return "Building: " + m_building->getBlueprintId();
   }
@@ -77,6 +83,14 @@ public:
   BoundingBox GetBoundingBox() const override {
     return m_building->getBoundingBox();
   }
+
+private:
+  // Siatka chunka i zawartość magazynu są zapisane w pozycjach świata
+  void notifyMoved(Vector3 oldPosition) {
+    if (auto *buildings =
+            GameEngine::getInstance().getSystem<BuildingSystem>())
+      buildings->onBuildingMoved(m_building, oldPosition);
+  }
 };
 
 class BuildTaskWrapper : public EditorObjectWrapper {
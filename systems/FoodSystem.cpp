@@ -1,5 +1,4 @@
 #include "FoodSystem.h"
-#include "../core/EventSystem.h"
 
 FoodSystem::FoodSystem() : m_name("FoodSystem") {
 }
@@ -9,6 +9,7 @@
 #include "../systems/StorageSystem.h"
 #include "../systems/UISystem.h"
 #include <iostream>
+#include "../game/Bed.h"
 
 extern Colony colony;
 InteractionSystem::InteractionSystem()
@@ -30,6 +31,14 @@ void InteractionSystem::update(float deltaTime) {
     }
   }
 }
+void InteractionSystem::declareAccess(SystemAccess &access) const {
+  // Aktualizuje zarejestrowane obiekty - drzwi sprawdzają pobliskich osadników
+  access.write<InteractableObject>()
+      .write<Door>()
+      .write<Bed>()
+      .read<Colony>()
+      .read<Settler>();
+}
 void InteractionSystem::render() {
   if (m_activeChopTarget) {
     DrawCubeWires(m_activeChopTarget->getPosition(), 1.2f, 1.2f, 1.2f, RED);
@@ -1,7 +1,7 @@
 #include "InventorySystem.h"
 #include "../entities/GameEntity.h"
-#include "../core/EventSystem.h"
 #include <algorithm>
+#include "../components/InventoryComponent.h"
 
 InventorySystem::InventorySystem()
     : m_autoLootEnabled(true)
@@ -20,6 +20,10 @@ void InventorySystem::update(float deltaTime) {
     }
 }
 
+void InventorySystem::declareAccess(SystemAccess& access) const {
+    access.write<InventoryComponent>();
+}
+
 void InventorySystem::render() {
     // Renderowanie systemu ekwipunku
     // Można tutaj dodać wizualizację w trybie debug
@@ -27,6 +27,7 @@ public:
 
     // IGameSystem interface
     void update(float deltaTime) override;
+    void declareAccess(SystemAccess& access) const override;
     void render() override;
     void initialize() override;
     void shutdown() override;
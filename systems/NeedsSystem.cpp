@@ -1,7 +1,10 @@
 #include "NeedsSystem.h"
 #include "../game/BuildingInstance.h"
-#include <iostream>
+#include "../core/Logger.h"
 #include "raymath.h"
+#include "../game/Settler.h"
+#include "../game/NavigationGrid.h"
+#include "BuildingSystem.h"
 
 void NeedsSystem::update(float deltaTime) {
 for (auto& settler : m_settlers) {
@@ -9,29 +12,36 @@ if (!settler) continue;
 handleEnergyNeeds(*settler, deltaTime);
 }
 }
+
+void NeedsSystem::declareAccess(SystemAccess& access) const {
+// Wysyła zmęczonych osadników do łóżek. MoveTo -> FindPath zapisuje
+// gCost/hCost/parent we wspólnych węzłach siatki, więc to zapis
+access.write<Settler>()
+.read<BuildingSystem>()
+.read<BuildingInstance>()
+.write<NavigationGrid>();
+}
 void NeedsSystem::handleEnergyNeeds(Settler& settler, float deltaTime) {
 SettlerState state = settler.getState();
 
 // Nie zmniejszamy energii - StatsComponent::update już to robi
 // Sprawdzamy potrzebę snu za pomocą settler.needsSleep()
 if (settler.needsSleep()) {
-std::cout << "[NeedsSystem] Settler " << settler.getName() << " needs sleep (energy low), looking for bed." << std::endl;
 // Interrupt current work and find bed if not already doing so
 if (state != SettlerState::MOVING_TO_BED && state != SettlerState::SLEEPING) {
 // Find a bed
 BuildingInstance* bed = findFreeBed(settler);
 if (bed) {
-std::cout << "[NeedsSystem] Found bed at (" << bed->getPosition().x << "," << bed->getPosition().z << "), moving to it." << std::endl;
 settler.assignBed(bed);
 // Ustaw stan MOVING_TO_BED przed MoveTo, aby MoveTo nie zmienił stanu na MOVING (bo ma warunek)
 settler.setState(SettlerState::MOVING_TO_BED);
 settler.MoveTo(bed->getPosition());
-std::cout << "[NeedsSystem] Settler " << settler.getName() << " state -> MOVING_TO_BED (energy low)." << std::endl;
+// Wołane z wątku roboczego - przez asynchroniczny logger, nie std::cout
+LOG_INF(Settler, settler.getName(), " needs sleep, moving to bed at (",
+        bed->getPosition().x, ",", bed->getPosition().z, ")");
 } else {
-std::cout << "[NeedsSystem] No free bed found." << std::endl;
+LOG_RATE(Debug, Settler, 1, settler.getName(), " needs sleep, no free bed found");
 }
-} else {
-std::cout << "[NeedsSystem] Already moving to bed or sleeping." << std::endl;
 }
 }
 }
@@ -59,7 +69,7 @@ if (!building) continue;
 // It does NOT seem to have `getBed()` in the lines 1-100 I read.
 // It has `getBlueprintId()`.
 
-if (building->getBlueprintId() == "house_small" || building->getBlueprintId() == "bed") {
+if (building->getBlueprintSid() == Ids::HouseSmall || building->getBlueprintSid() == Ids::Bed) {
      // Calculate distance
      float dist = Vector3Distance(settlerPos, building->getPosition());
      if (dist < minDistance) {
@@ -13,6 +13,7 @@ NeedsSystem() : GameSystem("NeedsSystem"), m_buildingSystem(nullptr) {}
 NeedsSystem(const std::vector<Settler*>& settlers, BuildingSystem* buildingSystem)
 : GameSystem("NeedsSystem"), m_settlers(settlers), m_buildingSystem(buildingSystem) {}
 void update(float deltaTime) override;
+void declareAccess(SystemAccess& access) const override;
 void initialize() override {}
 // Implementacja renderowania
 void render() override {}
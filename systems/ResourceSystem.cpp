@@ -1,5 +1,5 @@
 #include "ResourceSystem.h"
-#include "../core/EventSystem.h"
+#include "../core/EventBus.h"
 #include <iostream>
 
 ResourceSystem::ResourceSystem() : m_name("ResourceSystem") {
@@ -20,16 +20,11 @@ void ResourceSystem::initialize() {
 
     // Rejestracja handlerów zdarzeń
     EventBus::registerHandler<Resources::ResourceChangedEvent>(
-        [this](const std::any& data) {
-            try {
-                const auto& event = std::any_cast<const Resources::ResourceChangedEvent&>(data);
-                std::cout << "Resource Changed: " << event.playerId 
-                          << " Type: " << static_cast<int>(event.type) 
-                          << " Change: " << event.change 
-                          << " New Amount: " << event.newAmount << std::endl;
-            } catch (const std::bad_any_cast& e) {
-                std::cerr << "Error handling ResourceChangedEvent: " << e.what() << std::endl;
-            }
+        [](const Resources::ResourceChangedEvent& event) {
+            std::cout << "Resource Changed: " << event.playerId 
+                      << " Type: " << static_cast<int>(event.type) 
+                      << " Change: " << event.change 
+                      << " New Amount: " << event.newAmount << std::endl;
         },
         "ResourceSystem"
     );
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include "../core/StringId.h"
 
 // Undefine potential macro conflicts from Windows headers or Raylib
 // We use PascalCase for enum members to avoid these conflicts, but strictly speaking, 
@@ -39,4 +40,21 @@ namespace Resources {
             default: return "Unknown";
         }
     }
+
+    // Odwrotna konwersja po symbolu - switch po liczbach zamiast łańcucha porównań stringów
+    inline ResourceType resourceTypeFromId(StringId id) {
+        switch (id.value) {
+            case Ids::Wood.value: return ResourceType::Wood;
+            case Ids::Stone.value: return ResourceType::Stone;
+            case Ids::Food.value: return ResourceType::Food;
+            case Ids::Metal.value: return ResourceType::Metal;
+            case Ids::Gold.value: return ResourceType::Gold;
+            case Ids::Water.value: return ResourceType::Water;
+            default: return ResourceType::None;
+        }
+    }
+
+    inline ResourceType resourceTypeFromString(std::string_view name) {
+        return resourceTypeFromId(StringId::of(name));
+    }
 }
\ No newline at end of file
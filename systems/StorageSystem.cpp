@@ -1,5 +1,6 @@
 #include "StorageSystem.h"
-#include "../core/EventSystem.h" // ADDED
+#include "../core/EventBus.h"
+#include "../core/Logger.h"
 #include <algorithm>
 #include <cmath>
 #include <iostream>
@@ -157,6 +158,11 @@ void StorageSystem::render() {
   // No visual rendering
 }
 
+void StorageSystem::declareAccess(SystemAccess &access) const {
+  // Tylko czyszczenie własnego cache
+  access.write<StorageSystem>();
+}
+
 void StorageSystem::shutdown() {
   m_storages.clear();
   m_playerStorages.clear();
@@ -190,7 +196,16 @@ std::string StorageSystem::createStorage(StorageType type,
 
   StorageInstance instance =
       StorageFactory::createStorageInstance(type, ownerId);
-  instance.id = "storage_" + std::to_string(m_nextStorageId++);
+  // Klucz m_storages to 32-bitowy skrót nazwy - kolizja z istniejącym
+  // magazynem o innej nazwie nadpisałaby go, więc bierzemy kolejny numer
+  for (;;) {
+    instance.id = "storage_" + std::to_string(m_nextStorageId++);
+    auto existing = m_storages.find(StringId::of(instance.id));
+    if (existing == m_storages.end())
+      break;
+    LOG_ERR(Storage, "StringId collision: '", instance.id, "' vs existing '",
+            existing->second.id, "', trying next id");
+  }
 
   const auto &config = it->second;
   instance.slots.reserve(config.maxSlots);
@@ -198,21 +213,24 @@ std::string StorageSystem::createStorage(StorageType type,
     instance.slots.emplace_back();
   }
 
+  instance.sid = StringInterner::intern(instance.id);
+
   std::string id = instance.id;
-  m_storages.emplace(id, std::move(instance));
+  StringId sid = instance.sid;
+  m_storages.emplace(sid, std::move(instance));
   m_playerStorages[ownerId].push_back(id);
 
   return id;
 }
 
 bool StorageSystem::deleteStorage(const std::string &storageId) {
-  auto it = m_storages.find(storageId);
-  if (it == m_storages.end()) {
+  StorageInstance *storage = findStorage(storageId);
+  if (!storage) {
     return false;
   }
 
-  std::string ownerId = it->second.ownerId;
-  m_storages.erase(it);
+  std::string ownerId = storage->ownerId;
+  m_storages.erase(storage->sid);
 
   auto &playerList = m_playerStorages[ownerId];
   auto pit = std::find(playerList.begin(), playerList.end(), storageId);
@@ -226,12 +244,12 @@ bool StorageSystem::deleteStorage(const std::string &storageId) {
 int32_t StorageSystem::addResourceToStorage(
     const std::string &storageId, const std::string &playerId,
     Resources::ResourceType resourceType, int32_t amount) {
-  auto storageIt = m_storages.find(storageId);
-  if (storageIt == m_storages.end()) {
+  StorageInstance *storagePtr = findStorage(storageId);
+  if (!storagePtr) {
     return 0;
   }
 
-  StorageInstance &storage = storageIt->second;
+  StorageInstance &storage = *storagePtr;
   const StorageConfig *config = getStorageConfig(storage.type);
   if (!config) {
     std::cout << "StorageSystem: Config not found for type "
@@ -246,10 +264,8 @@ int32_t StorageSystem::addResourceToStorage(
 
   const Resources::Resource *resourceInfo = nullptr;
 
-  // Debug logging for addResourceToStorage
-  std::cout << "[StorageSystem] Adding " << amount << " of type "
-            << (int)resourceType << " to " << storageId << " by " << playerId
-            << std::endl;
+  LOG_DBG(Storage, "Adding ", amount, " of type ", (int)resourceType, " to ",
+          storageId, " by ", playerId);
 
   int32_t remaining = amount;
   int32_t addedTotal = 0;
@@ -290,23 +306,19 @@ int32_t StorageSystem::addResourceToStorage(
     updateStorageState(storage);
 
     ItemAddedToStorageEvent event;
-    event.storageId = storageId;
+    event.storageId = storage.sid;
     event.resourceType = resourceType;
     event.amount = addedTotal;
-    event.playerId = playerId;
-    event.amount = addedTotal;
-    event.playerId = playerId;
+    event.playerId = StringId::of(playerId);
     EventBus::send(event);
   }
 
   if (addedTotal == 0) {
     // Failed to add resource (Full or no suitable slots)
-    std::cout << "[StorageSystem] Failed to add any resource. Storage might be "
-                 "full or incompatible."
-              << std::endl;
+    LOG_DBG(Storage,
+            "Failed to add any resource. Storage might be full or incompatible.");
   } else {
-    std::cout << "[StorageSystem] Successfully added " << addedTotal
-              << " items." << std::endl;
+    LOG_DBG(Storage, "Successfully added ", addedTotal, " items.");
   }
   return addedTotal;
 }
@@ -314,12 +326,12 @@ int32_t StorageSystem::addResourceToStorage(
 int32_t StorageSystem::removeResourceFromStorage(
     const std::string &storageId, const std::string &playerId,
     Resources::ResourceType resourceType, int32_t amount) {
-  auto storageIt = m_storages.find(storageId);
-  if (storageIt == m_storages.end()) {
+  StorageInstance *storagePtr = findStorage(storageId);
+  if (!storagePtr) {
     return 0;
   }
 
-  StorageInstance &storage = storageIt->second;
+  StorageInstance &storage = *storagePtr;
 
   int32_t remaining = amount;
   int32_t removedTotal = 0;
@@ -340,12 +352,10 @@ int32_t StorageSystem::removeResourceFromStorage(
     updateStorageState(storage);
 
     ItemRemovedFromStorageEvent event;
-    event.storageId = storageId;
+    event.storageId = storage.sid;
     event.resourceType = resourceType;
     event.amount = removedTotal;
-    event.playerId = playerId;
-    event.amount = removedTotal;
-    event.playerId = playerId;
+    event.playerId = StringId::of(playerId);
     EventBus::send(event);
   }
 
@@ -355,6 +365,15 @@ int32_t StorageSystem::removeResourceFromStorage(
 int32_t
 StorageSystem::getResourceAmount(const std::string &storageId,
                                  Resources::ResourceType resourceType) const {
+  const StorageInstance *storage = findStorage(storageId);
+  if (!storage)
+    return 0;
+  return getResourceAmount(storage->sid, resourceType);
+}
+
+int32_t
+StorageSystem::getResourceAmount(StringId storageId,
+                                 Resources::ResourceType resourceType) const {
   auto it = m_storages.find(storageId);
   if (it == m_storages.end())
     return 0;
@@ -379,11 +398,11 @@ StorageSystem::getResourceAmount(const std::string &storageId,
 std::unordered_map<Resources::ResourceType, int32_t>
 StorageSystem::getAllResources(const std::string &storageId) const {
   std::unordered_map<Resources::ResourceType, int32_t> resources;
-  auto it = m_storages.find(storageId);
-  if (it == m_storages.end())
+  const StorageInstance *storage = findStorage(storageId);
+  if (!storage)
     return resources;
 
-  for (const auto &slot : it->second.slots) {
+  for (const auto &slot : storage->slots) {
     if (slot.isOccupied) {
       resources[slot.resourceType] += slot.amount;
     }
@@ -394,11 +413,11 @@ StorageSystem::getAllResources(const std::string &storageId) const {
 bool StorageSystem::canAddResource(const std::string &storageId,
                                    Resources::ResourceType resourceType,
                                    int32_t amount) const {
-  auto it = m_storages.find(storageId);
-  if (it == m_storages.end())
+  const StorageInstance *storage = findStorage(storageId);
+  if (!storage)
     return false;
 
-  return it->second.canAddResource(resourceType, amount, nullptr);
+  return storage->canAddResource(resourceType, amount, nullptr);
 }
 
 // Implement addItemToStorage
@@ -453,6 +472,25 @@ bool StorageSystem::addItemToStorage(const std::string &storageId,
 
 StorageSystem::StorageInstance *
 StorageSystem::getStorage(const std::string &storageId) const {
+  return findStorage(storageId);
+}
+
+StorageSystem::StorageInstance *
+StorageSystem::findStorage(const std::string &storageId) const {
+  auto it = m_storages.find(StringId::of(storageId));
+  if (it == m_storages.end())
+    return nullptr;
+  // Ten sam 32-bitowy skrót, inna nazwa - kolizja albo nieaktualne id
+  if (it->second.id != storageId) {
+    LOG_ERR(Storage, "StringId collision: '", storageId,
+            "' resolves to storage '", it->second.id, "'");
+    return nullptr;
+  }
+  return const_cast<StorageInstance *>(&it->second);
+}
+
+StorageSystem::StorageInstance *
+StorageSystem::getStorage(StringId storageId) const {
   auto it = m_storages.find(storageId);
   if (it != m_storages.end()) {
     return const_cast<StorageInstance *>(&it->second);
@@ -470,11 +508,11 @@ StorageSystem::getPlayerStorages(const std::string &playerId) const {
 }
 
 bool StorageSystem::optimizeStorageLayout(const std::string &storageId) {
-  auto it = m_storages.find(storageId);
-  if (it == m_storages.end())
+  StorageInstance *storagePtr = findStorage(storageId);
+  if (!storagePtr)
     return false;
 
-  StorageInstance &storage = it->second;
+  StorageInstance &storage = *storagePtr;
   const StorageConfig *config = getStorageConfig(storage.type);
   if (!config || !config->isStackable)
     return false;
@@ -613,9 +651,8 @@ StorageSystem::addResourceToSlot(StorageInstance &storage, int32_t slotIndex,
   int32_t canAdd = maxCap - slot.amount;
   int32_t toAdd = std::min(canAdd, amount);
 
-  std::cout << "[StorageSystem] Slot " << slotIndex
-            << ": Current=" << slot.amount << " Max=" << maxCap
-            << " Adding=" << toAdd << std::endl;
+  LOG_DBG(Storage, "Slot ", slotIndex, ": Current=", slot.amount,
+          " Max=", maxCap, " Adding=", toAdd);
 
   slot.amount += toAdd;
   return toAdd;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../core/GameEngine.h"
+#include "../core/StringId.h"
 #include "ResourceSystem.h"
 #include <any>
 #include <atomic>
@@ -66,22 +67,22 @@ struct StorageStateChangedEvent {
  * @brief Zdarzenie dodania przedmiotu do magazynu
  */
 struct ItemAddedToStorageEvent {
-  std::string storageId;
+  StringId storageId; // symbole zamiast std::string - zdarzenie bez alokacji
   Resources::ResourceType resourceType;
   int32_t amount;
-  int32_t slotIndex;
-  std::string playerId;
+  int32_t slotIndex = -1;
+  StringId playerId;
 };
 
 /**
  * @brief Zdarzenie usunięcia przedmiotu z magazynu
  */
 struct ItemRemovedFromStorageEvent {
-  std::string storageId;
+  StringId storageId; // symbole zamiast std::string - zdarzenie bez alokacji
   Resources::ResourceType resourceType;
   int32_t amount;
-  int32_t slotIndex;
-  std::string playerId;
+  int32_t slotIndex = -1;
+  StringId playerId;
 };
 
 /**
@@ -123,6 +124,7 @@ public:
    */
   struct StorageInstance {
     std::string id;
+    StringId sid; // Zinternowane id - klucz w m_storages
     StorageType type;
     std::string ownerId; // ID właściciela
     StorageState state;
@@ -277,6 +279,7 @@ public:
   // IGameSystem interface
   void initialize() override;
   void update(float deltaTime) override;
+  void declareAccess(SystemAccess &access) const override;
   void render() override;
   void shutdown() override;
   std::string getName() const override { return m_name; }
@@ -298,6 +301,8 @@ public:
 
   int32_t getResourceAmount(const std::string &storageId,
                             Resources::ResourceType resourceType) const;
+  int32_t getResourceAmount(StringId storageId,
+                            Resources::ResourceType resourceType) const;
   std::unordered_map<Resources::ResourceType, int32_t>
   getAllResources(const std::string &storageId) const;
   bool canAddResource(const std::string &storageId,
@@ -309,6 +314,7 @@ public:
                         int amount);
 
   StorageInstance *getStorage(const std::string &storageId) const;
+  StorageInstance *getStorage(StringId storageId) const;
   std::vector<std::string> getPlayerStorages(const std::string &playerId) const;
   bool optimizeStorageLayout(const std::string &storageId);
   void lazyLoadStorage(const std::string &storageId);
@@ -326,6 +332,8 @@ public:
   StorageSystemStats getStats() const;
 
 private:
+  // Wyszukanie po nazwie ze sprawdzeniem zapisanego id (kolizje skrótów)
+  StorageInstance *findStorage(const std::string &storageId) const;
   void initializeBaseStorageTypes();
   void updateStorageState(StorageInstance &storage);
   int32_t findSlotForResource(StorageInstance &storage,
@@ -373,7 +381,8 @@ private:
 private:
   std::string m_name;
   std::unordered_map<StorageType, StorageConfig> m_storageTypes;
-  std::unordered_map<std::string, StorageInstance> m_storages;
+  // Klucz to symbol id magazynu - wyszukiwanie bez hashowania/porównań stringów
+  std::unordered_map<StringId, StorageInstance, StringIdHash> m_storages;
   std::unordered_map<std::string, std::vector<std::string>> m_playerStorages;
   StorageCache m_cache;
 
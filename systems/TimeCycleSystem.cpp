@@ -41,6 +41,10 @@ void TimeCycleSystem::update(float deltaTime) {
     }
 }
 
+void TimeCycleSystem::declareAccess(SystemAccess& access) const {
+    access.write<TimeCycleSystem>();
+}
+
 void TimeCycleSystem::render() {
     // Rendering handled by main loop using getters
 }
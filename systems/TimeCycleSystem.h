@@ -12,6 +12,7 @@ public:
 
     void initialize() override;
     void update(float deltaTime) override;
+    void declareAccess(SystemAccess& access) const override;
     void render() override;
     void shutdown() override {}
     std::string getName() const override { return "TimeCycleSystem"; }
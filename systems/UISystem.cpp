@@ -9,6 +9,7 @@
 #include "../systems/InteractionSystem.h"
 
 #include "../game/Colony.h"
+#include "../game/WorldOverlay.h"
 #include <iostream>
 
 
@@ -163,6 +164,98 @@ elements[i]->position.height = cellHeight - 10.0f;
 
 }
 
+}
+void UISystem::UILayoutManager::setLayout(LayoutType layoutType, const Vector2& containerSize) {
+    m_layoutType = layoutType;
+    m_containerSize = containerSize;
+    m_dirty = true;
+}
+
+bool UISystem::UILayoutManager::update(SlotMap<UIElement>& store, const std::vector<UIElementHandle>& handles, const Vector2& screenSize) {
+    if (!m_dirty && screenSize.x == m_screenSize.x && screenSize.y == m_screenSize.y) {
+        return false;
+    }
+
+    m_scratch.clear();
+    for (UIElementHandle handle : handles) {
+        if (UIElement* element = store.get(handle)) {
+            m_scratch.push_back(element);
+        }
+    }
+    bool fullScreen = m_containerSize.x <= 0.0f || m_containerSize.y <= 0.0f;
+    applyLayout(m_scratch, m_layoutType, fullScreen ? screenSize : m_containerSize);
+    makeResponsive(m_scratch, screenSize);
+
+    m_screenSize = screenSize;
+    m_dirty = false;
+    return true;
+}
+
+// ==========================================
+
+// UIHitGrid Implementation
+
+// ==========================================
+void UISystem::UIHitGrid::rebuild(const SlotMap<UIElement>& store, const std::vector<UIElementHandle>& handles, const Vector2& screenSize) {
+    m_cols = std::max(1, (int)ceilf(screenSize.x / CELL_SIZE));
+    m_rows = std::max(1, (int)ceilf(screenSize.y / CELL_SIZE));
+    size_t cellCount = (size_t)m_cols * (size_t)m_rows;
+
+    // Zakres komórek elementu przycięty do ekranu; false = poza ekranem
+    auto cellRange = [&](const UIPosition& pos, int& c0, int& r0, int& c1, int& r1) {
+        c0 = std::max(0, (int)floorf(pos.x / CELL_SIZE));
+        r0 = std::max(0, (int)floorf(pos.y / CELL_SIZE));
+        c1 = std::min(m_cols - 1, (int)floorf((pos.x + pos.width) / CELL_SIZE));
+        r1 = std::min(m_rows - 1, (int)floorf((pos.y + pos.height) / CELL_SIZE));
+        return pos.width > 0.0f && pos.height > 0.0f && c0 <= c1 && r0 <= r1;
+    };
+
+    // Dwa przejścia: zliczenie na komórkę, potem wpisy w jednej tablicy
+    m_cellStart.assign(cellCount + 1, 0);
+    int c0, r0, c1, r1;
+    for (UIElementHandle handle : handles) {
+        const UIElement* element = store.get(handle);
+        if (!element || !cellRange(element->position, c0, r0, c1, r1)) continue;
+        for (int r = r0; r <= r1; ++r)
+            for (int c = c0; c <= c1; ++c)
+                m_cellStart[(size_t)r * m_cols + c + 1]++;
+    }
+    for (size_t i = 1; i <= cellCount; ++i) {
+        m_cellStart[i] += m_cellStart[i - 1];
+    }
+
+    m_entries.assign(m_cellStart[cellCount], UIElementHandle());
+    std::vector<uint32_t> fill(m_cellStart.begin(), m_cellStart.end() - 1);
+    for (UIElementHandle handle : handles) {
+        const UIElement* element = store.get(handle);
+        if (!element || !cellRange(element->position, c0, r0, c1, r1)) continue;
+        for (int r = r0; r <= r1; ++r)
+            for (int c = c0; c <= c1; ++c)
+                m_entries[fill[(size_t)r * m_cols + c]++] = handle;
+    }
+}
+
+UIElementHandle UISystem::UIHitGrid::hitTest(const SlotMap<UIElement>& store, float x, float y) const {
+    UIElementHandle hit;
+    if (x < 0.0f || y < 0.0f || m_cols == 0) return hit;
+    int col = (int)(x / CELL_SIZE);
+    int row = (int)(y / CELL_SIZE);
+    if (col >= m_cols || row >= m_rows) return hit;
+
+    size_t cell = (size_t)row * m_cols + col;
+    int bestZ = 0;
+    for (uint32_t i = m_cellStart[cell]; i < m_cellStart[cell + 1]; ++i) {
+        const UIElement* element = store.get(m_entries[i]);
+        if (!element || !element->isVisible() || element->state == UIState::HIDDEN) continue;
+        const UIPosition& pos = element->position;
+        if (x < pos.x || x > pos.x + pos.width || y < pos.y || y > pos.y + pos.height) continue;
+        // Wpisy w kolejności rysowania - przy równym zIndex wygrywa późniejszy
+        if (!hit.isValid() || pos.zIndex >= bestZ) {
+            hit = m_entries[i];
+            bestZ = pos.zIndex;
+        }
+    }
+    return hit;
 }
 // ==========================================
 
@@ -175,7 +268,6 @@ m_cacheHits(0),
 m_cacheMisses(0),
 m_totalRenderTime(0),
 m_interactionCount(0),
-m_nextUIElementId(1),
 m_activeSelectionTab(0),
 m_selectedInventorySlot(-1),
 m_selectedBuilding(nullptr),
@@ -203,9 +295,20 @@ void UISystem::initialize() {
 void UISystem::update(float deltaTime) {
     m_uiAnimationTime += deltaTime;
     updateUIAnimations(deltaTime);
-    m_cache.cleanup();
+
+    // Układy tylko po zmianach elementów albo ekranu
+    for (PlayerUI& player : m_players) {
+        refreshPlayerLayout(player);
+    }
+}
+void UISystem::declareAccess(SystemAccess& access) const {
+    // Stan UI i raylib - tylko wątek główny
+    access.mainThread();
 }
 void UISystem::render() {
+    CachedPanel::beginFrame();
+    GlyphRunCache::getInstance().beginFrame();
+
     int sw = GetScreenWidth();
     int sh = GetScreenHeight();
 
@@ -241,8 +344,8 @@ void UISystem::render() {
     }
 
     // Existing render logic for player UI components
-    for (const auto& playerPair : m_playerUIElements) {
-        renderPlayerUI(playerPair.first);
+    for (const PlayerUI& player : m_players) {
+        renderPlayerUI(player);
     }
 
     if (m_isCraftingPanelVisible) {
@@ -262,8 +365,12 @@ void UISystem::shutdown() {
         UnloadTexture(m_iconsTexture);
         m_isIconsLoaded = false;
     }
+    m_resourceBarPanel.unload();
+    m_colonyStatsPanel.unload();
 
-    m_playerUIElements.clear();
+    m_elements.clear();
+    m_players.clear();
+    m_playerIndex.clear();
     m_uiElementTypes.clear();
     std::cout << "UISystem shutdown." << std::endl;
 }
@@ -280,229 +387,204 @@ m_uiElementTypes.emplace(config.type, config);
 return true;
 
 }
-std::string UISystem::createUIElement(UIElementType type, const std::string& playerId, const UIPosition& position) {
-
-std::string id = generateUIElementId();
-
-UIElement element = UIFactory::createUIElement(type, playerId, position);
-
-element.id = id;
-
-m_playerUIElements[playerId][id] = std::move(element);
-
-m_playerElementIds[playerId].push_back(id);
+UIElementHandle UISystem::createUIElement(UIElementType type, const std::string& playerId, const UIPosition& position) {
+    PlayerUI& player = getOrCreatePlayer(playerId);
 
-return id;
+    UIElement element = UIFactory::createUIElement(type, playerId, position);
+    element.player = (uint32_t)(&player - m_players.data());
+    element.playerSlot = (uint32_t)player.elements.size();
 
+    UIElementHandle handle = m_elements.insert(std::move(element));
+    m_elements.get(handle)->handle = handle;
+    player.elements.push_back(handle);
+    player.layout.invalidate();
+    return handle;
 }
-bool UISystem::deleteUIElement(const std::string& elementId, const std::string& playerId) {
 
-auto& playerElements = m_playerUIElements[playerId];
-
-auto it = playerElements.find(elementId);
-
-if (it != playerElements.end()) {
-
-playerElements.erase(it);
-
-auto& ids = m_playerElementIds[playerId];
-
-auto idIt = std::find(ids.begin(), ids.end(), elementId);
-
-if (idIt != ids.end()) {
-
-ids.erase(idIt);
-
-}
-
-return true;
-
-}
-
-return false;
-
-}
-UISystem::UIElement* UISystem::getUIElement(const std::string& elementId, const std::string& playerId) const {
-
-auto playerIt = m_playerUIElements.find(playerId);
-
-if (playerIt != m_playerUIElements.end()) {
-
-auto elemIt = playerIt->second.find(elementId);
-
-if (elemIt != playerIt->second.end()) {
-
-return const_cast<UIElement*>(&elemIt->second);
+bool UISystem::deleteUIElement(UIElementHandle handle) {
+    UIElement* element = m_elements.get(handle);
+    if (!element) {
+        return false;
+    }
 
-}
+    // Lista gracza zachowuje kolejność; pozycja elementu jest znana, więc
+    // bez wyszukiwania - przesuwamy tylko ogon
+    PlayerUI& player = m_players[element->player];
+    uint32_t slot = element->playerSlot;
+    player.elements.erase(player.elements.begin() + slot);
+    for (size_t i = slot; i < player.elements.size(); ++i) {
+        m_elements.get(player.elements[i])->playerSlot = (uint32_t)i;
+    }
+    player.layout.invalidate();
 
+    m_elements.erase(handle);
+    return true;
 }
 
-return nullptr;
-
+UISystem::UIElement* UISystem::getUIElement(UIElementHandle handle) {
+    return m_elements.get(handle);
 }
-std::vector<UISystem::UIElement*> UISystem::getPlayerUIElements(const std::string& playerId) const {
-
-std::vector<UIElement*> elements;
-
-auto playerIt = m_playerUIElements.find(playerId);
-
-if (playerIt != m_playerUIElements.end()) {
-
-for (auto& pair : playerIt->second) {
-
-elements.push_back(const_cast<UIElement*>(&pair.second));
 
+const UISystem::UIElement* UISystem::getUIElement(UIElementHandle handle) const {
+    return m_elements.get(handle);
 }
 
+const std::vector<UIElementHandle>& UISystem::getPlayerUIElements(const std::string& playerId) const {
+    static const std::vector<UIElementHandle> empty;
+    auto it = m_playerIndex.find(playerId);
+    return it != m_playerIndex.end() ? m_players[it->second].elements : empty;
 }
 
-return elements;
-
+bool UISystem::updateUIElementPosition(UIElementHandle handle, const UIPosition& position) {
+    UIElement* element = m_elements.get(handle);
+    if (element) {
+        element->position = position;
+        invalidatePlayerLayout(*element);
+        return true;
+    }
+    return false;
 }
-bool UISystem::updateUIElementPosition(const std::string& elementId, const std::string& playerId, const UIPosition& position) {
-
-UIElement* element = getUIElement(elementId, playerId);
-
-if (element) {
-
-element->position = position;
-
-return true;
 
+bool UISystem::updateUIElementText(UIElementHandle handle, const std::string& text) {
+    UIElement* element = m_elements.get(handle);
+    if (element) {
+        element->text = text;
+        return true;
+    }
+    return false;
 }
 
-return false;
-
+bool UISystem::setUIElementState(UIElementHandle handle, UIState state) {
+    UIElement* element = m_elements.get(handle);
+    if (element) {
+        UIState oldState = element->state;
+        element->state = state;
+        if (oldState != state) {
+            UIStateChangedEvent event;
+            event.elementId = handle;
+            event.oldState = oldState;
+            event.newState = state;
+            event.playerId = m_players[element->player].id;
+            notifyUIEvent(&event);
+        }
+        return true;
+    }
+    return false;
 }
-bool UISystem::updateUIElementText(const std::string& elementId, const std::string& playerId, const std::string& text) {
-
-UIElement* element = getUIElement(elementId, playerId);
-
-if (element) {
-
-element->text = text;
-
-return true;
 
+bool UISystem::addUIElementAnimation(UIElementHandle handle, const UIAnimation& animation) {
+    UIElement* element = m_elements.get(handle);
+    if (!element) {
+        return false;
+    }
+    element->animations.push_back(animation);
+    return true;
 }
 
-return false;
-
+bool UISystem::clearUIElementAnimations(UIElementHandle handle) {
+    UIElement* element = m_elements.get(handle);
+    if (!element) {
+        return false;
+    }
+    element->animations.clear();
+    return true;
 }
-bool UISystem::setUIElementState(const std::string& elementId, const std::string& playerId, UIState state) {
-
-UIElement* element = getUIElement(elementId, playerId);
-
-if (element) {
-
-UIState oldState = element->state;
-
-element->state = state;
-
-if (oldState != state) {
-
-UIStateChangedEvent event;
-
-event.elementId = elementId;
-
-event.oldState = oldState;
-
-event.newState = state;
-
-event.playerId = playerId;
-
-notifyUIEvent(&event);
 
+bool UISystem::setPlayerLayout(const std::string& playerId, UILayoutManager::LayoutType layoutType, const Vector2& containerSize) {
+    getOrCreatePlayer(playerId).layout.setLayout(layoutType, containerSize);
+    return true;
 }
 
-return true;
-
+bool UISystem::createPlayerDashboard(const std::string& playerId) {
+    createUIElement(UIElementType::PANEL, playerId, UIPosition(10, 10, 200, 100));
+    return true;
 }
 
-return false;
-
+void UISystem::updatePlayerUI(const std::string& playerId) {
+    (void)playerId;
 }
-bool UISystem::addUIElementAnimation(const std::string& elementId, const std::string& playerId, const UIAnimation& animation) {
-
-(void)playerId;
-
-m_activeAnimations[elementId].push_back(animation);
 
-return true;
+UIElementHandle UISystem::hitTestUI(const std::string& playerId, float x, float y) {
+    PlayerUI* player = findPlayer(playerId);
+    if (!player) {
+        return UIElementHandle();
+    }
+    refreshPlayerLayout(*player);
+    return player->hitGrid.hitTest(m_elements, x, y);
+}
+
+bool UISystem::handleUIClick(UIElementHandle handle, float clickX, float clickY) {
+    UIElement* element = m_elements.get(handle);
+    if (element && element->isEnabled()) {
+        if (element->onClick) {
+            element->onClick();
+            // onClick mógł dodać/usunąć elementy - wskaźnik nieaktualny
+            element = m_elements.get(handle);
+            if (!element) {
+                return true;
+            }
+        }
 
+        UIClickedEvent event;
+        event.elementId = handle;
+        event.playerId = m_players[element->player].id;
+        event.clickX = clickX;
+        event.clickY = clickY;
+        event.clickTime = std::chrono::high_resolution_clock::now();
+        notifyUIEvent(&event);
+        m_interactionCount++;
+        return true;
+    }
+    return false;
 }
-bool UISystem::clearUIElementAnimations(const std::string& elementId, const std::string& playerId) {
-
-(void)playerId;
-
-m_activeAnimations.erase(elementId);
-
-return true;
 
+bool UISystem::handleUIClickAt(const std::string& playerId, float clickX, float clickY) {
+    UIElementHandle handle = hitTestUI(playerId, clickX, clickY);
+    return handle.isValid() && handleUIClick(handle, clickX, clickY);
 }
-bool UISystem::createPlayerDashboard(const std::string& playerId) {
-
-createUIElement(UIElementType::PANEL, playerId, UIPosition(10, 10, 200, 100));
-
-return true;
 
+UISystem::PlayerUI* UISystem::findPlayer(const std::string& playerId) {
+    auto it = m_playerIndex.find(playerId);
+    return it != m_playerIndex.end() ? &m_players[it->second] : nullptr;
 }
-void UISystem::updatePlayerUI(const std::string& playerId) {
-
-(void)playerId;
 
+UISystem::PlayerUI& UISystem::getOrCreatePlayer(const std::string& playerId) {
+    auto it = m_playerIndex.find(playerId);
+    if (it != m_playerIndex.end()) {
+        return m_players[it->second];
+    }
+    m_playerIndex.emplace(playerId, (uint32_t)m_players.size());
+    m_players.emplace_back();
+    m_players.back().id = playerId;
+    return m_players.back();
 }
-bool UISystem::handleUIClick(const std::string& elementId, const std::string& playerId, float clickX, float clickY) {
-
-UIElement* element = getUIElement(elementId, playerId);
-
-if (element && element->isEnabled()) {
-
-if (element->onClick) {
-
-element->onClick();
 
+void UISystem::refreshPlayerLayout(PlayerUI& player) {
+    Vector2 screenSize = { (float)GetScreenWidth(), (float)GetScreenHeight() };
+    if (player.layout.update(m_elements, player.elements, screenSize)) {
+        player.hitGrid.rebuild(m_elements, player.elements, screenSize);
+    }
 }
 
-UIClickedEvent event;
-
-event.elementId = elementId;
-
-event.playerId = playerId;
-
-event.clickX = clickX;
-
-event.clickY = clickY;
-
-event.clickTime = std::chrono::high_resolution_clock::now();
-
-notifyUIEvent(&event);
-
-m_interactionCount++;
-
-return true;
-
+void UISystem::invalidatePlayerLayout(const UIElement& element) {
+    m_players[element.player].layout.invalidate();
 }
 
-return false;
-
-}
 UISystem::UISystemStats UISystem::getStats() const {
 
 UISystemStats stats;
 
 stats.totalUIElementTypes = m_uiElementTypes.size();
 
-stats.totalUIElements = 0;
+stats.totalUIElements = m_elements.size();
 
-for (const auto& pair : m_playerUIElements) {
+stats.totalAnimations = 0;
 
-stats.totalUIElements += pair.second.size();
+for (const UIElement& element : m_elements) {
 
-}
+stats.totalAnimations += element.animations.size();
 
-stats.totalAnimations = 0;
+}
 
 stats.cacheHits = m_cacheHits;
 
@@ -523,28 +605,19 @@ m_uiElementTypes[pair.first] = pair.second;
 
 }
 
-}
-std::string UISystem::generateUIElementId() {
-
-return "ui_" + std::to_string(m_nextUIElementId++);
-
 }
 void UISystem::updateUIAnimations(double deltaTime) {
 
 (void)deltaTime;
 
 }
-void UISystem::renderPlayerUI(const std::string& playerId) {
-
-auto it = m_playerUIElements.find(playerId);
+void UISystem::renderPlayerUI(const PlayerUI& player) {
 
-if (it != m_playerUIElements.end()) {
+for (UIElementHandle handle : player.elements) {
 
-for (const auto& pair : it->second) {
+const UIElement* element = m_elements.get(handle);
 
-const UIElement& element = pair.second;
-
-if (element.isVisible()) {
+if (element && element->isVisible()) {
 
 // Rendering logic
 
@@ -552,8 +625,6 @@ if (element.isVisible()) {
 
 }
 
-}
-
 }
 void UISystem::lazyLoadPlayerUI(const std::string& playerId) {
 
@@ -884,6 +955,12 @@ bool UISystem::IsMouseOverUI() {
         if (CheckCollisionPointRec(mouse, rec)) return true;
     }
 
+    // 7. Retained elements (siatka trafień graczy)
+    for (PlayerUI& player : m_players) {
+        refreshPlayerLayout(player);
+        if (player.hitGrid.hitTest(m_elements, mouse.x, mouse.y).isValid()) return true;
+    }
+
     return false;
 }
 void UISystem::DrawSelectionInfo(const std::vector<Settler*>& selectedSettlers, int screenWidth, int screenHeight) {
@@ -1133,79 +1210,63 @@ if (selectedSettlers.size() == 1) {
 }
 void UISystem::DrawSettlerOverheadUI(const Settler& settler, const Camera& camera) {
 
+(void)camera; // rzut i odrzucanie w WorldOverlay::flush
+
 Vector3 headPos = settler.getPosition();
 
 headPos.y += 2.5f;
 
-Vector3 toPoint = Vector3Subtract(headPos, camera.position);
-
-Vector3 camForward = Vector3Subtract(camera.target, camera.position);
-
-if (Vector3DotProduct(toPoint, camForward) > 0.0f) {
-
-    Vector2 screenPos = GetWorldToScreen(headPos, camera);
-
-    int screenWidth = GetScreenWidth();
-
-    int screenHeight = GetScreenHeight();
-
-    if (screenPos.x >= -100 && screenPos.x <= screenWidth + 100 &&
-        screenPos.y >= -100 && screenPos.y <= screenHeight + 100) {
-        
-        int panelW = 100;
-        int panelH = 50;
-        int startX = (int)screenPos.x - panelW / 2;
-        int startY = (int)screenPos.y - panelH;
-        
-        DrawRectangle(startX, startY, panelW, panelH, Color{ 0, 0, 0, 180 });
-        DrawRectangleLines(startX, startY, panelW, panelH, GRAY);
-        
-        const auto& stats = settler.getStats();
-        float hpPct = 0.0f;
-        if (stats.getMaxHealth() > 0) hpPct = stats.getCurrentHealth() / stats.getMaxHealth();
-        float enPct = 0.0f;
-        if (stats.getMaxEnergy() > 0) enPct = stats.getCurrentEnergy() / stats.getMaxEnergy();
-        
-        DrawRectangle(startX + 4, startY + 4, panelW - 8, 6, RED);
-        DrawRectangle(startX + 4, startY + 4, (int)((panelW - 8) * hpPct), 6, GREEN);
-        
-   DrawRectangle(startX + 4, startY + 12, panelW - 8, 4, DARKGRAY);
-   DrawRectangle(startX + 4, startY + 12, (int)((panelW - 8) * enPct), 4, BLUE);
-        // Pasek postępu craftingu
-        if (settler.getState() == SettlerState::CRAFTING) {
-            float craftPct = settler.GetCraftingProgress01();
-            DrawRectangle(startX + 4, startY + 20, panelW - 8, 4, DARKGRAY);
-            DrawRectangle(startX + 4, startY + 20, (int)((panelW - 8) * craftPct), 4, MAGENTA);
-        }
-        std::string topSkillName = "Settler";
-        int maxLevel = 0;
-        const auto& skillsComp = settler.getSkills();
-        const auto& skillsMap = skillsComp.getAllSkills();
-        for (const auto& pair : skillsMap) {
-            if (pair.second.level > maxLevel) {
-                maxLevel = pair.second.level;
-                topSkillName = pair.second.name;
-            }
-        }
-        
-        std::string displayText = topSkillName;
-        if (maxLevel > 1) {
-            displayText += " (Lvl " + std::to_string(maxLevel) + ")";
-        }
-        int textW = MeasureText(displayText.c_str(), 10);
-        DrawText(displayText.c_str(), startX + (panelW - textW) / 2, startY + 22, 10, WHITE);
+// Panel nad głową zaczepiony w punkcie świata - margines 100 px jak dotąd
+WorldOverlay& overlay = WorldOverlay::getInstance();
+WorldOverlay::Anchor anchor = overlay.anchor(headPos, 100.0f, true);
+
+const float panelW = 100.0f;
+const float panelH = 50.0f;
+const float startX = -panelW / 2;
+const float startY = -panelH;
+
+overlay.rect(anchor, { startX, startY, panelW, panelH }, Color{ 0, 0, 0, 180 });
+overlay.rectLines(anchor, { startX, startY, panelW, panelH }, 1.0f, GRAY);
+
+const auto& stats = settler.getStats();
+float hpPct = 0.0f;
+if (stats.getMaxHealth() > 0) hpPct = stats.getCurrentHealth() / stats.getMaxHealth();
+float enPct = 0.0f;
+if (stats.getMaxEnergy() > 0) enPct = stats.getCurrentEnergy() / stats.getMaxEnergy();
+
+overlay.rect(anchor, { startX + 4, startY + 4, panelW - 8, 6 }, RED);
+overlay.rect(anchor, { startX + 4, startY + 4, floorf((panelW - 8) * hpPct), 6 }, GREEN);
+
+overlay.rect(anchor, { startX + 4, startY + 12, panelW - 8, 4 }, DARKGRAY);
+overlay.rect(anchor, { startX + 4, startY + 12, floorf((panelW - 8) * enPct), 4 }, BLUE);
+// Pasek postępu craftingu
+if (settler.getState() == SettlerState::CRAFTING) {
+    float craftPct = settler.GetCraftingProgress01();
+    overlay.rect(anchor, { startX + 4, startY + 20, panelW - 8, 4 }, DARKGRAY);
+    overlay.rect(anchor, { startX + 4, startY + 20, floorf((panelW - 8) * craftPct), 4 }, MAGENTA);
+}
+std::string topSkillName = "Settler";
+int maxLevel = 0;
+const auto& skillsComp = settler.getSkills();
+const auto& skillsMap = skillsComp.getAllSkills();
+for (const auto& pair : skillsMap) {
+    if (pair.second.level > maxLevel) {
+        maxLevel = pair.second.level;
+        topSkillName = pair.second.name;
     }
-
 }
 
+std::string displayText = topSkillName;
+if (maxLevel > 1) {
+    displayText += " (Lvl " + std::to_string(maxLevel) + ")";
+}
+// Etykiet jest tyle, ile kombinacji umiejętność/poziom - układ z cache
+int textW = GlyphRunCache::getInstance().measure(displayText, 10);
+overlay.text(anchor, displayText, startX + ((int)panelW - textW) / 2, startY + 22, 10, WHITE);
 
 }
 void UISystem::DrawSettlerStatsOverlay(const std::vector<Settler*>& settlers, Camera3D camera, int screenWidth, int screenHeight) {
 
-(void)screenWidth;
-
-(void)screenHeight;
-
 for (const auto& settler : settlers) {
 
 if (settler) {
@@ -1216,6 +1277,9 @@ DrawSettlerOverheadUI(*settler, camera);
 
 }
 
+// Wszystkie panele jednym wsadem
+WorldOverlay::getInstance().flush(camera, screenWidth, screenHeight);
+
 }
 void UISystem::DrawSettlersStatsPanel(const std::vector<Settler*>& settlers, int screenWidth, int screenHeight) {
 
@@ -1253,7 +1317,7 @@ for (const auto& settler : settlers) {
 
         Color textColor = settler->isSelected() ? GREEN : WHITE;
 
-        DrawText(text.c_str(), x + 10, rowY, 10, textColor);
+        GlyphRunCache::getInstance().draw(text, x + 10, rowY, 10, textColor);
 
         rowY += 20;
 
@@ -1461,6 +1525,7 @@ void UISystem::DrawPremiumResourceBar(int wood, int food, int stone, int populat
     float moduleW = 160.0f;
     float moduleH = 70.0f;
     float gap = 15.0f;
+    float popX = startX + (moduleW + gap) * 3 + gap * 2;
 
     auto DrawCommandModule = [&](const char* code, int val, Color col, int iconIdx, float x) {
         Rectangle rec = { x, startY, moduleW, moduleH };
@@ -1485,26 +1550,36 @@ void UISystem::DrawPremiumResourceBar(int wood, int food, int stone, int populat
 
         // Numerical Data
         DrawText(TextFormat("%d", val), (int)rec.x + 60, (int)rec.y + 22, 32, WHITE);
-        // Micro-Status
-        DrawCircle((int)rec.x + moduleW - 15, (int)rec.y + 10, 3, (sinf(m_uiAnimationTime * 5.0f + x) > 0) ? col : Fade(col, 0.2f));
     };
 
-    DrawCommandModule("MAT_WOOD", wood, COLOR_NEON_TEAL, 0, startX);
-    DrawCommandModule("MAT_FOOD", food, COLOR_NEON_GOLD, 1, startX + moduleW + gap);
-    DrawCommandModule("MAT_STONE", stone, GRAY, 2, startX + (moduleW + gap) * 2);
-    
-    // Population Module (Different shape)
-    float popX = startX + (moduleW + gap) * 3 + gap * 2;
-    Rectangle popRec = { popX, startY, moduleW + 40, moduleH };
-    DrawRectangleRec(popRec, { 20, 25, 35, 230 });
-    DrawRectangleLinesEx(popRec, 2.0f, COLOR_NEON_ORANGE);
-    DrawText("COLONY_POPULATION", (int)popRec.x + 10, (int)popRec.y + 6, 9, COLOR_NEON_ORANGE);
-    
-    DrawText(TextFormat("%d", population), (int)popRec.x + 60, (int)popRec.y + 22, 42, WHITE);
-    if (m_isIconsLoaded) {
-        float iSize = (float)m_iconsTexture.width / 4.0f;
-        Rectangle src = { 0, 2 * iSize, iSize, iSize }; // Population icon index 8 (col 0, row 2)
-        DrawTexturePro(m_iconsTexture, src, { popRec.x + 10, popRec.y + 25, 40, 40 }, {0,0}, 0, COLOR_NEON_ORANGE);
+    // Statyczna część paska odświeżana tylko przy zmianie liczb
+    m_resourceBarPanel.setKey(CachedPanel::hashValues({wood, food, stone, population, m_isIconsLoaded}));
+    Rectangle bounds = { startX, startY, popX + moduleW + 40 - startX, moduleH };
+    m_resourceBarPanel.draw(bounds, [&]() {
+        DrawCommandModule("MAT_WOOD", wood, COLOR_NEON_TEAL, 0, startX);
+        DrawCommandModule("MAT_FOOD", food, COLOR_NEON_GOLD, 1, startX + moduleW + gap);
+        DrawCommandModule("MAT_STONE", stone, GRAY, 2, startX + (moduleW + gap) * 2);
+        
+        // Population Module (Different shape)
+        Rectangle popRec = { popX, startY, moduleW + 40, moduleH };
+        DrawRectangleRec(popRec, { 20, 25, 35, 230 });
+        DrawRectangleLinesEx(popRec, 2.0f, COLOR_NEON_ORANGE);
+        DrawText("COLONY_POPULATION", (int)popRec.x + 10, (int)popRec.y + 6, 9, COLOR_NEON_ORANGE);
+        
+        DrawText(TextFormat("%d", population), (int)popRec.x + 60, (int)popRec.y + 22, 42, WHITE);
+        if (m_isIconsLoaded) {
+            float iSize = (float)m_iconsTexture.width / 4.0f;
+            Rectangle src = { 0, 2 * iSize, iSize, iSize }; // Population icon index 8 (col 0, row 2)
+            DrawTexturePro(m_iconsTexture, src, { popRec.x + 10, popRec.y + 25, 40, 40 }, {0,0}, 0, COLOR_NEON_ORANGE);
+        }
+    });
+
+    // Micro-Status - animowane, rysowane co klatkę na wierzchu
+    const Color moduleColors[] = { COLOR_NEON_TEAL, COLOR_NEON_GOLD, GRAY };
+    for (int i = 0; i < 3; ++i) {
+        float x = startX + (moduleW + gap) * i;
+        Color col = moduleColors[i];
+        DrawCircle((int)x + moduleW - 15, (int)startY + 10, 3, (sinf(m_uiAnimationTime * 5.0f + x) > 0) ? col : Fade(col, 0.2f));
     }
 }
 
@@ -1762,106 +1837,110 @@ void UISystem::DrawColonyStatsPanel(int screenWidth) {
     float xPos = 50; // Left margin
     float yPos = (screenHeight - height) / 2.0f; // Vertical center
     Rectangle rec = { xPos, yPos, width, height };
-    
-    
-    // Use unified DrawPremiumPanel for consistency
-    DrawPremiumPanel(rec, "COLONY OVERVIEW", 1.0f);
-    
-    
-    int startY = (int)rec.y + 80;
-    int sectionGap = 70;
-    
-    // === POPULATION SECTION ===
-    DrawRectangle((int)rec.x + 15, startY - 5, (int)width - 30, 60, { 20, 30, 40, 180 });
-    DrawText("POPULATION", (int)rec.x + 30, startY + 5, 16, LIGHTGRAY);
+
     int population = (int)m_colony->getSettlers().size();
-    DrawText(TextFormat("%d", population), (int)rec.x + 30, startY + 28, 36, WHITE);
-    DrawText("settlers", (int)rec.x + 120, startY + 38, 18, GRAY);
-    
-    // Population Icon
-    Rectangle popIconRec = { (float)rec.x + width - 70.0f, (float)startY + 10.0f, 48.0f, 48.0f };
-    DrawRectangleRounded(popIconRec, 0.3f, 8, { 30, 40, 50, 200 });
-    DrawRectangleRoundedLinesEx(popIconRec, 0.3f, 8, 2.0f, COLOR_NEON_TEAL);
-    if (m_isIconsLoaded) {
-        float texW = static_cast<float>(m_iconsTexture.width); 
-        float texH = static_cast<float>(m_iconsTexture.height);
-        float iW = texW / 4.0f; float iH = texH / 4.0f;
-        Rectangle srcRec = { static_cast<float>(8 % 4) * iW, static_cast<float>(8 / 4) * iH, iW, iH };
-        DrawTexturePro(m_iconsTexture, srcRec, { popIconRec.x + 8, popIconRec.y + 8, 32, 32 }, { 0, 0 }, 0.0f, WHITE);
-    } else {
-        DrawText("@", (int)popIconRec.x + 15, (int)popIconRec.y + 10, 24, WHITE);
-    }
-    
-    startY += sectionGap;
-    
-    // === RESOURCES SECTION ===
-    DrawText("RESOURCES", (int)rec.x + 30, startY, 18, COLOR_NEON_GOLD);
-    startY += 35;
-    
-    struct ResStat { const char* name; int amount; Color color; int iconIdx; };
-    ResStat stats[] = {
-        {"WOOD",  m_colony->getWood(),  COLOR_NEON_TEAL,   0},
-        {"STONE", m_colony->getStone(), { 200, 200, 200, 255 }, 2},
-        {"FOOD",  m_colony->getFood(),  COLOR_NEON_GOLD,   1}
-    };
-    
-    for (int i = 0; i < 3; ++i) {
-        int rowY = startY + (i * 55);
-        DrawRectangle((int)rec.x + 25, rowY - 5, (int)width - 50, 50, { 45, 55, 65, 100 });
-        
-        // Icon from texture
-        Rectangle iconRec = { rec.x + 35, (float)rowY + 2, 36, 36 };
-        DrawRectangleRounded(iconRec, 0.2f, 5, { 25, 30, 35, 255 });
+    BuildingSystem* buildingSys = GameEngine::getInstance().getSystem<BuildingSystem>();
+    int buildingCount = buildingSys ? (int)buildingSys->getAllBuildings().size() : 0;
+
+    // Panel bez animacji - do tekstury tylko po zmianie liczb
+    m_colonyStatsPanel.setKey(CachedPanel::hashValues({population, m_colony->getWood(), m_colony->getStone(),
+                                                       m_colony->getFood(), buildingCount, m_isIconsLoaded}));
+    m_colonyStatsPanel.draw(rec, [&]() {
+        // Use unified DrawPremiumPanel for consistency
+        DrawPremiumPanel(rec, "COLONY OVERVIEW", 1.0f);
+
+
+        int startY = (int)rec.y + 80;
+        int sectionGap = 70;
+
+        // === POPULATION SECTION ===
+        DrawRectangle((int)rec.x + 15, startY - 5, (int)width - 30, 60, { 20, 30, 40, 180 });
+        DrawText("POPULATION", (int)rec.x + 30, startY + 5, 16, LIGHTGRAY);
+        DrawText(TextFormat("%d", population), (int)rec.x + 30, startY + 28, 36, WHITE);
+        DrawText("settlers", (int)rec.x + 120, startY + 38, 18, GRAY);
+
+        // Population Icon
+        Rectangle popIconRec = { (float)rec.x + width - 70.0f, (float)startY + 10.0f, 48.0f, 48.0f };
+        DrawRectangleRounded(popIconRec, 0.3f, 8, { 30, 40, 50, 200 });
+        DrawRectangleRoundedLinesEx(popIconRec, 0.3f, 8, 2.0f, COLOR_NEON_TEAL);
         if (m_isIconsLoaded) {
             float texW = static_cast<float>(m_iconsTexture.width); 
             float texH = static_cast<float>(m_iconsTexture.height);
             float iW = texW / 4.0f; float iH = texH / 4.0f;
-            Rectangle srcRec = { static_cast<float>(stats[i].iconIdx % 4) * iW, static_cast<float>(stats[i].iconIdx / 4) * iH, iW, iH };
-            DrawTexturePro(m_iconsTexture, srcRec, { iconRec.x + 4, iconRec.y + 4, 28, 28 }, { 0, 0 }, 0.0f, WHITE);
+            Rectangle srcRec = { static_cast<float>(8 % 4) * iW, static_cast<float>(8 / 4) * iH, iW, iH };
+            DrawTexturePro(m_iconsTexture, srcRec, { popIconRec.x + 8, popIconRec.y + 8, 32, 32 }, { 0, 0 }, 0.0f, WHITE);
+        } else {
+            DrawText("@", (int)popIconRec.x + 15, (int)popIconRec.y + 10, 24, WHITE);
         }
-        
-        // Label
-        DrawText(stats[i].name, (int)rec.x + 85, rowY + 2, 18, WHITE);
-        
-        // Amount (BIG and BOLD-looking)
-        DrawText(TextFormat("%d", stats[i].amount), (int)rec.x + 200, rowY, 32, stats[i].color);
-        
-        // Progress Bar (visual representation, max 1000)
-        float barW = 200;
-        float fillRatio = (float)stats[i].amount / 1000.0f;
-        if (fillRatio > 1.0f) fillRatio = 1.0f;
-        
-        Rectangle barBg = { rec.x + 320, (float)rowY + 10, barW, 20 };
-        DrawRectangleRounded(barBg, 0.5f, 10, { 20, 20, 20, 200 });
-        
-        Rectangle barFill = { rec.x + 320, (float)rowY + 10, barW * fillRatio, 20 };
-        DrawRectangleRounded(barFill, 0.5f, 10, stats[i].color);
-        DrawRectangleRoundedLinesEx(barBg, 0.5f, 10, 1.5f, stats[i].color);
-    }
-    
-    startY += 160;
-    
-    // === INFRASTRUCTURE SECTION ===
-    DrawText("INFRASTRUCTURE", (int)rec.x + 30, startY, 18, COLOR_NEON_TEAL);
-    startY += 35;
-    
-    BuildingSystem* buildingSys = GameEngine::getInstance().getSystem<BuildingSystem>();
-    int buildingCount = buildingSys ? (int)buildingSys->getAllBuildings().size() : 0;
-    
-    DrawRectangle((int)rec.x + 25, startY - 5, (int)width - 50, 45, { 30, 40, 50, 180 });
-    
-    // Icon (index 3 for buildings)
-    Rectangle bldIconRec = { rec.x + 35, (float)startY + 2, 36, 36 };
-    DrawRectangleRounded(bldIconRec, 0.2f, 5, { 25, 30, 35, 255 });
-    if (m_isIconsLoaded) {
-        float texW = static_cast<float>(m_iconsTexture.width); 
-        float texH = static_cast<float>(m_iconsTexture.height);
-        Rectangle srcRec = { static_cast<float>(3 % 4) * (texW / 4.0f), static_cast<float>(3 / 4) * (texH / 4.0f), texW / 4.0f, texH / 4.0f };
-        DrawTexturePro(m_iconsTexture, srcRec, { bldIconRec.x + 4, bldIconRec.y + 4, 28, 28 }, { 0, 0 }, 0.0f, WHITE);
-    } else {
-        DrawText("B", (int)bldIconRec.x + 10, (int)bldIconRec.y + 5, 20, COLOR_NEON_GOLD);
-    }
-    
-    DrawText("BUILDINGS", (int)rec.x + 85, startY + 2, 18, WHITE);
-    DrawText(TextFormat("%d", buildingCount), (int)rec.x + 230, startY, 32, COLOR_NEON_GOLD);
+
+        startY += sectionGap;
+
+        // === RESOURCES SECTION ===
+        DrawText("RESOURCES", (int)rec.x + 30, startY, 18, COLOR_NEON_GOLD);
+        startY += 35;
+
+        struct ResStat { const char* name; int amount; Color color; int iconIdx; };
+        ResStat stats[] = {
+            {"WOOD",  m_colony->getWood(),  COLOR_NEON_TEAL,   0},
+            {"STONE", m_colony->getStone(), { 200, 200, 200, 255 }, 2},
+            {"FOOD",  m_colony->getFood(),  COLOR_NEON_GOLD,   1}
+        };
+
+        for (int i = 0; i < 3; ++i) {
+            int rowY = startY + (i * 55);
+            DrawRectangle((int)rec.x + 25, rowY - 5, (int)width - 50, 50, { 45, 55, 65, 100 });
+
+            // Icon from texture
+            Rectangle iconRec = { rec.x + 35, (float)rowY + 2, 36, 36 };
+            DrawRectangleRounded(iconRec, 0.2f, 5, { 25, 30, 35, 255 });
+            if (m_isIconsLoaded) {
+                float texW = static_cast<float>(m_iconsTexture.width); 
+                float texH = static_cast<float>(m_iconsTexture.height);
+                float iW = texW / 4.0f; float iH = texH / 4.0f;
+                Rectangle srcRec = { static_cast<float>(stats[i].iconIdx % 4) * iW, static_cast<float>(stats[i].iconIdx / 4) * iH, iW, iH };
+                DrawTexturePro(m_iconsTexture, srcRec, { iconRec.x + 4, iconRec.y + 4, 28, 28 }, { 0, 0 }, 0.0f, WHITE);
+            }
+
+            // Label
+            DrawText(stats[i].name, (int)rec.x + 85, rowY + 2, 18, WHITE);
+
+            // Amount (BIG and BOLD-looking)
+            DrawText(TextFormat("%d", stats[i].amount), (int)rec.x + 200, rowY, 32, stats[i].color);
+
+            // Progress Bar (visual representation, max 1000)
+            float barW = 200;
+            float fillRatio = (float)stats[i].amount / 1000.0f;
+            if (fillRatio > 1.0f) fillRatio = 1.0f;
+
+            Rectangle barBg = { rec.x + 320, (float)rowY + 10, barW, 20 };
+            DrawRectangleRounded(barBg, 0.5f, 10, { 20, 20, 20, 200 });
+
+            Rectangle barFill = { rec.x + 320, (float)rowY + 10, barW * fillRatio, 20 };
+            DrawRectangleRounded(barFill, 0.5f, 10, stats[i].color);
+            DrawRectangleRoundedLinesEx(barBg, 0.5f, 10, 1.5f, stats[i].color);
+        }
+
+        startY += 160;
+
+        // === INFRASTRUCTURE SECTION ===
+        DrawText("INFRASTRUCTURE", (int)rec.x + 30, startY, 18, COLOR_NEON_TEAL);
+        startY += 35;
+
+        DrawRectangle((int)rec.x + 25, startY - 5, (int)width - 50, 45, { 30, 40, 50, 180 });
+
+        // Icon (index 3 for buildings)
+        Rectangle bldIconRec = { rec.x + 35, (float)startY + 2, 36, 36 };
+        DrawRectangleRounded(bldIconRec, 0.2f, 5, { 25, 30, 35, 255 });
+        if (m_isIconsLoaded) {
+            float texW = static_cast<float>(m_iconsTexture.width); 
+            float texH = static_cast<float>(m_iconsTexture.height);
+            Rectangle srcRec = { static_cast<float>(3 % 4) * (texW / 4.0f), static_cast<float>(3 / 4) * (texH / 4.0f), texW / 4.0f, texH / 4.0f };
+            DrawTexturePro(m_iconsTexture, srcRec, { bldIconRec.x + 4, bldIconRec.y + 4, 28, 28 }, { 0, 0 }, 0.0f, WHITE);
+        } else {
+            DrawText("B", (int)bldIconRec.x + 10, (int)bldIconRec.y + 5, 20, COLOR_NEON_GOLD);
+        }
+
+        DrawText("BUILDINGS", (int)rec.x + 85, startY + 2, 18, WHITE);
+        DrawText(TextFormat("%d", buildingCount), (int)rec.x + 230, startY, 32, COLOR_NEON_GOLD);
+    });
 }
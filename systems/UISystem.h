@@ -17,6 +17,10 @@
 
 #include "../systems/BuildingSystem.h"
 
+#include "../game/UIRenderCache.h"
+
+#include "../core/SlotMap.h"
+
 #include <memory>
 
 #include <unordered_map>
@@ -33,6 +37,9 @@
 class Colony;
 
 class BuildingInstance;
+
+// Uchwyt elementu UI (SlotMap w UISystem) - zamiast tekstowego ID
+using UIElementHandle = SlotHandle;
 enum class UIElementType : uint32_t {
 
 BUTTON = 0,
@@ -146,7 +153,7 @@ fontName("Arial"), fontSize(12), isVisible(true) {}
 };
 struct UIClickedEvent {
 
-std::string elementId;
+UIElementHandle elementId;
 
 std::string elementType;
 
@@ -161,7 +168,7 @@ std::chrono::high_resolution_clock::time_point clickTime;
 };
 struct UIStateChangedEvent {
 
-std::string elementId;
+UIElementHandle elementId;
 
 UIState oldState;
 
@@ -172,7 +179,7 @@ std::string playerId;
 };
 struct UIProgressUpdatedEvent {
 
-std::string elementId;
+UIElementHandle elementId;
 
 float oldProgress;
 
@@ -223,8 +230,22 @@ bool requiresPlayerId;
           requiresPlayerId(true) {}
 };
 
+struct UIAnimation {
+    UIAnimationType type;
+    float duration;
+    float startTime;
+    float progress;
+    std::function<void(float)> easingFunction;
+    
+    UIAnimation(UIAnimationType t, float dur = 1.0f) 
+        : type(t), duration(dur), startTime(0), progress(0),
+          easingFunction([](float p) { return p; }) {}
+};
+
 struct UIElement {
-    std::string id;
+    UIElementHandle handle;
+    uint32_t player = 0;     // indeks w m_players
+    uint32_t playerSlot = 0; // pozycja na liście elementów gracza
     UIElementType type;
     UIState state;
     UIPosition position;
@@ -232,6 +253,7 @@ struct UIElement {
     std::string text;
     std::string texturePath;
     std::unordered_map<std::string, std::string> properties;
+    std::vector<UIAnimation> animations;
     std::chrono::high_resolution_clock::time_point lastInteraction;
     std::function<void()> onClick;
     std::function<void()> onHover;
@@ -244,18 +266,6 @@ struct UIElement {
     Vector3 getScreenPosition() const;
 };
 
-struct UIAnimation {
-    UIAnimationType type;
-    float duration;
-    float startTime;
-    float progress;
-    std::function<void(float)> easingFunction;
-    
-    UIAnimation(UIAnimationType t, float dur = 1.0f) 
-        : type(t), duration(dur), startTime(0), progress(0),
-          easingFunction([](float p) { return p; }) {}
-};
-
 class UIFactory {
 public:
     static std::unordered_map<UIElementType, UIElementConfig> createBaseElementTypes() {
@@ -316,13 +326,43 @@ public:
     
     static void applyLayout(std::vector<UIElement*>& elements, LayoutType layoutType, const Vector2& containerSize);
     static void makeResponsive(std::vector<UIElement*>& elements, const Vector2& screenSize);
+
+    // Układ jednej listy elementów liczony tylko po invalidate() albo
+    // zmianie rozmiaru ekranu; pusty kontener = cały ekran
+    void setLayout(LayoutType layoutType, const Vector2& containerSize);
+    void invalidate() { m_dirty = true; }
+    bool isDirty() const { return m_dirty; }
+    /** true, jeśli pozycje zostały przeliczone */
+    bool update(SlotMap<UIElement>& store, const std::vector<UIElementHandle>& handles, const Vector2& screenSize);
     
 private:
     static void applyAbsoluteLayout(std::vector<UIElement*>& elements);
     static void applyFlowLayout(std::vector<UIElement*>& elements, bool horizontal);
     static void applyGridLayout(std::vector<UIElement*>& elements, const Vector2& containerSize);
+
+    LayoutType m_layoutType = LayoutType::ABSOLUTE;
+    Vector2 m_containerSize = { 0.0f, 0.0f };
+    Vector2 m_screenSize = { 0.0f, 0.0f };
+    bool m_dirty = true;
+    std::vector<UIElement*> m_scratch;
 };
 
+// Siatka ekranu do trafień myszą: komórka -> elementy ją pokrywające.
+// Przebudowywana razem z układem, widoczność sprawdzana przy zapytaniu.
+class UIHitGrid {
+public:
+    static constexpr int CELL_SIZE = 64;
+
+    void rebuild(const SlotMap<UIElement>& store, const std::vector<UIElementHandle>& handles, const Vector2& screenSize);
+    /** Najwyższy (zIndex, potem później dodany) widoczny element pod punktem */
+    UIElementHandle hitTest(const SlotMap<UIElement>& store, float x, float y) const;
+
+private:
+    int m_cols = 0;
+    int m_rows = 0;
+    std::vector<uint32_t> m_cellStart; // m_cols * m_rows + 1 przesunięć w m_entries
+    std::vector<UIElementHandle> m_entries;
+};
 
 public:
 
@@ -333,6 +373,7 @@ virtual ~UISystem() override;
 void initialize() override;
 
 void update(float deltaTime) override;
+void declareAccess(SystemAccess& access) const override;
 
 void render() override;
 
@@ -346,29 +387,40 @@ void setColony(Colony* colony) { m_colony = colony; }
 
 bool registerUIElementType(const UIElementConfig& config);
 
-std::string createUIElement(UIElementType type, const std::string& playerId, const UIPosition& position);
+UIElementHandle createUIElement(UIElementType type, const std::string& playerId, const UIPosition& position);
+
+bool deleteUIElement(UIElementHandle handle);
 
-bool deleteUIElement(const std::string& elementId, const std::string& playerId);
+UIElement* getUIElement(UIElementHandle handle);
 
-UIElement* getUIElement(const std::string& elementId, const std::string& playerId) const;
+const UIElement* getUIElement(UIElementHandle handle) const;
 
-std::vector<UIElement*> getPlayerUIElements(const std::string& playerId) const;
+// Lista uchwytów gracza w kolejności dodania (pusta dla nieznanego gracza)
+const std::vector<UIElementHandle>& getPlayerUIElements(const std::string& playerId) const;
 
-bool updateUIElementPosition(const std::string& elementId, const std::string& playerId, const UIPosition& position);
+bool updateUIElementPosition(UIElementHandle handle, const UIPosition& position);
 
-bool updateUIElementText(const std::string& elementId, const std::string& playerId, const std::string& text);
+bool updateUIElementText(UIElementHandle handle, const std::string& text);
 
-bool setUIElementState(const std::string& elementId, const std::string& playerId, UIState state);
+bool setUIElementState(UIElementHandle handle, UIState state);
 
-bool addUIElementAnimation(const std::string& elementId, const std::string& playerId, const UIAnimation& animation);
+bool addUIElementAnimation(UIElementHandle handle, const UIAnimation& animation);
 
-bool clearUIElementAnimations(const std::string& elementId, const std::string& playerId);
+bool clearUIElementAnimations(UIElementHandle handle);
+
+bool setPlayerLayout(const std::string& playerId, UILayoutManager::LayoutType layoutType, const Vector2& containerSize);
 
 bool createPlayerDashboard(const std::string& playerId);
 
 void updatePlayerUI(const std::string& playerId);
 
-bool handleUIClick(const std::string& elementId, const std::string& playerId, float clickX, float clickY);
+// Element gracza pod punktem ekranu (siatka trafień), nieważny uchwyt = brak
+UIElementHandle hitTestUI(const std::string& playerId, float x, float y);
+
+bool handleUIClick(UIElementHandle handle, float clickX, float clickY);
+
+// Trafienie + kliknięcie w jednym kroku
+bool handleUIClickAt(const std::string& playerId, float clickX, float clickY);
 
 struct UISystemStats {
     size_t totalUIElementTypes;
@@ -386,7 +438,7 @@ void DrawBuildingSelectionPanel(const std::vector<BuildingBlueprint*>& blueprint
 void DrawSelectionInfo(const std::vector<Settler*>& selectedSettlers, int screenWidth, int screenHeight);
 void DrawSettlerStatsOverlay(const std::vector<Settler*>& settlers, Camera3D camera, int screenWidth, int screenHeight);
 void DrawSettlersStatsPanel(const std::vector<Settler*>& settlers, int screenWidth, int screenHeight);
-void DrawSettlerOverheadUI(const Settler& settler, const Camera& camera);
+void DrawSettlerOverheadUI(const Settler& settler, const Camera& camera); // tylko dodaje do WorldOverlay
 void ShowBuildingInfo(BuildingInstance* building, int screenWidth);
 bool HandleSelectionPanelClick(int screenWidth, int screenHeight);
 std::string HandleBuildingSelectionPanelClick(const std::vector<BuildingBlueprint*>& blueprints, int screenWidth, int screenHeight);
@@ -417,47 +469,32 @@ bool IsMouseOverUI();
 
 private:
 
-void initializeBaseUIElementTypes();
+// Elementy jednego gracza: kolejność rysowania, układ i siatka trafień
+struct PlayerUI {
+    std::string id;
+    std::vector<UIElementHandle> elements;
+    UILayoutManager layout;
+    UIHitGrid hitGrid;
+};
 
-std::string generateUIElementId();
+void initializeBaseUIElementTypes();
 
 void updateUIAnimations(double deltaTime);
 
-void renderPlayerUI(const std::string& playerId);
+void renderPlayerUI(const PlayerUI& player);
 
 void lazyLoadPlayerUI(const std::string& playerId);
 
 void notifyUIEvent(void* event);
 
-struct UICache {
-    std::unordered_map<std::string, std::vector<std::string>> playerElements;
-    std::unordered_map<std::string, UIElement> cachedElements;
-    std::chrono::high_resolution_clock::time_point lastCleanup;
-    
-    UICache() : lastCleanup(std::chrono::high_resolution_clock::now()) {}
-    
-    void addPlayerElements(const std::string& playerId, const std::vector<std::string>& elements) {
-        playerElements[playerId] = elements;
-    }
-    
-    bool getPlayerElements(const std::string& playerId, std::vector<std::string>& elements) const {
-        auto it = playerElements.find(playerId);
-        if (it != playerElements.end()) {
-            elements = it->second;
-            return true;
-        }
-        return false;
-    }
-    
-    void cleanup() {
-        auto now = std::chrono::high_resolution_clock::now();
-        if (std::chrono::duration_cast<std::chrono::seconds>(now - lastCleanup).count() > 60) {
-            playerElements.clear();
-            cachedElements.clear();
-            lastCleanup = now;
-        }
-    }
-};
+PlayerUI* findPlayer(const std::string& playerId);
+
+PlayerUI& getOrCreatePlayer(const std::string& playerId);
+
+// Przelicza układ i siatkę trafień gracza, jeśli zostały unieważnione
+void refreshPlayerLayout(PlayerUI& player);
+
+void invalidatePlayerLayout(const UIElement& element);
 
 
 private:
@@ -466,13 +503,11 @@ std::string m_name;
 
 std::unordered_map<UIElementType, UIElementConfig> m_uiElementTypes;
 
-std::unordered_map<std::string, std::unordered_map<std::string, UIElement>> m_playerUIElements;
+SlotMap<UIElement> m_elements;
 
-std::unordered_map<std::string, std::vector<std::string>> m_playerElementIds;
+std::vector<PlayerUI> m_players;
 
-std::unordered_map<std::string, std::vector<UIAnimation>> m_activeAnimations;
-
-UICache m_cache;
+std::unordered_map<std::string, uint32_t> m_playerIndex;
 
 mutable std::atomic<size_t> m_cacheHits;
 
@@ -482,8 +517,6 @@ mutable std::atomic<size_t> m_totalRenderTime;
 
 mutable std::atomic<size_t> m_interactionCount;
 
-std::atomic<uint64_t> m_nextUIElementId;
-
 int m_activeSelectionTab = 0;
 
 int m_selectedInventorySlot = -1;
@@ -516,4 +549,8 @@ private:
     
     Texture2D m_iconsTexture;
     bool m_isIconsLoaded = false;
+
+    // Panele bez animacji - przerysowywane do tekstury po zmianie danych
+    CachedPanel m_resourceBarPanel;
+    CachedPanel m_colonyStatsPanel;
 };